@@ -0,0 +1,252 @@
+/**
+ * This file is part of GEO Project.
+ * It is subject to the license terms in the LICENSE.md file found in the top-level directory
+ * of this distribution and at https://github.com/GEO-Project/GEO-Project/blob/master/LICENSE.md
+ *
+ * No part of GEO Project, including this file, may be copied, modified, propagated, or distributed
+ * except according to the terms contained in the LICENSE.md file.
+ */
+
+#include "../src/core/common/Types.h"
+#include "../src/core/common/multiprecision/FixedTrustLineAmount.h"
+
+#include <algorithm>
+#include <chrono>
+#include <iomanip>
+#include <iostream>
+#include <random>
+
+
+/**
+ * Compares the amounts arithmetic of the max flow calculation DFS:
+ * TrustLineAmount (checked_uint256_t, free amount is allocated on each query, as it was done before)
+ * against FixedTrustLineAmount (free amount is returned by value).
+ *
+ * DFS is the same as the one of the InitiateMaxFlowCalculationTransaction::calculateOneNode()
+ * (and of the PathsManager), but the nodes are addressed by indexes instead of the UUIDs,
+ * so only the amounts handling differs between the two runs.
+ *
+ * Usage: benchmark__max_flow_amounts [nodes count] [trust lines per node] [targets count]
+ */
+
+namespace {
+
+const uint8_t kMaxPathLength = 5;
+
+template <typename Amount>
+struct BenchmarkTrustLine {
+    size_t targetNode;
+    Amount amount;
+    Amount usedAmount;
+};
+
+ConstSharedTrustLineAmount freeAmount(
+    const BenchmarkTrustLine<TrustLineAmount> &trustLine)
+{
+    return make_shared<const TrustLineAmount>(
+        trustLine.amount - trustLine.usedAmount);
+}
+
+FixedTrustLineAmount freeAmount(
+    const BenchmarkTrustLine<FixedTrustLineAmount> &trustLine)
+{
+    return trustLine.amount - trustLine.usedAmount;
+}
+
+const TrustLineAmount &amountValue(
+    const ConstSharedTrustLineAmount &amount)
+{
+    return *amount;
+}
+
+const FixedTrustLineAmount &amountValue(
+    const FixedTrustLineAmount &amount)
+{
+    return amount;
+}
+
+bool isZero(
+    const TrustLineAmount &amount)
+{
+    return amount == 0;
+}
+
+bool isZero(
+    const FixedTrustLineAmount &amount)
+{
+    return amount.isZero();
+}
+
+
+template <typename Amount>
+class MaxFlowCalculation {
+public:
+    MaxFlowCalculation(
+        const vector<vector<pair<size_t, uint64_t>>> &graph)
+    {
+        mTrustLines.resize(graph.size());
+        for (size_t node = 0; node < graph.size(); ++node) {
+            for (const auto &targetAndAmount : graph[node]) {
+                mTrustLines[node].push_back({
+                    targetAndAmount.first,
+                    Amount(targetAndAmount.second),
+                    Amount(0)});
+            }
+        }
+    }
+
+    Amount calculate(
+        const size_t source,
+        const size_t target)
+    {
+        for (auto &nodeTrustLines : mTrustLines) {
+            for (auto &trustLine : nodeTrustLines) {
+                trustLine.usedAmount = 0;
+            }
+        }
+
+        mSource = source;
+        mTarget = target;
+        mMaxFlow = 0;
+        for (mCurrentPathLength = 2; mCurrentPathLength <= kMaxPathLength; ++mCurrentPathLength) {
+            calculateMaxFlowOnOneLevel();
+        }
+        return mMaxFlow;
+    }
+
+protected:
+    void calculateMaxFlowOnOneLevel()
+    {
+        for (auto &trustLine : mTrustLines[mSource]) {
+            while (true) {
+                const auto kFreeAmount = freeAmount(trustLine);
+                if (isZero(amountValue(kFreeAmount))) {
+                    break;
+                }
+                mForbiddenNodes.clear();
+                const Amount kFlow = calculateOneNode(
+                    trustLine.targetNode,
+                    amountValue(kFreeAmount),
+                    1);
+                if (isZero(kFlow)) {
+                    break;
+                }
+                trustLine.usedAmount += kFlow;
+            }
+        }
+    }
+
+    Amount calculateOneNode(
+        const size_t node,
+        const Amount &currentFlow,
+        uint8_t level)
+    {
+        if (node == mTarget) {
+            mMaxFlow += currentFlow;
+            return currentFlow;
+        }
+        if (level == mCurrentPathLength) {
+            return 0;
+        }
+
+        for (auto &trustLine : mTrustLines[node]) {
+            if (trustLine.targetNode == mSource) {
+                continue;
+            }
+            if (find(
+                    mForbiddenNodes.begin(),
+                    mForbiddenNodes.end(),
+                    trustLine.targetNode) != mForbiddenNodes.end()) {
+                continue;
+            }
+            Amount nextFlow = currentFlow;
+            const auto kFreeAmount = freeAmount(trustLine);
+            if (amountValue(kFreeAmount) < currentFlow) {
+                nextFlow = amountValue(kFreeAmount);
+            }
+            if (isZero(nextFlow)) {
+                continue;
+            }
+            mForbiddenNodes.push_back(node);
+            const Amount kCalculatedFlow = calculateOneNode(
+                trustLine.targetNode,
+                nextFlow,
+                level + 1);
+            mForbiddenNodes.pop_back();
+            if (not isZero(kCalculatedFlow)) {
+                trustLine.usedAmount += kCalculatedFlow;
+                return kCalculatedFlow;
+            }
+        }
+        return 0;
+    }
+
+protected:
+    vector<vector<BenchmarkTrustLine<Amount>>> mTrustLines;
+    vector<size_t> mForbiddenNodes;
+    size_t mSource;
+    size_t mTarget;
+    uint8_t mCurrentPathLength;
+    Amount mMaxFlow;
+};
+
+
+template <typename Amount>
+void measureMaxFlows(
+    const string &amountName,
+    const vector<vector<pair<size_t, uint64_t>>> &graph,
+    const vector<size_t> &targets)
+{
+    MaxFlowCalculation<Amount> calculation(graph);
+
+    Amount totalFlow = 0;
+    const auto kStarted = chrono::steady_clock::now();
+    for (const auto kTarget : targets) {
+        totalFlow += calculation.calculate(0, kTarget);
+    }
+    const auto kElapsed = chrono::duration<double>(chrono::steady_clock::now() - kStarted);
+
+    cout << left << setw(24) << amountName
+         << fixed << setprecision(3) << kElapsed.count() << " s"
+         << " (total flow " << totalFlow << ")" << endl;
+}
+
+}
+
+
+int main(int argc, char **argv)
+{
+    const size_t kNodesCount = argc > 1 ? stoul(argv[1]) : 3000;
+    const size_t kTrustLinesPerNode = argc > 2 ? stoul(argv[2]) : 12;
+    const size_t kTargetsCount = argc > 3 ? stoul(argv[3]) : 40;
+
+    // Graph is generated with the fixed seed, so the runs are comparable.
+    mt19937_64 generator(42);
+    uniform_int_distribution<size_t> nodesDistribution(0, kNodesCount - 1);
+    uniform_int_distribution<uint64_t> amountsDistribution(1, 1000000000000000ull);
+
+    vector<vector<pair<size_t, uint64_t>>> graph(kNodesCount);
+    for (size_t node = 0; node < kNodesCount; ++node) {
+        while (graph[node].size() < kTrustLinesPerNode) {
+            const auto kTarget = nodesDistribution(generator);
+            if (kTarget != node) {
+                graph[node].push_back(
+                    make_pair(
+                        kTarget,
+                        amountsDistribution(generator)));
+            }
+        }
+    }
+
+    vector<size_t> targets;
+    while (targets.size() < kTargetsCount) {
+        const auto kTarget = nodesDistribution(generator);
+        if (kTarget != 0) {
+            targets.push_back(kTarget);
+        }
+    }
+
+    measureMaxFlows<TrustLineAmount>("TrustLineAmount", graph, targets);
+    measureMaxFlows<FixedTrustLineAmount>("FixedTrustLineAmount", graph, targets);
+    return 0;
+}
@@ -0,0 +1,111 @@
+/**
+ * This file is part of GEO Project.
+ * It is subject to the license terms in the LICENSE.md file found in the top-level directory
+ * of this distribution and at https://github.com/GEO-Project/GEO-Project/blob/master/LICENSE.md
+ *
+ * No part of GEO Project, including this file, may be copied, modified, propagated, or distributed
+ * except according to the terms contained in the LICENSE.md file.
+ */
+
+#include "../src/core/network/communicator/internal/incoming/MessageParser.h"
+#include "../src/core/common/exceptions/RuntimeError.h"
+
+#include <chrono>
+#include <iomanip>
+#include <iostream>
+
+
+/**
+ * Measures the parsing cost of the incoming messages, per message type
+ * (type dispatch, allocation and deserialization of the message).
+ *
+ * Only the public interface of the MessagesParser is used, so the same file could be built
+ * against the previous parser implementation to get the "before" numbers.
+ *
+ * Usage: benchmark__messages_parser [iterations count]
+ */
+
+namespace {
+
+void measureParsing(
+    MessagesParser &parser,
+    const string &messageName,
+    const Message &message,
+    const size_t iterationsCount)
+{
+    // Serialized via the base class interface: overrides of the message types might be non public.
+    const auto bytesAndCount = message.serializeToBytes();
+
+    // Warm up: builds the factories table and fills the messages pools.
+    for (size_t i = 0; i < iterationsCount / 10; ++i) {
+        parser.processBytesSequence(bytesAndCount.first, bytesAndCount.second);
+    }
+
+    const auto kStarted = chrono::steady_clock::now();
+    for (size_t i = 0; i < iterationsCount; ++i) {
+        const auto kResult = parser.processBytesSequence(bytesAndCount.first, bytesAndCount.second);
+        if (not kResult.first) {
+            throw RuntimeError(
+                "measureParsing: message " + messageName + " can't be parsed.");
+        }
+    }
+    const auto kElapsed = chrono::duration<double, micro>(chrono::steady_clock::now() - kStarted);
+
+    cout << left << setw(56) << messageName
+         << fixed << setprecision(3) << kElapsed.count() / iterationsCount << " us/msg" << endl;
+}
+
+}
+
+
+int main(int argc, char **argv)
+{
+    const size_t kIterationsCount = argc > 1 ? stoul(argv[1]) : 1000000;
+
+    const NodeUUID kSenderUUID;
+    const TransactionUUID kTransactionUUID;
+    Logger logger(kSenderUUID);
+    MessagesParser parser(&logger);
+
+    const ConfirmationMessage kConfirmation(
+        kSenderUUID,
+        kTransactionUUID);
+    measureParsing(
+        parser,
+        "ConfirmationMessage",
+        kConfirmation,
+        kIterationsCount);
+
+    // Typical payment: coordinator, receiver and 4 intermediate nodes.
+    ParticipantsVotesMessage votes(
+        kSenderUUID,
+        kTransactionUUID,
+        kSenderUUID);
+    for (size_t i = 0; i < 6; ++i) {
+        votes.addParticipant(NodeUUID());
+    }
+    measureParsing(
+        parser,
+        "ParticipantsVotesMessage (6 participants)",
+        votes,
+        kIterationsCount);
+
+    vector<pair<PathID, ConstSharedTrustLineAmount>> reservations;
+    for (PathID pathID = 0; pathID < 4; ++pathID) {
+        reservations.push_back(
+            make_pair(
+                pathID,
+                make_shared<const TrustLineAmount>(1000 + pathID)));
+    }
+    const IntermediateNodeReservationRequestMessage kReservationRequest(
+        kSenderUUID,
+        kTransactionUUID,
+        reservations);
+    measureParsing(
+        parser,
+        "IntermediateNodeReservationRequestMessage (4 paths)",
+        kReservationRequest,
+        kIterationsCount);
+
+    return 0;
+}
@@ -0,0 +1,147 @@
+/**
+ * This file is part of GEO Project.
+ * It is subject to the license terms in the LICENSE.md file found in the top-level directory
+ * of this distribution and at https://github.com/GEO-Project/GEO-Project/blob/master/LICENSE.md
+ *
+ * No part of GEO Project, including this file, may be copied, modified, propagated, or distributed
+ * except according to the terms contained in the LICENSE.md file.
+ */
+
+#include "../src/core/transactions/scheduler/TransactionsAwakeningSchedule.h"
+
+#include <chrono>
+#include <iomanip>
+#include <iostream>
+#include <map>
+#include <random>
+
+
+/**
+ * Measures the cost of one scheduler event (awakening of some transaction is moved,
+ * and then the closest awakening is requested to re-arm the timer) with many waiting transactions.
+ *
+ * Compares the TransactionsAwakeningSchedule against the previous approach of the scheduler:
+ * the transactions map is scanned for the minimal awakening timestamp on each event.
+ *
+ * Usage: benchmark__transactions_awakening_schedule [transactions count] [events count]
+ */
+
+namespace {
+
+class BenchmarkTransaction:
+    public BaseTransaction {
+
+public:
+    BenchmarkTransaction(
+        Logger &logger) :
+        BaseTransaction(
+            BaseTransaction::TransactionByCommandUUIDType,
+            logger)
+    {}
+
+    TransactionResult run()
+    {
+        return resultDone();
+    }
+
+protected:
+    const string logHeader() const
+    {
+        return "[BenchmarkTA]";
+    }
+};
+
+
+/**
+ * Same lookup as the TransactionsScheduler performed before the awakening schedule.
+ */
+GEOEpochTimestamp minimalAwakeningTimestamp(
+    const map<BaseTransaction::Shared, TransactionState> &transactions)
+{
+    auto nextTransactionAndState = transactions.cbegin();
+    for (auto it = transactions.cbegin(); it != transactions.cend(); ++it) {
+        if (it->second.awakeningTimestamp() < nextTransactionAndState->second.awakeningTimestamp()) {
+            nextTransactionAndState = it;
+        }
+    }
+    return nextTransactionAndState->second.awakeningTimestamp();
+}
+
+void printResult(
+    const string &approachName,
+    const chrono::steady_clock::duration &elapsed,
+    const size_t eventsCount,
+    const GEOEpochTimestamp checksum)
+{
+    const auto kNanoseconds = chrono::duration<double, nano>(elapsed).count();
+    cout << left << setw(24) << approachName
+         << fixed << setprecision(1) << kNanoseconds / eventsCount << " ns/event"
+         << " (checksum " << checksum << ")" << endl;
+}
+
+}
+
+
+int main(int argc, char **argv)
+{
+    const size_t kTransactionsCount = argc > 1 ? stoul(argv[1]) : 10000;
+    const size_t kEventsCount = argc > 2 ? stoul(argv[2]) : 100000;
+
+    const NodeUUID kNodeUUID;
+    Logger logger(kNodeUUID);
+
+    // Events are generated with the fixed seed, so both approaches process the same sequence.
+    mt19937_64 generator(42);
+    uniform_int_distribution<size_t> transactionsDistribution(0, kTransactionsCount - 1);
+    uniform_int_distribution<GEOEpochTimestamp> timestampsDistribution(1, 1000000000);
+
+    vector<BaseTransaction::Shared> transactions;
+    vector<GEOEpochTimestamp> initialTimestamps;
+    for (size_t i = 0; i < kTransactionsCount; ++i) {
+        transactions.push_back(make_shared<BenchmarkTransaction>(logger));
+        initialTimestamps.push_back(timestampsDistribution(generator));
+    }
+
+    vector<pair<size_t, GEOEpochTimestamp>> events;
+    for (size_t i = 0; i < kEventsCount; ++i) {
+        events.push_back(
+            make_pair(
+                transactionsDistribution(generator),
+                timestampsDistribution(generator)));
+    }
+
+    {
+        map<BaseTransaction::Shared, TransactionState> transactionsStates;
+        for (size_t i = 0; i < kTransactionsCount; ++i) {
+            transactionsStates.insert(
+                make_pair(
+                    transactions[i],
+                    TransactionState(initialTimestamps[i])));
+        }
+
+        GEOEpochTimestamp checksum = 0;
+        const auto kStarted = chrono::steady_clock::now();
+        for (const auto &event : events) {
+            transactionsStates.find(transactions[event.first])->second = TransactionState(event.second);
+            checksum += minimalAwakeningTimestamp(transactionsStates);
+        }
+        printResult("map scan", chrono::steady_clock::now() - kStarted, kEventsCount, checksum);
+    }
+
+    {
+        TransactionsAwakeningSchedule schedule;
+        for (size_t i = 0; i < kTransactionsCount; ++i) {
+            schedule.schedule(transactions[i], initialTimestamps[i]);
+        }
+
+        GEOEpochTimestamp checksum = 0;
+        const auto kStarted = chrono::steady_clock::now();
+        for (const auto &event : events) {
+            schedule.schedule(transactions[event.first], event.second);
+            checksum += schedule.earliestAwakeningTimestamp();
+        }
+        printResult("awakening schedule", chrono::steady_clock::now() - kStarted, kEventsCount, checksum);
+    }
+
+    return 0;
+}
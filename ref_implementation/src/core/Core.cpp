@@ -35,6 +35,8 @@ int Core::run()
             error() << "Core can't be initialised. Process will now be stopped.";
             return -1;
         }
+        mCommunicator->prefetchEndpoints(
+            mTrustLinesManager->rt1());
         mCommunicator->beginAcceptMessages();
         mCommandsInterface->beginAcceptCommands();
 
@@ -193,6 +195,7 @@ int Core::initCommunicator(
             mSettings->uuid2addressHost(&conf),
             mSettings->uuid2addressPort(&conf),
             mNodeUUID,
+            mSettings->networkWorkersCount(&conf),
             *mLog);
 
         info() << "Network communicator is successfully initialised";
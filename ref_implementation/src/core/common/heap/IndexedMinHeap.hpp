@@ -0,0 +1,176 @@
+/**
+ * This file is part of GEO Project.
+ * It is subject to the license terms in the LICENSE.md file found in the top-level directory
+ * of this distribution and at https://github.com/GEO-Project/GEO-Project/blob/master/LICENSE.md
+ *
+ * No part of GEO Project, including this file, may be copied, modified, propagated, or distributed
+ * except according to the terms contained in the LICENSE.md file.
+ */
+
+#ifndef GEO_NETWORK_CLIENT_INDEXEDMINHEAP_H
+#define GEO_NETWORK_CLIENT_INDEXEDMINHEAP_H
+
+#include <vector>
+#include <utility>
+#include <cstddef>
+
+
+using namespace std;
+
+
+/**
+ * Binary min-heap, that keeps position of each item in the item itself,
+ * so the item could be re-ordered (after it's key was changed) or removed without searching it.
+ *
+ * "Less" - comparator of two items: bool operator()(const Item&, const Item&).
+ * "Position" - accessor of the position of the item: size_t& operator()(const Item&).
+ * Position is updated on each move of the item inside the heap;
+ * after the item is removed, it's position is not touched anymore.
+ *
+ * Front item - O(1), push / update / remove - O(log n).
+ */
+template <typename Item, typename Less, typename Position>
+class IndexedMinHeap {
+public:
+    void push(
+        Item &&item)
+    {
+        mPosition(item) = mItems.size();
+        mItems.push_back(move(item));
+        siftUp(mItems.size() - 1);
+    }
+
+    /**
+     * Restores the order of the heap, after the key of the item on "position" was changed.
+     */
+    void update(
+        const size_t position)
+        noexcept
+    {
+        siftDown(siftUp(position));
+    }
+
+    /**
+     * Removes item on "position" from the heap.
+     * @returns removed item.
+     */
+    Item remove(
+        const size_t position)
+        noexcept
+    {
+        auto removedItem = move(mItems[position]);
+        auto lastItem = move(mItems.back());
+        mItems.pop_back();
+
+        if (position < mItems.size()) {
+            place(move(lastItem), position);
+            update(position);
+        }
+        return removedItem;
+    }
+
+    /**
+     * @returns item with the minimal key.
+     * Heap must not be empty.
+     */
+    const Item &front() const
+        noexcept
+    {
+        return mItems.front();
+    }
+
+    /**
+     * Items are stored in the array in the order of the heap:
+     * children of the item on position "i" are on positions "2i + 1" and "2i + 2".
+     */
+    const Item &operator[](
+        const size_t position) const
+        noexcept
+    {
+        return mItems[position];
+    }
+
+    Item &operator[](
+        const size_t position)
+        noexcept
+    {
+        return mItems[position];
+    }
+
+    size_t size() const
+        noexcept
+    {
+        return mItems.size();
+    }
+
+    bool empty() const
+        noexcept
+    {
+        return mItems.empty();
+    }
+
+protected:
+    /**
+     * @returns final position of the item.
+     */
+    size_t siftUp(
+        size_t position)
+        noexcept
+    {
+        auto item = move(mItems[position]);
+        while (position > 0) {
+            const auto kParentPosition = (position - 1) / 2;
+            if (not mLess(item, mItems[kParentPosition])) {
+                break;
+            }
+
+            place(move(mItems[kParentPosition]), position);
+            position = kParentPosition;
+        }
+        place(move(item), position);
+        return position;
+    }
+
+    void siftDown(
+        size_t position)
+        noexcept
+    {
+        auto item = move(mItems[position]);
+        while (true) {
+            auto childPosition = position * 2 + 1;
+            if (childPosition >= mItems.size()) {
+                break;
+            }
+
+            const auto kRightChildPosition = childPosition + 1;
+            if (kRightChildPosition < mItems.size()
+                and mLess(mItems[kRightChildPosition], mItems[childPosition])) {
+                childPosition = kRightChildPosition;
+            }
+
+            if (not mLess(mItems[childPosition], item)) {
+                break;
+            }
+
+            place(move(mItems[childPosition]), position);
+            position = childPosition;
+        }
+        place(move(item), position);
+    }
+
+    void place(
+        Item &&item,
+        const size_t position)
+        noexcept
+    {
+        mPosition(item) = position;
+        mItems[position] = move(item);
+    }
+
+protected:
+    vector<Item> mItems;
+    Less mLess;
+    Position mPosition;
+};
+
+#endif //GEO_NETWORK_CLIENT_INDEXEDMINHEAP_H
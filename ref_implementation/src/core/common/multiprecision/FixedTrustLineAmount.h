@@ -0,0 +1,220 @@
+/**
+ * This file is part of GEO Project.
+ * It is subject to the license terms in the LICENSE.md file found in the top-level directory
+ * of this distribution and at https://github.com/GEO-Project/GEO-Project/blob/master/LICENSE.md
+ *
+ * No part of GEO Project, including this file, may be copied, modified, propagated, or distributed
+ * except according to the terms contained in the LICENSE.md file.
+ */
+
+#ifndef GEO_NETWORK_CLIENT_FIXEDTRUSTLINEAMOUNT_H
+#define GEO_NETWORK_CLIENT_FIXEDTRUSTLINEAMOUNT_H
+
+#include "../Types.h"
+#include "../exceptions/OverflowError.h"
+
+#include <cstdint>
+#include <ostream>
+
+
+/**
+ * Value type equivalent of the TrustLineAmount, that is used in the hot loops
+ * (max flow calculation and paths building).
+ *
+ * Amount is stored as 4 limbs of 64 bits (least significant limb first) right in the object,
+ * and all the operations are inlined, so there are no allocations and no generic multiprecision code.
+ * Most of the real amounts fits into 128 bits, so (if compiler supports 128 bit integers)
+ * operations on such amounts are done by the native 128 bit arithmetic.
+ *
+ * Same as TrustLineAmount, it throws OverflowError in case of overflow or underflow.
+ */
+class FixedTrustLineAmount {
+public:
+    FixedTrustLineAmount(
+        const uint64_t value = 0)
+        noexcept :
+        mLimbs{value, 0, 0, 0}
+    {}
+
+    explicit FixedTrustLineAmount(
+        const TrustLineAmount &amount)
+        noexcept :
+        mLimbs{0, 0, 0, 0}
+    {
+        // Limbs are exported starting from the least significant one.
+        export_bits(amount, mLimbs, kLimbBitsCount, false);
+    }
+
+    TrustLineAmount toTrustLineAmount() const
+    {
+        TrustLineAmount amount;
+        import_bits(amount, mLimbs, mLimbs + kLimbsCount, kLimbBitsCount, false);
+        return amount;
+    }
+
+    bool isZero() const
+        noexcept
+    {
+        return (mLimbs[0] | mLimbs[1] | mLimbs[2] | mLimbs[3]) == 0;
+    }
+
+    bool fitsInto128Bits() const
+        noexcept
+    {
+        return (mLimbs[2] | mLimbs[3]) == 0;
+    }
+
+    FixedTrustLineAmount& operator+= (
+        const FixedTrustLineAmount &other)
+    {
+#ifdef __SIZEOF_INT128__
+        if (fitsInto128Bits() and other.fitsInto128Bits()) {
+            const auto kSum = lowBits() + other.lowBits();
+            mLimbs[0] = static_cast<uint64_t>(kSum);
+            mLimbs[1] = static_cast<uint64_t>(kSum >> kLimbBitsCount);
+            // Carry of the 128 bit addition.
+            mLimbs[2] = kSum < other.lowBits() ? 1 : 0;
+            return *this;
+        }
+#endif
+
+        uint64_t carry = 0;
+        for (size_t i = 0; i < kLimbsCount; ++i) {
+            const auto kLimbSum = mLimbs[i] + other.mLimbs[i];
+            const uint64_t kNextCarry = (kLimbSum < mLimbs[i]) ? 1 : 0;
+            mLimbs[i] = kLimbSum + carry;
+            carry = kNextCarry | ((mLimbs[i] < kLimbSum) ? 1 : 0);
+        }
+        if (carry != 0) {
+            throw OverflowError(
+                "FixedTrustLineAmount::operator+=: "
+                    "amount is out of range.");
+        }
+        return *this;
+    }
+
+    FixedTrustLineAmount& operator-= (
+        const FixedTrustLineAmount &other)
+    {
+        if (*this < other) {
+            throw OverflowError(
+                "FixedTrustLineAmount::operator-=: "
+                    "amount can't be negative.");
+        }
+
+#ifdef __SIZEOF_INT128__
+        if (fitsInto128Bits()) {
+            // "other" is not greater than this amount, so it fits into 128 bits as well.
+            const auto kDifference = lowBits() - other.lowBits();
+            mLimbs[0] = static_cast<uint64_t>(kDifference);
+            mLimbs[1] = static_cast<uint64_t>(kDifference >> kLimbBitsCount);
+            return *this;
+        }
+#endif
+
+        uint64_t borrow = 0;
+        for (size_t i = 0; i < kLimbsCount; ++i) {
+            const auto kLimbDifference = mLimbs[i] - other.mLimbs[i];
+            const uint64_t kNextBorrow = (mLimbs[i] < other.mLimbs[i]) ? 1 : 0;
+            mLimbs[i] = kLimbDifference - borrow;
+            borrow = kNextBorrow | ((kLimbDifference < borrow) ? 1 : 0);
+        }
+        return *this;
+    }
+
+    friend FixedTrustLineAmount operator+ (
+        FixedTrustLineAmount first,
+        const FixedTrustLineAmount &second)
+    {
+        return first += second;
+    }
+
+    friend FixedTrustLineAmount operator- (
+        FixedTrustLineAmount first,
+        const FixedTrustLineAmount &second)
+    {
+        return first -= second;
+    }
+
+    friend bool operator== (
+        const FixedTrustLineAmount &first,
+        const FixedTrustLineAmount &second)
+        noexcept
+    {
+        return first.mLimbs[0] == second.mLimbs[0]
+            and first.mLimbs[1] == second.mLimbs[1]
+            and first.mLimbs[2] == second.mLimbs[2]
+            and first.mLimbs[3] == second.mLimbs[3];
+    }
+
+    friend bool operator!= (
+        const FixedTrustLineAmount &first,
+        const FixedTrustLineAmount &second)
+        noexcept
+    {
+        return not (first == second);
+    }
+
+    friend bool operator< (
+        const FixedTrustLineAmount &first,
+        const FixedTrustLineAmount &second)
+        noexcept
+    {
+        // Limbs are compared starting from the most significant one.
+        for (size_t i = kLimbsCount; i > 0; --i) {
+            if (first.mLimbs[i - 1] != second.mLimbs[i - 1]) {
+                return first.mLimbs[i - 1] < second.mLimbs[i - 1];
+            }
+        }
+        return false;
+    }
+
+    friend bool operator> (
+        const FixedTrustLineAmount &first,
+        const FixedTrustLineAmount &second)
+        noexcept
+    {
+        return second < first;
+    }
+
+    friend bool operator<= (
+        const FixedTrustLineAmount &first,
+        const FixedTrustLineAmount &second)
+        noexcept
+    {
+        return not (second < first);
+    }
+
+    friend bool operator>= (
+        const FixedTrustLineAmount &first,
+        const FixedTrustLineAmount &second)
+        noexcept
+    {
+        return not (first < second);
+    }
+
+    friend ostream& operator<< (
+        ostream &stream,
+        const FixedTrustLineAmount &amount)
+    {
+        return stream << amount.toTrustLineAmount();
+    }
+
+protected:
+#ifdef __SIZEOF_INT128__
+    unsigned __int128 lowBits() const
+        noexcept
+    {
+        return (static_cast<unsigned __int128>(mLimbs[1]) << kLimbBitsCount) | mLimbs[0];
+    }
+#endif
+
+protected:
+    static const size_t kLimbsCount = 4;
+    static const unsigned kLimbBitsCount = 64;
+
+protected:
+    uint64_t mLimbs[kLimbsCount];
+};
+
+#endif //GEO_NETWORK_CLIENT_FIXEDTRUSTLINEAMOUNT_H
@@ -11,9 +11,11 @@
 #define GEO_NETWORK_CLIENT_MULTIPRECISIONUTILS_H
 
 #include "../Types.h"
+#include "../exceptions/ValueError.h"
 
 #include <boost/endian/arithmetic.hpp>
 #include <vector>
+#include <cstring>
 
 using namespace std;
 
@@ -27,31 +29,44 @@ inline TrustLineAmount absoluteBalanceAmount(
     }
 }
 
-inline vector<byte> trustLineAmountToBytes(
-    const TrustLineAmount &amount) {
-
-    vector<byte> rawExportedBytesBuffer, resultBytesBuffer;
-
-    // Exporting bytes of the "amount".
-    rawExportedBytesBuffer.reserve(kTrustLineAmountBytesCount);
-    export_bits(amount, back_inserter(rawExportedBytesBuffer), 8);
+/**
+ * Writes "amount" into the "buffer" as kTrustLineAmountBytesCount bytes in big endian order,
+ * prepended by zeroes, directly (without any intermediate buffers).
+ *
+ * Returns pointer to the first byte after the written amount.
+ */
+inline byte* trustLineAmountToBytes(
+    const TrustLineAmount &amount,
+    byte *buffer) {
+
+    // Exported bytes are already in big endian order (most significant first),
+    // so the deserializer is independent from current machine architecture.
+    const auto kUsedBytesCount = static_cast<size_t>(
+        export_bits(amount, buffer, 8) - buffer);
+
+    // Moving received bytes to the end of the amount, and prepending them by zeroes.
+    const auto kUnusedBytesCount = kTrustLineAmountBytesCount - kUsedBytesCount;
+    if (kUnusedBytesCount > 0) {
+        memmove(
+            buffer + kUnusedBytesCount,
+            buffer,
+            kUsedBytesCount);
+        memset(
+            buffer,
+            0,
+            kUnusedBytesCount);
+    }
 
-    // Prepending received bytes by zeroes until 32 bytes would be used.
-    resultBytesBuffer.reserve(kTrustLineAmountBytesCount);
+    return buffer + kTrustLineAmountBytesCount;
+}
 
-    size_t unusedBytesCount = kTrustLineAmountBytesCount - rawExportedBytesBuffer.size();
-    for (size_t i = 0; i < unusedBytesCount; ++i) {
-        resultBytesBuffer.push_back(0);
-    }
+inline vector<byte> trustLineAmountToBytes(
+    const TrustLineAmount &amount) {
 
-    size_t usedBytesCount = rawExportedBytesBuffer.size();
-    for (size_t i = 0; i < usedBytesCount; ++i) {
-        resultBytesBuffer.push_back(
-            // Casting each byte to big endian makes the deserializer independent
-            // from current machine architecture, and, as result - platfrom portable.
-            boost::endian::native_to_big(
-                rawExportedBytesBuffer[i]));
-    }
+    vector<byte> resultBytesBuffer(kTrustLineAmountBytesCount);
+    trustLineAmountToBytes(
+        amount,
+        resultBytesBuffer.data());
 
     return resultBytesBuffer;
 }
@@ -144,4 +159,265 @@ inline TrustLineBalance bytesToTrustLineBalance(
 }
 
 
+/*
+ * Compact (variable length) encoding of the amounts and balances.
+ *
+ * Value is written as one header byte, followed by its significant bytes in big endian order
+ * (zero is written as the header byte only). Header byte contains:
+ *  bits 0-5 - count of significant bytes, that follows the header (0..32);
+ *  bit 6    - sign of the value (balances only, 1 for negative values);
+ *  bit 7    - reserved for the next versions of the encoding, always 0
+ *             (values with this bit set are rejected).
+ *
+ * Most of the amounts, that are used by the nodes, fits into several bytes,
+ * so this encoding is several times shorter, than the fixed 32/33 bytes one.
+ */
+const byte kCompactBytesCountMask = 0x3F;
+const byte kCompactNegativeSignFlag = 0x40;
+const byte kCompactReservedFlag = 0x80;
+
+const size_t kCompactTrustLineAmountMaxBytesCount = kTrustLineAmountBytesCount + 1;
+const size_t kCompactTrustLineBalanceMaxBytesCount = kTrustLineBalanceBytesCount + 1;
+
+/**
+ * @returns count of bytes, that would be written by the trustLineAmountToCompactBytes().
+ */
+inline size_t compactTrustLineAmountBytesCount(
+    const TrustLineAmount &amount) {
+
+    if (amount == 0) {
+        return 1;
+    }
+    return 1 + multiprecision::msb(amount) / 8 + 1;
+}
+
+/**
+ * @returns count of bytes, that would be written by the trustLineBalanceToCompactBytes().
+ */
+inline size_t compactTrustLineBalanceBytesCount(
+    const TrustLineBalance &balance) {
+
+    if (balance == 0) {
+        return 1;
+    }
+    return 1 + multiprecision::msb(multiprecision::abs(balance)) / 8 + 1;
+}
+
+/**
+ * @returns count of bytes, that are occupied by the compact amount (or balance),
+ * that begins on the "buffer" (header byte included).
+ */
+inline size_t compactBytesCount(
+    const byte *buffer) {
+
+    return 1 + min<size_t>(
+        *buffer & kCompactBytesCountMask,
+        kTrustLineAmountBytesCount);
+}
+
+/**
+ * Writes "amount" into the "buffer" in compact encoding.
+ * Buffer must have at least compactTrustLineAmountBytesCount(amount) bytes.
+ *
+ * Returns pointer to the first byte after the written amount.
+ */
+inline byte* trustLineAmountToCompactBytes(
+    const TrustLineAmount &amount,
+    byte *buffer) {
+
+    if (amount == 0) {
+        *buffer = 0;
+        return buffer + 1;
+    }
+
+    // Exported bytes are already in big endian order and contains no leading zeroes.
+    auto bytesEnd = export_bits(amount, buffer + 1, 8);
+    *buffer = static_cast<byte>(bytesEnd - buffer - 1);
+    return bytesEnd;
+}
+
+/**
+ * Writes "balance" into the "buffer" in compact encoding.
+ * Buffer must have at least compactTrustLineBalanceBytesCount(balance) bytes.
+ *
+ * Returns pointer to the first byte after the written balance.
+ */
+inline byte* trustLineBalanceToCompactBytes(
+    const TrustLineBalance &balance,
+    byte *buffer) {
+
+    if (balance == 0) {
+        *buffer = 0;
+        return buffer + 1;
+    }
+
+    // Only the absolute value is exported, sign is stored in the header.
+    auto bytesEnd = export_bits(balance, buffer + 1, 8);
+    *buffer = static_cast<byte>(bytesEnd - buffer - 1);
+    if (balance < 0) {
+        *buffer |= kCompactNegativeSignFlag;
+    }
+    return bytesEnd;
+}
+
+inline vector<byte> trustLineAmountToCompactBytes(
+    const TrustLineAmount &amount) {
+
+    vector<byte> resultBytesBuffer(
+        compactTrustLineAmountBytesCount(amount));
+    trustLineAmountToCompactBytes(
+        amount,
+        resultBytesBuffer.data());
+
+    return resultBytesBuffer;
+}
+
+inline vector<byte> trustLineBalanceToCompactBytes(
+    const TrustLineBalance &balance) {
+
+    vector<byte> resultBytesBuffer(
+        compactTrustLineBalanceBytesCount(balance));
+    trustLineBalanceToCompactBytes(
+        balance,
+        resultBytesBuffer.data());
+
+    return resultBytesBuffer;
+}
+
+/**
+ * @throws ValueError in case if the header byte of the compact value is invalid.
+ */
+inline void checkCompactHeader(
+    const byte *buffer) {
+
+    if ((*buffer & kCompactReservedFlag) != 0) {
+        throw ValueError(
+            "checkCompactHeader: reserved bit of the compact value is set.");
+    }
+
+    if ((*buffer & kCompactBytesCountMask) > kTrustLineAmountBytesCount) {
+        throw ValueError(
+            "checkCompactHeader: compact value is too long.");
+    }
+}
+
+/**
+ * Reads amount in compact encoding from the "buffer".
+ * Count of the read bytes could be received via compactBytesCount(buffer).
+ *
+ * @throws ValueError in case if the header byte of the amount is invalid.
+ */
+inline TrustLineAmount compactBytesToTrustLineAmount(
+    const byte *buffer) {
+
+    checkCompactHeader(buffer);
+
+    TrustLineAmount amount(0);
+    const auto kBytesCount = compactBytesCount(buffer) - 1;
+    if (kBytesCount > 0) {
+        import_bits(
+            amount,
+            buffer + 1,
+            buffer + 1 + kBytesCount);
+    }
+
+    return amount;
+}
+
+/**
+ * Reads balance in compact encoding from the "buffer".
+ * Count of the read bytes could be received via compactBytesCount(buffer).
+ *
+ * @throws ValueError in case if the header byte of the balance is invalid.
+ */
+inline TrustLineBalance compactBytesToTrustLineBalance(
+    const byte *buffer) {
+
+    checkCompactHeader(buffer);
+
+    TrustLineBalance balance(0);
+    const auto kBytesCount = compactBytesCount(buffer) - 1;
+    if (kBytesCount > 0) {
+        import_bits(
+            balance,
+            buffer + 1,
+            buffer + 1 + kBytesCount);
+    }
+
+    if ((*buffer & kCompactNegativeSignFlag) != 0) {
+        balance = balance * -1;
+    }
+
+    return balance;
+}
+
+
+/*
+ * Encoding of the amounts in the network messages.
+ * Compact encoding is used only for the remote nodes, that reported its support;
+ * all other nodes receive the amounts in the fixed 32 bytes encoding.
+ */
+enum AmountsEncoding {
+    FixedAmountsEncoding = 0,
+    CompactAmountsEncoding = 1,
+};
+
+/**
+ * @returns count of bytes, that would be written by the trustLineAmountToBytes(amount, buffer, encoding).
+ */
+inline size_t trustLineAmountBytesCount(
+    const TrustLineAmount &amount,
+    const AmountsEncoding encoding) {
+
+    if (encoding == CompactAmountsEncoding) {
+        return compactTrustLineAmountBytesCount(amount);
+    }
+    return kTrustLineAmountBytesCount;
+}
+
+/**
+ * @returns count of bytes, that are occupied by the amount, that begins on the "buffer".
+ */
+inline size_t encodedTrustLineAmountBytesCount(
+    const byte *buffer,
+    const AmountsEncoding encoding) {
+
+    if (encoding == CompactAmountsEncoding) {
+        return compactBytesCount(buffer);
+    }
+    return kTrustLineAmountBytesCount;
+}
+
+inline byte* trustLineAmountToBytes(
+    const TrustLineAmount &amount,
+    byte *buffer,
+    const AmountsEncoding encoding) {
+
+    if (encoding == CompactAmountsEncoding) {
+        return trustLineAmountToCompactBytes(amount, buffer);
+    }
+    return trustLineAmountToBytes(amount, buffer);
+}
+
+/**
+ * @throws ValueError in case if the amount is in compact encoding, and its header byte is invalid.
+ */
+inline TrustLineAmount bytesToTrustLineAmount(
+    const byte *buffer,
+    const AmountsEncoding encoding) {
+
+    if (encoding == CompactAmountsEncoding) {
+        return compactBytesToTrustLineAmount(buffer);
+    }
+
+    TrustLineAmount amount;
+    import_bits(
+        amount,
+        buffer,
+        buffer + kTrustLineAmountBytesCount);
+
+    return amount;
+}
+
+
 #endif //GEO_NETWORK_CLIENT_MULTIPRECISIONUTILS_H
@@ -12,10 +12,12 @@
 CommunicatorIOTransaction::CommunicatorIOTransaction(
     sqlite3 *dbConnection,
     CommunicatorMessagesQueueHandler *communicatorMessagesQueueHandler,
+    UUID2AddressCacheHandler *uuid2AddressCacheHandler,
     Logger &logger) :
 
     mDBConnection(dbConnection),
     mCommunicatorMessagesQueueHandler(communicatorMessagesQueueHandler),
+    mUUID2AddressCacheHandler(uuid2AddressCacheHandler),
     mIsTransactionBegin(true),
     mLog(logger)
 {
@@ -36,6 +38,15 @@ CommunicatorMessagesQueueHandler* CommunicatorIOTransaction::communicatorMessage
     return mCommunicatorMessagesQueueHandler;
 }
 
+UUID2AddressCacheHandler* CommunicatorIOTransaction::uuid2AddressCacheHandler()
+{
+    if (!mIsTransactionBegin) {
+        throw IOError("CommunicatorIOTransaction::uuid2AddressCacheHandler: "
+                          "transaction was rollback, it can't be use now");
+    }
+    return mUUID2AddressCacheHandler;
+}
+
 void CommunicatorIOTransaction::commit()
 {
 #ifdef STORAGE_HANDLER_DEBUG_LOG
@@ -59,6 +70,7 @@ void CommunicatorIOTransaction::commit()
     if (rc != SQLITE_DONE) {
         throw IOError("CommunicatorIOTransaction::commit: Run query; sqlite error: " + to_string(rc));
     }
+    mIsTransactionBegin = false;
 #ifdef STORAGE_HANDLER_DEBUG_LOG
     info() << "transaction commit";
 #endif
@@ -12,6 +12,7 @@
 
 #include "../../common/Types.h"
 #include "CommunicatorMessagesQueueHandler.h"
+#include "UUID2AddressCacheHandler.h"
 
 #include "../../../libs/sqlite3/sqlite3.h"
 
@@ -25,18 +26,26 @@ public:
     CommunicatorIOTransaction(
         sqlite3 *dbConnection,
         CommunicatorMessagesQueueHandler *communicatorMessagesQueueHandler,
+        UUID2AddressCacheHandler *uuid2AddressCacheHandler,
         Logger &logger);
 
     ~CommunicatorIOTransaction();
 
     CommunicatorMessagesQueueHandler *communicatorMessagesQueueHandler();
 
+    UUID2AddressCacheHandler *uuid2AddressCacheHandler();
 
     void rollback();
 
-private:
+    /**
+     * Commits the transaction explicitly, so the caller could handle the error
+     * (otherwise transaction is committed by the destructor).
+     *
+     * @throws IOError in case if the transaction can't be committed.
+     */
     void commit();
 
+private:
     void beginTransactionQuery();
 
     LoggerStream info() const;
@@ -48,6 +57,7 @@ private:
 private:
     sqlite3 *mDBConnection;
     CommunicatorMessagesQueueHandler *mCommunicatorMessagesQueueHandler;
+    UUID2AddressCacheHandler *mUUID2AddressCacheHandler;
     bool mIsTransactionBegin;
     Logger &mLog;
 };
@@ -16,10 +16,11 @@ CommunicatorStorageHandler::CommunicatorStorageHandler(
     const string &dataBaseName,
     Logger &logger):
 
-    mDirectory(directory),
-    mDataBaseName(dataBaseName),
+    mLog(logger),
     mCommunicatorMessagesQueueHandler(connection(dataBaseName, directory), kMessagesQueueTableName, logger),
-    mLog(logger)
+    mUUID2AddressCacheHandler(connection(dataBaseName, directory), kUUID2AddressCacheTableName, logger),
+    mDirectory(directory),
+    mDataBaseName(dataBaseName)
 {
     sqlite3_config(SQLITE_CONFIG_SINGLETHREAD);
 }
@@ -62,6 +63,7 @@ CommunicatorIOTransaction::Shared CommunicatorStorageHandler::beginTransaction()
     return make_shared<CommunicatorIOTransaction>(
         mDBConnection,
         &mCommunicatorMessagesQueueHandler,
+        &mUUID2AddressCacheHandler,
         mLog);
 }
 
@@ -70,9 +72,85 @@ CommunicatorIOTransaction::Unique CommunicatorStorageHandler::beginTransactionUn
     return make_unique<CommunicatorIOTransaction>(
         mDBConnection,
         &mCommunicatorMessagesQueueHandler,
+        &mUUID2AddressCacheHandler,
         mLog);
 }
 
+void CommunicatorStorageHandler::journalMessageSaving(
+    const NodeUUID &contractorUUID,
+    const TransactionUUID &transactionUUID,
+    const Message::SerializedType messageType,
+    BytesShared message,
+    size_t messageBytesCount)
+{
+    mJournal.push_back(
+        [contractorUUID, transactionUUID, messageType, message, messageBytesCount]
+        (CommunicatorMessagesQueueHandler *handler) {
+            handler->saveRecord(
+                contractorUUID,
+                transactionUUID,
+                messageType,
+                message,
+                messageBytesCount);
+        });
+}
+
+void CommunicatorStorageHandler::journalMessageRemoving(
+    const NodeUUID &contractorUUID,
+    const Message::SerializedType messageType)
+{
+    mJournal.push_back(
+        [contractorUUID, messageType] (CommunicatorMessagesQueueHandler *handler) {
+            handler->deleteRecord(
+                contractorUUID,
+                messageType);
+        });
+}
+
+void CommunicatorStorageHandler::journalMessageRemoving(
+    const NodeUUID &contractorUUID,
+    const TransactionUUID &transactionUUID)
+{
+    mJournal.push_back(
+        [contractorUUID, transactionUUID] (CommunicatorMessagesQueueHandler *handler) {
+            handler->deleteRecord(
+                contractorUUID,
+                transactionUUID);
+        });
+}
+
+void CommunicatorStorageHandler::flushJournal()
+{
+    if (mJournal.empty()) {
+        return;
+    }
+
+    // Journal is taken only after the transaction is started,
+    // so it is kept untouched in case if the transaction can't be started.
+    auto ioTransaction = beginTransactionUnique();
+    vector<function<void(CommunicatorMessagesQueueHandler*)>> journal;
+    journal.swap(mJournal);
+
+    try {
+        for (const auto &change : journal) {
+            change(ioTransaction->communicatorMessagesQueueHandler());
+        }
+        ioTransaction->commit();
+
+    } catch (IOError &) {
+        // Journal is restored before the rollback, which might fail too.
+        // Changes, that was journaled during the flushing, must follow the unflushed ones.
+        journal.insert(
+            journal.end(),
+            make_move_iterator(mJournal.begin()),
+            make_move_iterator(mJournal.end()));
+        mJournal.swap(journal);
+
+        ioTransaction->rollback();
+        throw;
+    }
+}
+
 LoggerStream CommunicatorStorageHandler::info() const
 {
     return mLog.info(logHeader());
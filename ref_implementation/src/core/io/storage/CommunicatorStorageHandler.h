@@ -12,12 +12,14 @@
 
 #include "../../logger/Logger.h"
 #include "CommunicatorMessagesQueueHandler.h"
+#include "UUID2AddressCacheHandler.h"
 #include "CommunicatorIOTransaction.h"
 #include "../../common/exceptions/IOError.h"
 #include "../../../libs/sqlite3/sqlite3.h"
 
 #include <boost/filesystem.hpp>
 #include <vector>
+#include <functional>
 
 namespace fs = boost::filesystem;
 
@@ -35,6 +37,36 @@ public:
 
     CommunicatorIOTransaction::Unique beginTransactionUnique();
 
+    /**
+     * Write-behind journal of the confirmation required messages queue.
+     * Changes are accumulated in memory and are written by the "flushJournal()" all at once,
+     * in one transaction (so, only one fsync is performed for the whole group of the changes).
+     * Changes are applied in order of their journaling.
+     */
+    void journalMessageSaving(
+        const NodeUUID &contractorUUID,
+        const TransactionUUID &transactionUUID,
+        const Message::SerializedType messageType,
+        BytesShared message,
+        size_t messageBytesCount);
+
+    void journalMessageRemoving(
+        const NodeUUID &contractorUUID,
+        const Message::SerializedType messageType);
+
+    void journalMessageRemoving(
+        const NodeUUID &contractorUUID,
+        const TransactionUUID &transactionUUID);
+
+    /**
+     * Writes all journaled changes in one transaction.
+     * Journal is cleared only when the transaction is committed. In case of error
+     * the transaction is rolled back, and all the changes are kept for the next call.
+     *
+     * @throws IOError in case if changes can't be written.
+     */
+    void flushJournal();
+
 private:
     static void checkDirectory(
         const string &directory);
@@ -51,6 +83,7 @@ private:
 
 private:
     const string kMessagesQueueTableName = "communicator_messages_queue";
+    const string kUUID2AddressCacheTableName = "uuid2address_cache";
 
 private:
     static sqlite3 *mDBConnection;
@@ -58,8 +91,11 @@ private:
 private:
     Logger &mLog;
     CommunicatorMessagesQueueHandler mCommunicatorMessagesQueueHandler;
+    UUID2AddressCacheHandler mUUID2AddressCacheHandler;
     string mDirectory;
     string mDataBaseName;
+
+    vector<function<void(CommunicatorMessagesQueueHandler*)>> mJournal;
 };
 
 
@@ -918,7 +918,8 @@ pair<BytesShared, size_t> HistoryStorage::serializedTrustLineRecordBody(
     size_t recordBodySize = sizeof(TrustLineRecord::SerializedTrustLineOperationType) + NodeUUID::kBytesSize;
     if (trustLineRecord->trustLineOperationType() != TrustLineRecord::TrustLineOperationType::Closing &&
         trustLineRecord->trustLineOperationType() != TrustLineRecord::TrustLineOperationType::Rejecting) {
-        recordBodySize += kTrustLineAmountBytesCount;
+        recordBodySize += compactTrustLineAmountBytesCount(
+            trustLineRecord->amount());
     }
 
     BytesShared bytesBuffer = tryCalloc(
@@ -942,13 +943,9 @@ pair<BytesShared, size_t> HistoryStorage::serializedTrustLineRecordBody(
 
     if (trustLineRecord->trustLineOperationType() != TrustLineRecord::TrustLineOperationType::Closing &&
         trustLineRecord->trustLineOperationType() != TrustLineRecord::TrustLineOperationType::Rejecting) {
-        auto trustAmountBytes = trustLineAmountToBytes(
-            trustLineRecord->amount());
-
-        memcpy(
-            bytesBuffer.get() + bytesBufferOffset,
-            trustAmountBytes.data(),
-            kTrustLineAmountBytesCount);
+        trustLineAmountToCompactBytes(
+            trustLineRecord->amount(),
+            bytesBuffer.get() + bytesBufferOffset);
     }
     return make_pair(
         bytesBuffer,
@@ -960,8 +957,8 @@ pair<BytesShared, size_t> HistoryStorage::serializedPaymentRecordBody(
 {
     size_t recordBodySize = sizeof(PaymentRecord::SerializedPaymentOperationType)
            + NodeUUID::kBytesSize
-           + kTrustLineAmountBytesCount
-           + kTrustLineBalanceSerializeBytesCount;
+           + compactTrustLineAmountBytesCount(paymentRecord->amount())
+           + compactTrustLineBalanceBytesCount(paymentRecord->balanceAfterOperation());
 
     BytesShared bytesBuffer = tryCalloc(
         recordBodySize);
@@ -982,20 +979,13 @@ pair<BytesShared, size_t> HistoryStorage::serializedPaymentRecordBody(
         NodeUUID::kBytesSize);
     bytesBufferOffset += NodeUUID::kBytesSize;
 
-    auto trustAmountBytes = trustLineAmountToBytes(
-        paymentRecord->amount());
-    memcpy(
-        bytesBuffer.get() + bytesBufferOffset,
-        trustAmountBytes.data(),
-        kTrustLineAmountBytesCount);
-    bytesBufferOffset += kTrustLineAmountBytesCount;
+    auto amountBytesEnd = trustLineAmountToCompactBytes(
+        paymentRecord->amount(),
+        bytesBuffer.get() + bytesBufferOffset);
 
-    auto trustBalanceBytes = trustLineBalanceToBytes(
-        paymentRecord->balanceAfterOperation());
-    memcpy(
-        bytesBuffer.get() + bytesBufferOffset,
-        trustBalanceBytes.data(),
-        kTrustLineBalanceSerializeBytesCount);
+    trustLineBalanceToCompactBytes(
+        paymentRecord->balanceAfterOperation(),
+        amountBytesEnd);
 
     return make_pair(
         bytesBuffer,
@@ -1006,7 +996,7 @@ pair<BytesShared, size_t> HistoryStorage::serializedPaymentAdditionalRecordBody(
         PaymentRecord::Shared paymentRecord)
 {
     size_t recordBodySize = sizeof(PaymentRecord::SerializedPaymentOperationType)
-                + kTrustLineAmountBytesCount;
+                + compactTrustLineAmountBytesCount(paymentRecord->amount());
 
     BytesShared bytesBuffer = tryCalloc(
         recordBodySize);
@@ -1021,12 +1011,9 @@ pair<BytesShared, size_t> HistoryStorage::serializedPaymentAdditionalRecordBody(
     bytesBufferOffset += sizeof(
             PaymentRecord::SerializedPaymentOperationType);
 
-    auto trustAmountBytes = trustLineAmountToBytes(
-        paymentRecord->amount());
-    memcpy(
-        bytesBuffer.get() + bytesBufferOffset,
-        trustAmountBytes.data(),
-        kTrustLineAmountBytesCount);
+    trustLineAmountToCompactBytes(
+        paymentRecord->amount(),
+        bytesBuffer.get() + bytesBufferOffset);
 
     return make_pair(
         bytesBuffer,
@@ -1057,12 +1044,8 @@ TrustLineRecord::Shared HistoryStorage::deserializeTrustLineRecord(
     TrustLineAmount amount(0);
     if (*operationType != TrustLineRecord::TrustLineOperationType::Closing &&
         *operationType != TrustLineRecord::TrustLineOperationType::Rejecting) {
-        vector<byte> amountBytes(
-            recordBody.get() + dataBufferOffset,
-            recordBody.get() + dataBufferOffset + kTrustLineAmountBytesCount);
-
-        amount = bytesToTrustLineAmount(
-            amountBytes);
+        amount = compactBytesToTrustLineAmount(
+            recordBody.get() + dataBufferOffset);
     }
     return make_shared<TrustLineRecord>(
         operationUUID,
@@ -1093,18 +1076,13 @@ PaymentRecord::Shared HistoryStorage::deserializePaymentRecord(
     NodeUUID contractorUUID(recordBody.get() + dataBufferOffset);
     dataBufferOffset += NodeUUID::kBytesSize;
 
-    vector<byte> amountBytes(
-        recordBody.get() + dataBufferOffset,
-        recordBody.get() + dataBufferOffset + kTrustLineAmountBytesCount);
-    TrustLineAmount amount = bytesToTrustLineAmount(
-        amountBytes);
-    dataBufferOffset += kTrustLineAmountBytesCount;
+    TrustLineAmount amount = compactBytesToTrustLineAmount(
+        recordBody.get() + dataBufferOffset);
+    dataBufferOffset += compactBytesCount(
+        recordBody.get() + dataBufferOffset);
 
-    vector<byte> balanceBytes(
-        recordBody.get() + dataBufferOffset,
-        recordBody.get() + dataBufferOffset + kTrustLineBalanceSerializeBytesCount);
-    TrustLineBalance balanceAfterOperation = bytesToTrustLineBalance(
-        balanceBytes);
+    TrustLineBalance balanceAfterOperation = compactBytesToTrustLineBalance(
+        recordBody.get() + dataBufferOffset);
 
     return make_shared<PaymentRecord>(
         operationUUID,
@@ -1133,11 +1111,8 @@ PaymentRecord::Shared HistoryStorage::deserializePaymentAdditionalRecord(
     dataBufferOffset += sizeof(
         PaymentRecord::SerializedPaymentOperationType);
 
-    vector<byte> amountBytes(
-        recordBody.get() + dataBufferOffset,
-        recordBody.get() + dataBufferOffset + kTrustLineAmountBytesCount);
-    TrustLineAmount amount = bytesToTrustLineAmount(
-            amountBytes);
+    TrustLineAmount amount = compactBytesToTrustLineAmount(
+        recordBody.get() + dataBufferOffset);
 
     return make_shared<PaymentRecord>(
         operationUUID,
@@ -1146,6 +1121,113 @@ PaymentRecord::Shared HistoryStorage::deserializePaymentAdditionalRecord(
         timestamp);
 }
 
+void HistoryStorage::convertAmountsToCompactFormat()
+{
+    // Bodies of the trust line records and of the main payment records begins with the operation type
+    // and the contractor UUID, bodies of the additional payment records - with the operation type only.
+    convertRecordsBodiesToCompactFormat(
+        mMainTableName,
+        sizeof(TrustLineRecord::SerializedTrustLineOperationType) + NodeUUID::kBytesSize);
+    convertRecordsBodiesToCompactFormat(
+        mAdditionalTableName,
+        sizeof(PaymentRecord::SerializedPaymentOperationType));
+}
+
+/**
+ * In the previous format, amount (if present) was written as kTrustLineAmountBytesCount bytes
+ * and balance (if present) - as kTrustLineBalanceSerializeBytesCount bytes, right after the header of the record body.
+ * So the presence of the amount and of the balance is detected by the size of the record body.
+ */
+void HistoryStorage::convertRecordsBodiesToCompactFormat(
+    const string &tableName,
+    size_t recordBodyHeaderBytesCount)
+{
+    string query = "SELECT rowid, record_body, record_body_bytes_count FROM " + tableName;
+    sqlite3_stmt *stmt;
+    int rc = sqlite3_prepare_v2(mDataBase, query.c_str(), -1, &stmt, 0);
+    if (rc != SQLITE_OK) {
+        throw IOError("HistoryStorage::convertRecordsBodiesToCompactFormat: "
+                          "Bad query; sqlite error: " + to_string(rc));
+    }
+
+    vector<pair<sqlite3_int64, vector<byte>>> convertedRecordsBodies;
+    while (sqlite3_step(stmt) == SQLITE_ROW) {
+        auto recordBody = (const byte*)sqlite3_column_blob(stmt, 1);
+        auto recordBodyBytesCount = (size_t)sqlite3_column_int(stmt, 2);
+        if (recordBodyBytesCount < recordBodyHeaderBytesCount) {
+            continue;
+        }
+
+        vector<byte> convertedRecordBody(
+            recordBody,
+            recordBody + recordBodyHeaderBytesCount);
+        size_t dataBufferOffset = recordBodyHeaderBytesCount;
+
+        if (recordBodyBytesCount >= dataBufferOffset + kTrustLineAmountBytesCount) {
+            vector<byte> amountBytes(
+                recordBody + dataBufferOffset,
+                recordBody + dataBufferOffset + kTrustLineAmountBytesCount);
+            auto compactAmountBytes = trustLineAmountToCompactBytes(
+                bytesToTrustLineAmount(amountBytes));
+            convertedRecordBody.insert(
+                convertedRecordBody.end(),
+                compactAmountBytes.begin(),
+                compactAmountBytes.end());
+            dataBufferOffset += kTrustLineAmountBytesCount;
+        }
+
+        if (recordBodyBytesCount >= dataBufferOffset + kTrustLineBalanceSerializeBytesCount) {
+            vector<byte> balanceBytes(
+                recordBody + dataBufferOffset,
+                recordBody + dataBufferOffset + kTrustLineBalanceSerializeBytesCount);
+            auto compactBalanceBytes = trustLineBalanceToCompactBytes(
+                bytesToTrustLineBalance(balanceBytes));
+            convertedRecordBody.insert(
+                convertedRecordBody.end(),
+                compactBalanceBytes.begin(),
+                compactBalanceBytes.end());
+        }
+
+        convertedRecordsBodies.push_back(
+            make_pair(
+                sqlite3_column_int64(stmt, 0),
+                convertedRecordBody));
+    }
+    sqlite3_reset(stmt);
+    sqlite3_finalize(stmt);
+
+    query = "UPDATE " + tableName + " SET record_body = ?, record_body_bytes_count = ? WHERE rowid = ?;";
+    for (const auto &recordBody : convertedRecordsBodies) {
+        rc = sqlite3_prepare_v2(mDataBase, query.c_str(), -1, &stmt, 0);
+        if (rc != SQLITE_OK) {
+            throw IOError("HistoryStorage::convertRecordsBodiesToCompactFormat: "
+                              "Bad update query; sqlite error: " + to_string(rc));
+        }
+        rc = sqlite3_bind_blob(stmt, 1, recordBody.second.data(), (int)recordBody.second.size(), SQLITE_STATIC);
+        if (rc != SQLITE_OK) {
+            throw IOError("HistoryStorage::convertRecordsBodiesToCompactFormat: "
+                              "Bad binding of RecordBody; sqlite error: " + to_string(rc));
+        }
+        rc = sqlite3_bind_int(stmt, 2, (int)recordBody.second.size());
+        if (rc != SQLITE_OK) {
+            throw IOError("HistoryStorage::convertRecordsBodiesToCompactFormat: "
+                              "Bad binding of RecordBody bytes count; sqlite error: " + to_string(rc));
+        }
+        rc = sqlite3_bind_int64(stmt, 3, recordBody.first);
+        if (rc != SQLITE_OK) {
+            throw IOError("HistoryStorage::convertRecordsBodiesToCompactFormat: "
+                              "Bad binding of RowID; sqlite error: " + to_string(rc));
+        }
+        rc = sqlite3_step(stmt);
+        sqlite3_reset(stmt);
+        sqlite3_finalize(stmt);
+        if (rc != SQLITE_DONE) {
+            throw IOError("HistoryStorage::convertRecordsBodiesToCompactFormat: "
+                              "Run query; sqlite error: " + to_string(rc));
+        }
+    }
+}
+
 LoggerStream HistoryStorage::info() const
 {
     return mLog.info(logHeader());
@@ -97,6 +97,13 @@ public:
     const string mainTableName() const;
     const string additionalTableName() const;
 
+    /**
+     * Rewrites amounts and balances of all the records from the fixed length format
+     * into the compact one (see trustLineAmountToCompactBytes()).
+     * Must be called only once, on the storage, that was created before the compact format was introduced.
+     */
+    void convertAmountsToCompactFormat();
+
 private:
     void savePaymentMainOutgoingRecord(
         PaymentRecord::Shared record);
@@ -141,6 +148,10 @@ private:
     PaymentRecord::Shared deserializePaymentAdditionalRecord(
         sqlite3_stmt *stmt);
 
+    void convertRecordsBodiesToCompactFormat(
+        const string &tableName,
+        size_t recordBodyHeaderBytesCount);
+
     LoggerStream info() const;
 
     LoggerStream debug() const;
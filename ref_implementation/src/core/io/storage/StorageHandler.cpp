@@ -27,6 +27,7 @@ StorageHandler::StorageHandler(
     mLog(logger)
 {
     sqlite3_config(SQLITE_CONFIG_SINGLETHREAD);
+    migrateStorage();
 }
 
 StorageHandler::~StorageHandler()
@@ -62,6 +63,68 @@ sqlite3* StorageHandler::connection(
     return mDBConnection;
 }
 
+/**
+ * Version of the storage format is kept in the "user_version" field of the database header.
+ * New (empty) databases are migrated as well, so their version is set to the current one.
+ */
+void StorageHandler::migrateStorage()
+{
+    if (storageVersion() >= kCompactAmountsStorageVersion) {
+        return;
+    }
+
+    info() << "Converting amounts and balances into the compact format";
+    auto ioTransaction = beginTransaction();
+    try {
+        ioTransaction->trustLinesHandler()->convertAmountsToCompactFormat();
+        ioTransaction->historyStorage()->convertAmountsToCompactFormat();
+        setStorageVersion(kCompactAmountsStorageVersion);
+
+    } catch (exception &e) {
+        ioTransaction->rollback();
+        error() << "Can't convert amounts into the compact format: " << e.what();
+        throw;
+    }
+}
+
+int StorageHandler::storageVersion()
+{
+    string query = "PRAGMA user_version;";
+    sqlite3_stmt *stmt;
+    int rc = sqlite3_prepare_v2(mDBConnection, query.c_str(), -1, &stmt, 0);
+    if (rc != SQLITE_OK) {
+        throw IOError("StorageHandler::storageVersion: "
+                          "Bad query; sqlite error: " + to_string(rc));
+    }
+    int version = 0;
+    if (sqlite3_step(stmt) == SQLITE_ROW) {
+        version = sqlite3_column_int(stmt, 0);
+    }
+    sqlite3_reset(stmt);
+    sqlite3_finalize(stmt);
+    return version;
+}
+
+void StorageHandler::setStorageVersion(
+    int version)
+{
+    // Pragma values can't be bound, so the version is written into the query itself.
+    string query = "PRAGMA user_version = " + to_string(version) + ";";
+    sqlite3_stmt *stmt;
+    int rc = sqlite3_prepare_v2(mDBConnection, query.c_str(), -1, &stmt, 0);
+    if (rc != SQLITE_OK) {
+        throw IOError("StorageHandler::setStorageVersion: "
+                          "Bad query; sqlite error: " + to_string(rc));
+    }
+    rc = sqlite3_step(stmt);
+    sqlite3_reset(stmt);
+    sqlite3_finalize(stmt);
+    if (rc != SQLITE_DONE) {
+        throw IOError("StorageHandler::setStorageVersion: "
+                          "Run query; sqlite error: " + to_string(rc));
+    }
+}
+
 IOTransaction::Shared StorageHandler::beginTransaction()
 {
     return make_shared<IOTransaction>(
@@ -46,6 +46,13 @@ private:
         const string &dataBaseName,
         const string &directory);
 
+    void migrateStorage();
+
+    int storageVersion();
+
+    void setStorageVersion(
+        int version);
+
     LoggerStream info() const;
 
     LoggerStream warning() const;
@@ -63,6 +70,9 @@ private:
     const string kNodeFeaturesTableName = "node_features";
     const string kBlackListTableName = "blacklist";
 
+    // Amounts and balances are stored in the compact (variable length) format since this version.
+    static const int kCompactAmountsStorageVersion = 1;
+
 private:
     static sqlite3 *mDBConnection;
 
@@ -78,23 +78,12 @@ vector<TrustLine::Shared> TrustLineHandler::allTrustLines ()
     while (sqlite3_step(stmt) == SQLITE_ROW ) {
         NodeUUID contractor((uint8_t*)sqlite3_column_blob(stmt, 0));
 
-        byte* incomingAmountBytes = (byte*)sqlite3_column_blob(stmt, 1);
-        vector<byte> incomingAmountBufferBytes(
-            incomingAmountBytes,
-            incomingAmountBytes + kTrustLineAmountBytesCount);
-        TrustLineAmount incomingAmount = bytesToTrustLineAmount(incomingAmountBufferBytes);
-
-        byte* outgoingAmountBytes = (byte*)sqlite3_column_blob(stmt, 2);
-        vector<byte> outgoingAmountBufferBytes(
-            outgoingAmountBytes,
-            outgoingAmountBytes + kTrustLineAmountBytesCount);
-        TrustLineAmount outgoingAmount = bytesToTrustLineAmount(outgoingAmountBufferBytes);
-
-        byte* balanceBytes = (byte*)sqlite3_column_blob(stmt, 3);
-        vector<byte> balanceBufferBytes(
-                balanceBytes,
-                balanceBytes + kTrustLineBalanceSerializeBytesCount);
-        TrustLineBalance balance = bytesToTrustLineBalance(balanceBufferBytes);
+        TrustLineAmount incomingAmount = compactBytesToTrustLineAmount(
+            (byte*)sqlite3_column_blob(stmt, 1));
+        TrustLineAmount outgoingAmount = compactBytesToTrustLineAmount(
+            (byte*)sqlite3_column_blob(stmt, 2));
+        TrustLineBalance balance = compactBytesToTrustLineBalance(
+            (byte*)sqlite3_column_blob(stmt, 3));
 
         int32_t isContractorGateway = sqlite3_column_int(stmt, 4);
 
@@ -179,20 +168,20 @@ void TrustLineHandler::saveTrustLine(
         throw IOError("TrustLineHandler::insert or replace: "
                           "Bad binding of Contractor; sqlite error: " + to_string(rc));
     }
-    vector<byte> incomingAmountBufferBytes = trustLineAmountToBytes(trustLine->incomingTrustAmount());
-    rc = sqlite3_bind_blob(stmt, 2, incomingAmountBufferBytes.data(), kTrustLineAmountBytesCount, SQLITE_STATIC);
+    vector<byte> incomingAmountBufferBytes = trustLineAmountToCompactBytes(trustLine->incomingTrustAmount());
+    rc = sqlite3_bind_blob(stmt, 2, incomingAmountBufferBytes.data(), (int)incomingAmountBufferBytes.size(), SQLITE_STATIC);
     if (rc != SQLITE_OK) {
         throw IOError("TrustLineHandler::insert or replace: "
                           "Bad binding of Incoming Amount; sqlite error: " + to_string(rc));
     }
-    vector<byte> outgoingAmountBufferBytes = trustLineAmountToBytes(trustLine->outgoingTrustAmount());
-    rc = sqlite3_bind_blob(stmt, 3, outgoingAmountBufferBytes.data(), kTrustLineAmountBytesCount, SQLITE_STATIC);
+    vector<byte> outgoingAmountBufferBytes = trustLineAmountToCompactBytes(trustLine->outgoingTrustAmount());
+    rc = sqlite3_bind_blob(stmt, 3, outgoingAmountBufferBytes.data(), (int)outgoingAmountBufferBytes.size(), SQLITE_STATIC);
     if (rc != SQLITE_OK) {
         throw IOError("TrustLineHandler::insert or replace: "
                           "Bad binding of Outgoing Amount; sqlite error: " + to_string(rc));
     }
-    vector<byte> balanceBufferBytes = trustLineBalanceToBytes(const_cast<TrustLineBalance&>(trustLine->balance()));
-    rc = sqlite3_bind_blob(stmt, 4, balanceBufferBytes.data(), kTrustLineBalanceSerializeBytesCount, SQLITE_STATIC);
+    vector<byte> balanceBufferBytes = trustLineBalanceToCompactBytes(trustLine->balance());
+    rc = sqlite3_bind_blob(stmt, 4, balanceBufferBytes.data(), (int)balanceBufferBytes.size(), SQLITE_STATIC);
     if (rc != SQLITE_OK) {
         throw IOError("TrustLineHandler::insert or replace: "
                           "Bad binding of Balance; sqlite error: " + to_string(rc));
@@ -217,6 +206,58 @@ void TrustLineHandler::saveTrustLine(
     }
 }
 
+/**
+ * In the previous format amounts was written as kTrustLineAmountBytesCount bytes,
+ * and balance - as kTrustLineBalanceSerializeBytesCount bytes.
+ * Trust lines are read in this format and are saved once more (in the compact one).
+ */
+void TrustLineHandler::convertAmountsToCompactFormat()
+{
+    string query = "SELECT contractor, incoming_amount, outgoing_amount, balance, is_contractor_gateway FROM " + mTableName;
+    sqlite3_stmt *stmt;
+    int rc = sqlite3_prepare_v2( mDataBase, query.c_str(), -1, &stmt, 0);
+    if (rc != SQLITE_OK) {
+        throw IOError("TrustLineHandler::convertAmountsToCompactFormat: "
+                          "Bad query; sqlite error: " + to_string(rc));
+    }
+
+    vector<TrustLine::Shared> trustLines;
+    while (sqlite3_step(stmt) == SQLITE_ROW ) {
+        NodeUUID contractor((uint8_t*)sqlite3_column_blob(stmt, 0));
+
+        byte* incomingAmountBytes = (byte*)sqlite3_column_blob(stmt, 1);
+        vector<byte> incomingAmountBufferBytes(
+            incomingAmountBytes,
+            incomingAmountBytes + kTrustLineAmountBytesCount);
+
+        byte* outgoingAmountBytes = (byte*)sqlite3_column_blob(stmt, 2);
+        vector<byte> outgoingAmountBufferBytes(
+            outgoingAmountBytes,
+            outgoingAmountBytes + kTrustLineAmountBytesCount);
+
+        byte* balanceBytes = (byte*)sqlite3_column_blob(stmt, 3);
+        vector<byte> balanceBufferBytes(
+            balanceBytes,
+            balanceBytes + kTrustLineBalanceSerializeBytesCount);
+
+        int32_t isContractorGateway = sqlite3_column_int(stmt, 4);
+
+        trustLines.push_back(
+            make_shared<TrustLine>(
+                contractor,
+                bytesToTrustLineAmount(incomingAmountBufferBytes),
+                bytesToTrustLineAmount(outgoingAmountBufferBytes),
+                bytesToTrustLineBalance(balanceBufferBytes),
+                isContractorGateway != 0));
+    }
+    sqlite3_reset(stmt);
+    sqlite3_finalize(stmt);
+
+    for (const auto &trustLine : trustLines) {
+        saveTrustLine(trustLine);
+    }
+}
+
 LoggerStream TrustLineHandler::info() const
 {
     return mLog.info(logHeader());
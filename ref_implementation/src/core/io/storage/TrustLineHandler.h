@@ -38,6 +38,13 @@ public:
 
     const string &tableName() const;
 
+    /**
+     * Rewrites amounts and balances of all the trust lines from the fixed length format
+     * into the compact one (see trustLineAmountToCompactBytes()).
+     * Must be called only once, on the storage, that was created before the compact format was introduced.
+     */
+    void convertAmountsToCompactFormat();
+
 private:
     bool containsContractor(const NodeUUID &contractorUUID);
 
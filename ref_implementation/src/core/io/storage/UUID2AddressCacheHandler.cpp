@@ -0,0 +1,164 @@
+/**
+ * This file is part of GEO Project.
+ * It is subject to the license terms in the LICENSE.md file found in the top-level directory
+ * of this distribution and at https://github.com/GEO-Project/GEO-Project/blob/master/LICENSE.md
+ *
+ * No part of GEO Project, including this file, may be copied, modified, propagated, or distributed
+ * except according to the terms contained in the LICENSE.md file.
+ */
+
+#include "UUID2AddressCacheHandler.h"
+
+UUID2AddressCacheHandler::UUID2AddressCacheHandler(
+    sqlite3 *dbConnection,
+    const string &tableName,
+    Logger &logger):
+
+    mDataBase(dbConnection),
+    mTableName(tableName),
+    mLog(logger)
+{
+    string query = "CREATE TABLE IF NOT EXISTS " + mTableName +
+                   " (contractor_uuid BLOB NOT NULL PRIMARY KEY, "
+                       "ip_address TEXT NOT NULL, "
+                       "port INT NOT NULL, "
+                       "expires_at INT NOT NULL);";
+    sqlite3_stmt *stmt;
+    int rc = sqlite3_prepare_v2(mDataBase, query.c_str(), -1, &stmt, 0);
+    if (rc != SQLITE_OK) {
+        throw IOError("UUID2AddressCacheHandler::creating table: "
+                          "Bad query; sqlite error: " + to_string(rc));
+    }
+    rc = sqlite3_step(stmt);
+    if (rc == SQLITE_DONE) {
+    } else {
+        throw IOError("UUID2AddressCacheHandler::creating table: "
+                          "Run query; sqlite error: " + to_string(rc));
+    }
+    sqlite3_reset(stmt);
+    sqlite3_finalize(stmt);
+}
+
+/**
+ * Inserts the record of the node, or replaces the previous one.
+ * Empty "address" means, that the node was not found by the UUID2Address service.
+ */
+void UUID2AddressCacheHandler::saveRecord(
+    const NodeUUID &contractorUUID,
+    const string &address,
+    const uint16_t port,
+    const GEOEpochTimestamp expiresAt)
+{
+    string query = "INSERT OR REPLACE INTO " + mTableName +
+                   " (contractor_uuid, ip_address, port, expires_at) "
+                       "VALUES(?, ?, ?, ?);";
+    sqlite3_stmt *stmt;
+    int rc = sqlite3_prepare_v2(mDataBase, query.c_str(), -1, &stmt, 0);
+    if (rc != SQLITE_OK) {
+        throw IOError("UUID2AddressCacheHandler::insert: "
+                          "Bad query; sqlite error: " + to_string(rc));
+    }
+    rc = sqlite3_bind_blob(stmt, 1, contractorUUID.data, NodeUUID::kBytesSize, SQLITE_STATIC);
+    if (rc != SQLITE_OK) {
+        throw IOError("UUID2AddressCacheHandler::insert: "
+                          "Bad binding of ContractorUUID; sqlite error: " + to_string(rc));
+    }
+    rc = sqlite3_bind_text(stmt, 2, address.c_str(), (int)address.size(), SQLITE_STATIC);
+    if (rc != SQLITE_OK) {
+        throw IOError("UUID2AddressCacheHandler::insert: "
+                          "Bad binding of IP address; sqlite error: " + to_string(rc));
+    }
+    rc = sqlite3_bind_int(stmt, 3, (int)port);
+    if (rc != SQLITE_OK) {
+        throw IOError("UUID2AddressCacheHandler::insert: "
+                          "Bad binding of Port; sqlite error: " + to_string(rc));
+    }
+    rc = sqlite3_bind_int64(stmt, 4, expiresAt);
+    if (rc != SQLITE_OK) {
+        throw IOError("UUID2AddressCacheHandler::insert: "
+                          "Bad binding of Expiration timestamp; sqlite error: " + to_string(rc));
+    }
+    rc = sqlite3_step(stmt);
+    sqlite3_reset(stmt);
+    sqlite3_finalize(stmt);
+    if (rc == SQLITE_DONE) {
+#ifdef STORAGE_HANDLER_DEBUG_LOG
+        info() << "inserting is completed successfully";
+#endif
+    } else {
+        throw IOError("UUID2AddressCacheHandler::insert: "
+                          "Run query; sqlite error: " + to_string(rc));
+    }
+}
+
+/**
+ * Removes expired records of the nodes, that was not found by the UUID2Address service.
+ * Expired endpoints are kept: they are used in case if the service would be unreachable.
+ */
+void UUID2AddressCacheHandler::deleteExpiredNotFoundRecords(
+    const GEOEpochTimestamp now)
+{
+    string query = "DELETE FROM " + mTableName + " WHERE ip_address = '' AND expires_at <= ?;";
+    sqlite3_stmt *stmt;
+    int rc = sqlite3_prepare_v2(mDataBase, query.c_str(), -1, &stmt, 0);
+    if (rc != SQLITE_OK) {
+        throw IOError("UUID2AddressCacheHandler::deleteExpiredNotFoundRecords: "
+                          "Bad query; sqlite error: " + to_string(rc));
+    }
+    rc = sqlite3_bind_int64(stmt, 1, now);
+    if (rc != SQLITE_OK) {
+        throw IOError("UUID2AddressCacheHandler::deleteExpiredNotFoundRecords: "
+                          "Bad binding of Timestamp; sqlite error: " + to_string(rc));
+    }
+    rc = sqlite3_step(stmt);
+    sqlite3_reset(stmt);
+    sqlite3_finalize(stmt);
+    if (rc == SQLITE_DONE) {
+#ifdef STORAGE_HANDLER_DEBUG_LOG
+        info() << "deleting is completed successfully";
+#endif
+    } else {
+        throw IOError("UUID2AddressCacheHandler::deleteExpiredNotFoundRecords: "
+                          "Run query; sqlite error: " + to_string(rc));
+    }
+}
+
+vector<UUID2AddressCacheHandler::Record> UUID2AddressCacheHandler::allRecords()
+{
+    vector<Record> result;
+    string query = "SELECT contractor_uuid, ip_address, port, expires_at FROM "
+                   + mTableName + ";";
+    sqlite3_stmt *stmt;
+    int rc = sqlite3_prepare_v2(mDataBase, query.c_str(), -1, &stmt, 0);
+    if (rc != SQLITE_OK) {
+        throw IOError("UUID2AddressCacheHandler::allRecords: "
+                          "Bad query; sqlite error: " + to_string(rc));
+    }
+    while (sqlite3_step(stmt) == SQLITE_ROW) {
+        NodeUUID contractorUUID((uint8_t *)sqlite3_column_blob(stmt, 0));
+        string address((const char *)sqlite3_column_text(stmt, 1));
+        auto port = (uint16_t)sqlite3_column_int(stmt, 2);
+        GEOEpochTimestamp expiresAt = sqlite3_column_int64(stmt, 3);
+
+        result.emplace_back(
+            contractorUUID,
+            address,
+            port,
+            expiresAt);
+    }
+    sqlite3_reset(stmt);
+    sqlite3_finalize(stmt);
+    return result;
+}
+
+LoggerStream UUID2AddressCacheHandler::info() const
+{
+    return mLog.info(logHeader());
+}
+
+const string UUID2AddressCacheHandler::logHeader() const
+{
+    stringstream s;
+    s << "[UUID2AddressCacheHandler]";
+    return s.str();
+}
@@ -0,0 +1,64 @@
+/**
+ * This file is part of GEO Project.
+ * It is subject to the license terms in the LICENSE.md file found in the top-level directory
+ * of this distribution and at https://github.com/GEO-Project/GEO-Project/blob/master/LICENSE.md
+ *
+ * No part of GEO Project, including this file, may be copied, modified, propagated, or distributed
+ * except according to the terms contained in the LICENSE.md file.
+ */
+
+#ifndef GEO_NETWORK_CLIENT_UUID2ADDRESSCACHEHANDLER_H
+#define GEO_NETWORK_CLIENT_UUID2ADDRESSCACHEHANDLER_H
+
+#include "../../logger/Logger.h"
+#include "../../common/Types.h"
+#include "../../common/NodeUUID.h"
+#include "../../common/time/TimeUtils.h"
+#include "../../common/exceptions/IOError.h"
+
+#include "../../../libs/sqlite3/sqlite3.h"
+
+#include <tuple>
+#include <vector>
+
+/**
+ * Persistent cache of the nodes endpoints, that was fetched from the UUID2Address service.
+ * Nodes, that was not found by the service, are stored too (with empty address),
+ * so they would not be requested again until their records expire.
+ */
+class UUID2AddressCacheHandler {
+
+public:
+    // contractor uuid, ip address (empty for not found nodes), port, expiration timestamp.
+    typedef tuple<NodeUUID, string, uint16_t, GEOEpochTimestamp> Record;
+
+public:
+    UUID2AddressCacheHandler(
+        sqlite3 *dbConnection,
+        const string &tableName,
+        Logger &logger);
+
+    void saveRecord(
+        const NodeUUID &contractorUUID,
+        const string &address,
+        const uint16_t port,
+        const GEOEpochTimestamp expiresAt);
+
+    void deleteExpiredNotFoundRecords(
+        const GEOEpochTimestamp now);
+
+    vector<Record> allRecords();
+
+private:
+    LoggerStream info() const;
+
+    const string logHeader() const;
+
+private:
+    sqlite3 *mDataBase = nullptr;
+    string mTableName;
+    Logger &mLog;
+};
+
+
+#endif //GEO_NETWORK_CLIENT_UUID2ADDRESSCACHEHANDLER_H
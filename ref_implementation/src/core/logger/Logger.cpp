@@ -156,6 +156,8 @@ void Logger::logRecord(
                  << subsystem << "\t"
                  << formatMessage(message) << endl;
 
+    lock_guard<mutex> lock(mRecordsMutex);
+
     // Logging to the console
     cout << recordStream.str();
 
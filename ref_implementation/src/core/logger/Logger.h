@@ -17,6 +17,7 @@
 #include <iostream>
 #include <sstream>
 #include <string>
+#include <mutex>
 
 
 using namespace std;
@@ -117,5 +118,8 @@ private:
     std::ofstream mOperationsLogFile;
     uint32_t mOperationsLogFileLinesNumber;
     string mOperationLogFileName;
+
+    // Records may be issued by the network workers threads too.
+    mutex mRecordsMutex;
 };
 #endif //GEO_NETWORK_CLIENT_LOGGER_H
\ No newline at end of file
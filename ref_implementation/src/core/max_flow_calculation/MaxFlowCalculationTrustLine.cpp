@@ -12,14 +12,15 @@
 MaxFlowCalculationTrustLine::MaxFlowCalculationTrustLine(
     const NodeUUID &sourceUUID,
     const NodeUUID &targetUUID,
-    ConstSharedTrustLineAmount amount):
+    const TrustLineAmount &amount):
 
     mSourceUUID(sourceUUID),
     mTargetUUID(targetUUID),
     mAmount(amount),
-    mUsedAmount(make_shared<TrustLineAmount>(0))
+    mFixedAmount(amount),
+    mUsedAmount(0)
 {
-    if (*amount.get() < TrustLine::kZeroAmount()) {
+    if (amount < TrustLine::kZeroAmount()) {
         throw ValueError("MaxFlowCalculationTrustLine::MaxFlowCalculationTrustLine: "
                              "Amount can't be negative value.");
     }
@@ -35,29 +36,38 @@ const NodeUUID& MaxFlowCalculationTrustLine::targetUUID() const
     return mTargetUUID;
 }
 
-ConstSharedTrustLineAmount MaxFlowCalculationTrustLine::amount() const
+const TrustLineAmount& MaxFlowCalculationTrustLine::amount() const
 {
     return mAmount;
 }
 
-ConstSharedTrustLineAmount MaxFlowCalculationTrustLine::freeAmount()
+TrustLineAmount MaxFlowCalculationTrustLine::freeAmount() const
 {
-    return ConstSharedTrustLineAmount(
-        new TrustLineAmount(
-            *mAmount.get() - *mUsedAmount.get()));
+    return freeFixedAmount().toTrustLineAmount();
+}
+
+FixedTrustLineAmount MaxFlowCalculationTrustLine::freeFixedAmount() const
+{
+    return mFixedAmount - mUsedAmount;
 }
 
 void MaxFlowCalculationTrustLine::addUsedAmount(const TrustLineAmount &amount)
 {
-    *mUsedAmount.get() = *mUsedAmount.get() + amount;
+    mUsedAmount += FixedTrustLineAmount(amount);
+}
+
+void MaxFlowCalculationTrustLine::addUsedAmount(const FixedTrustLineAmount &amount)
+{
+    mUsedAmount += amount;
 }
 
 void MaxFlowCalculationTrustLine::setUsedAmount(const TrustLineAmount &amount)
 {
-    *mUsedAmount.get() = amount;
+    mUsedAmount = FixedTrustLineAmount(amount);
 }
 
-void MaxFlowCalculationTrustLine::setAmount(ConstSharedTrustLineAmount amount)
+void MaxFlowCalculationTrustLine::setAmount(const TrustLineAmount &amount)
 {
     mAmount = amount;
+    mFixedAmount = FixedTrustLineAmount(amount);
 }
\ No newline at end of file
@@ -11,6 +11,7 @@
 #define GEO_NETWORK_CLIENT_MAXFLOWCALCULATIONTRUSTLINE_H
 
 #include "../common/Types.h"
+#include "../common/multiprecision/FixedTrustLineAmount.h"
 #include "../common/NodeUUID.h"
 #include "../trust_lines/TrustLine.h"
 #include "../common/time/TimeUtils.h"
@@ -25,27 +26,37 @@ public:
     MaxFlowCalculationTrustLine(
         const NodeUUID &sourceUUID,
         const NodeUUID &targetUUID,
-        ConstSharedTrustLineAmount amount);
+        const TrustLineAmount &amount);
 
     const NodeUUID& sourceUUID() const;
 
     const NodeUUID& targetUUID() const;
 
-    ConstSharedTrustLineAmount amount() const;
+    const TrustLineAmount& amount() const;
 
-    void setAmount(ConstSharedTrustLineAmount amount);
+    void setAmount(const TrustLineAmount &amount);
 
-    ConstSharedTrustLineAmount freeAmount();
+    TrustLineAmount freeAmount() const;
+
+    /**
+     * Same as freeAmount(), but is returned by value (without any allocations).
+     * Used by the max flow calculation and by the paths building loops.
+     */
+    FixedTrustLineAmount freeFixedAmount() const;
 
     void addUsedAmount(const TrustLineAmount &amount);
 
+    void addUsedAmount(const FixedTrustLineAmount &amount);
+
     void setUsedAmount(const TrustLineAmount &amount);
 
 private:
     NodeUUID mSourceUUID;
     NodeUUID mTargetUUID;
-    ConstSharedTrustLineAmount mAmount;
-    SharedTrustLineAmount mUsedAmount;
+    TrustLineAmount mAmount;
+    // Copy of the mAmount, that is used for the fast free amount calculation.
+    FixedTrustLineAmount mFixedAmount;
+    FixedTrustLineAmount mUsedAmount;
 };
 
 
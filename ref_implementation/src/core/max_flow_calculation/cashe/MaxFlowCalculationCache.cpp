@@ -10,8 +10,8 @@
 #include "MaxFlowCalculationCache.h"
 
 MaxFlowCalculationCache::MaxFlowCalculationCache(
-    const vector<pair<NodeUUID, ConstSharedTrustLineAmount>> &outgoingFlows,
-    const vector<pair<NodeUUID, ConstSharedTrustLineAmount>> &incomingFlows)
+    const vector<pair<NodeUUID, TrustLineAmount>> &outgoingFlows,
+    const vector<pair<NodeUUID, TrustLineAmount>> &incomingFlows)
 {
     for (auto &nodeUUIDAndFlow : outgoingFlows) {
         mOutgoingFlows.insert(nodeUUIDAndFlow);
@@ -24,12 +24,12 @@ MaxFlowCalculationCache::MaxFlowCalculationCache(
 // check if incoming flow already cached
 bool MaxFlowCalculationCache::containsIncomingFlow(
     const NodeUUID &nodeUUID,
-    ConstSharedTrustLineAmount flow)
+    const TrustLineAmount &flow)
 {
     auto nodeUUIDAndFlow = mIncomingFlows.find(nodeUUID);
     // if not present then insert
     if (nodeUUIDAndFlow == mIncomingFlows.end()) {
-        if (*flow == TrustLine::kZeroAmount()) {
+        if (flow == TrustLine::kZeroAmount()) {
             return true;
         } else {
             mIncomingFlows.insert(
@@ -39,19 +39,14 @@ bool MaxFlowCalculationCache::containsIncomingFlow(
             return false;
         }
     } else {
-        auto sharedFlow = (*nodeUUIDAndFlow).second;
         // if flow present but now it is zero, then delete
-        if (*flow.get() == TrustLine::kZeroAmount()) {
+        if (flow == TrustLine::kZeroAmount()) {
             mIncomingFlows.erase(nodeUUIDAndFlow);
             return false;
         }
         // if flow differs then update
-        if (*sharedFlow.get() != *flow.get()) {
-            mIncomingFlows.erase(nodeUUIDAndFlow);
-            mIncomingFlows.insert(
-                make_pair(
-                    nodeUUID,
-                    flow));
+        if (nodeUUIDAndFlow->second != flow) {
+            nodeUUIDAndFlow->second = flow;
             return false;
         }
     }
@@ -61,12 +56,12 @@ bool MaxFlowCalculationCache::containsIncomingFlow(
 // check if inoutgoing flow already cached
 bool MaxFlowCalculationCache::containsOutgoingFlow(
     const NodeUUID &nodeUUID,
-    const ConstSharedTrustLineAmount flow)
+    const TrustLineAmount &flow)
 {
     auto nodeUUIDAndFlow = mOutgoingFlows.find(nodeUUID);
     // if not present then insert
     if (nodeUUIDAndFlow == mOutgoingFlows.end()) {
-        if (*flow == TrustLine::kZeroAmount()) {
+        if (flow == TrustLine::kZeroAmount()) {
             return true;
         } else {
             mOutgoingFlows.insert(
@@ -76,19 +71,14 @@ bool MaxFlowCalculationCache::containsOutgoingFlow(
             return false;
         }
     } else {
-        auto sharedFlow = (*nodeUUIDAndFlow).second;
         // if flow present but now it is zero, then delete
-        if (*flow.get() == TrustLine::kZeroAmount()) {
+        if (flow == TrustLine::kZeroAmount()) {
             mOutgoingFlows.erase(nodeUUIDAndFlow);
             return false;
         }
         // if flow differs then update
-        if (*sharedFlow.get() != *flow.get()) {
-            mOutgoingFlows.erase(nodeUUIDAndFlow);
-            mOutgoingFlows.insert(
-                make_pair(
-                    nodeUUID,
-                    flow));
+        if (nodeUUIDAndFlow->second != flow) {
+            nodeUUIDAndFlow->second = flow;
             return false;
         }
     }
@@ -25,20 +25,20 @@ public:
     typedef shared_ptr<MaxFlowCalculationCache> Shared;
 
     MaxFlowCalculationCache(
-        const vector<pair<NodeUUID, ConstSharedTrustLineAmount>> &outgoingFlows,
-        const vector<pair<NodeUUID, ConstSharedTrustLineAmount>> &incomingFlows);
+        const vector<pair<NodeUUID, TrustLineAmount>> &outgoingFlows,
+        const vector<pair<NodeUUID, TrustLineAmount>> &incomingFlows);
 
     bool containsIncomingFlow(
         const NodeUUID &nodeUUID,
-        ConstSharedTrustLineAmount flow);
+        const TrustLineAmount &flow);
 
     bool containsOutgoingFlow(
         const NodeUUID &nodeUUID,
-        ConstSharedTrustLineAmount flow);
+        const TrustLineAmount &flow);
 
 private:
-    unordered_map<NodeUUID, ConstSharedTrustLineAmount, boost::hash<boost::uuids::uuid>> mIncomingFlows;
-    unordered_map<NodeUUID, ConstSharedTrustLineAmount, boost::hash<boost::uuids::uuid>> mOutgoingFlows;
+    unordered_map<NodeUUID, TrustLineAmount, boost::hash<boost::uuids::uuid>> mIncomingFlows;
+    unordered_map<NodeUUID, TrustLineAmount, boost::hash<boost::uuids::uuid>> mOutgoingFlows;
 };
 
 
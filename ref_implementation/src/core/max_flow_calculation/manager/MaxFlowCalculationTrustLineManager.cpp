@@ -26,7 +26,7 @@ void MaxFlowCalculationTrustLineManager::addTrustLine(
 {
     auto const &nodeUUIDAndSetFlows = msTrustLines.find(trustLine->sourceUUID());
     if (nodeUUIDAndSetFlows == msTrustLines.end()) {
-        if (*(trustLine->amount()) == TrustLine::kZeroAmount()) {
+        if (trustLine->amount() == TrustLine::kZeroAmount()) {
             return;
         }
         auto newHashSet = new unordered_set<MaxFlowCalculationTrustLineWithPtr*>();
@@ -55,7 +55,7 @@ void MaxFlowCalculationTrustLineManager::addTrustLine(
                 auto dateTimeAndTrustLine = mtTrustLines.begin();
                 while (dateTimeAndTrustLine != mtTrustLines.end()) {
                     if (dateTimeAndTrustLine->second == *trLineWithPtr) {
-                        if (*(*trLineWithPtr)->maxFlowCalculationtrustLine()->amount() != TrustLine::kZeroAmount()) {
+                        if ((*trLineWithPtr)->maxFlowCalculationtrustLine()->amount() != TrustLine::kZeroAmount()) {
                             mtTrustLines.erase(
                                 dateTimeAndTrustLine);
                             mtTrustLines.insert(
@@ -83,7 +83,7 @@ void MaxFlowCalculationTrustLineManager::addTrustLine(
             trLineWithPtr++;
         }
         if (trLineWithPtr == hashSet->end()) {
-            if (*trustLine->amount() == TrustLine::kZeroAmount()) {
+            if (trustLine->amount() == TrustLine::kZeroAmount()) {
                 return;
             }
             auto newTrustLineWithPtr = new MaxFlowCalculationTrustLineWithPtr(
@@ -150,7 +150,7 @@ void MaxFlowCalculationTrustLineManager::makeFullyUsed(
     for (auto &trustLinePtr : *nodeUUIDAndSetFlows->second) {
         if (trustLinePtr->maxFlowCalculationtrustLine()->targetUUID() == targetUUID) {
             trustLinePtr->maxFlowCalculationtrustLine()->setUsedAmount(
-                *trustLinePtr->maxFlowCalculationtrustLine()->amount().get());
+                trustLinePtr->maxFlowCalculationtrustLine()->amount());
             return;
         }
     }
@@ -208,8 +208,8 @@ void MaxFlowCalculationTrustLineManager::printTrustLines() const
         info() << "print\t" << "key: " << nodeUUIDAndTrustLines.first;
         for (auto &itTrustLine : *nodeUUIDAndTrustLines.second) {
             MaxFlowCalculationTrustLine::Shared trustLine = itTrustLine->maxFlowCalculationtrustLine();
-            info() << "print\t" << "value: " << trustLine->targetUUID() << " " << *trustLine->amount().get()
-                    << " free amount: " << *trustLine->freeAmount();
+            info() << "print\t" << "value: " << trustLine->targetUUID() << " " << trustLine->amount()
+                    << " free amount: " << trustLine->freeAmount();
         }
         trustLinesCnt += nodeUUIDAndTrustLines.second->size();
     }
@@ -271,7 +271,7 @@ void MaxFlowCalculationTrustLineManager::makeFullyUsedTLsFromGatewaysToAllNodesE
             }
             if (maxFlowTLTarget != exceptedNode) {
                 trustLinePtr->maxFlowCalculationtrustLine()->setUsedAmount(
-                        *trustLinePtr->maxFlowCalculationtrustLine()->amount().get());
+                        trustLinePtr->maxFlowCalculationtrustLine()->amount());
             }
         }
     }
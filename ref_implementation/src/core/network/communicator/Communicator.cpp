@@ -17,6 +17,7 @@ Communicator::Communicator(
     const Host &UUID2AddressHost,
     const Port UUID2AddressPort,
     const NodeUUID &nodeUUID,
+    const size_t networkWorkersCount,
     Logger &logger):
 
     mInterface(interface),
@@ -24,16 +25,26 @@ Communicator::Communicator(
     mIOService(IOService),
     mNodeUUID(nodeUUID),
     mLog(logger),
+    // In case if network workers are used - socket of the communicator
+    // shares the port with the sockets of the workers.
     mSocket(
-        make_unique<UDPSocket>(
-            IOService,
-            udp::endpoint(
-                udp::v4(),
-                port))),
+        networkWorkersCount > 0 ?
+            IncomingWorker::sharedPortSocket(
+                IOService,
+                port) :
+            make_unique<UDPSocket>(
+                IOService,
+                udp::endpoint(
+                    udp::v4(),
+                    port))),
 
+    // Communicator storage handler is declared (and so is created) before the UUID2Address service,
+    // so the service is able to load stored endpoints of the nodes.
     mUUID2AddressService(
         make_unique<UUID2Address>(
             IOService,
+            mCommunicatorStorageHandler.get(),
+            logger,
             UUID2AddressHost,
             UUID2AddressPort)),
 
@@ -70,11 +81,53 @@ Communicator::Communicator(
             this,
             _1));
 
+    mIncomingMessagesHandler->signalServicePacketReceived.connect(
+        boost::bind(
+            &OutgoingMessagesHandler::processServicePacket,
+            mOutgoingMessagesHandler.get(),
+            _1,
+            _2,
+            _3));
+
     mConfirmationRequiredMessagesHandler->signalOutgoingMessageReady.connect(
         boost::bind(
             &Communicator::onConfirmationRequiredMessageReadyToResend,
             this,
             _1));
+
+#ifndef LINUX
+    if (networkWorkersCount > 0) {
+        error() << "Network workers are supported only on Linux. "
+                << "All incoming messages would be processed in the main thread.";
+    }
+#endif
+
+#ifdef LINUX
+    for (size_t workerNumber = 0; workerNumber < networkWorkersCount; ++workerNumber) {
+        auto worker = make_unique<IncomingWorker>(
+            IOService,
+            port,
+            logger);
+
+        // Signals of the workers are emitted in the core thread,
+        // so they are chained exactly as the signals of the main incoming messages handler.
+        worker->signalMessageParsed.connect(
+            boost::bind(
+                &Communicator::onMessageReceived,
+                this,
+                _1));
+
+        worker->signalServicePacketReceived.connect(
+            boost::bind(
+                &OutgoingMessagesHandler::processServicePacket,
+                mOutgoingMessagesHandler.get(),
+                _1,
+                _2,
+                _3));
+
+        mIncomingWorkers.push_back(move(worker));
+    }
+#endif
 }
 
 /**
@@ -103,10 +156,24 @@ bool Communicator::joinUUID2Address(
     return false;
 }
 
+/**
+ * Warms up the endpoints cache, so the first messages to the nodes are not delayed by the lookups.
+ */
+void Communicator::prefetchEndpoints(
+    const vector<NodeUUID> &contractorsUUIDs)
+    noexcept
+{
+    mUUID2AddressService->prefetchEndpoints(contractorsUUIDs);
+}
+
 void Communicator::beginAcceptMessages()
     noexcept
 {
     mIncomingMessagesHandler->beginReceivingData();
+
+    for (auto &worker : mIncomingWorkers) {
+        worker->beginReceivingData();
+    }
 }
 
 /**
@@ -127,9 +194,12 @@ void Communicator::sendMessage (
     noexcept
 {
     // Filter outgoing messages for confirmation-required messages.
-    mConfirmationRequiredMessagesHandler->tryEnqueueMessage(
-        contractorUUID,
-        message);
+    // Such messages are sent by the handler, after they are written to the storage.
+    if (mConfirmationRequiredMessagesHandler->tryEnqueueMessage(
+            contractorUUID,
+            message)) {
+        return;
+    }
 
     mOutgoingMessagesHandler->sendMessage(
         message,
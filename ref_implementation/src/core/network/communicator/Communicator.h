@@ -15,6 +15,7 @@
 #include "internal/common/Types.h"
 #include "internal/outgoing/OutgoingMessagesHandler.h"
 #include "internal/incoming/IncomingMessagesHandler.h"
+#include "internal/incoming/IncomingWorker.h"
 #include "internal/queue/ConfirmationRequiredMessagesHandler.h"
 #include "../../io/storage/StorageHandler.h"
 #include "../../trust_lines/manager/TrustLinesManager.h"
@@ -40,6 +41,7 @@ public:
         const Host &uuid2AddressHost,
         const Port uuid2AddressPort,
         const NodeUUID &nodeUUID,
+        const size_t networkWorkersCount,
         Logger &logger)
         noexcept(false);
 
@@ -47,6 +49,10 @@ public:
         const NodeUUID &nodeUUID)
         noexcept;
 
+    void prefetchEndpoints(
+        const vector<NodeUUID> &contractorsUUIDs)
+        noexcept;
+
     void beginAcceptMessages()
         noexcept;
 
@@ -92,6 +98,10 @@ protected:
     unique_ptr<UDPSocket> mSocket;
     unique_ptr<UUID2Address> mUUID2AddressService;
     unique_ptr<IncomingMessagesHandler> mIncomingMessagesHandler;
+
+    // Additional receivers of the incoming messages, each one works in its own thread.
+    // Empty in case if network workers are not configured.
+    vector<unique_ptr<IncomingWorker>> mIncomingWorkers;
     unique_ptr<OutgoingMessagesHandler> mOutgoingMessagesHandler;
     unique_ptr<ConfirmationRequiredMessagesHandler> mConfirmationRequiredMessagesHandler;
 };
@@ -0,0 +1,169 @@
+/**
+ * This file is part of GEO Project.
+ * It is subject to the license terms in the LICENSE.md file found in the top-level directory
+ * of this distribution and at https://github.com/GEO-Project/GEO-Project/blob/master/LICENSE.md
+ *
+ * No part of GEO Project, including this file, may be copied, modified, propagated, or distributed
+ * except according to the terms contained in the LICENSE.md file.
+ */
+
+#include "CRC32C.h"
+
+#include <cstring>
+
+#if defined(__x86_64__)
+#include <nmmintrin.h>
+#endif
+
+#if defined(__aarch64__) && defined(__ARM_FEATURE_CRC32)
+#include <arm_acle.h>
+#endif
+
+
+namespace {
+
+// Reversed Castagnoli polynomial.
+const uint32_t kPolynomial = 0x82F63B78;
+
+/**
+ * Lookup tables of the slicing-by-8 algorithm.
+ * Table N contains CRC of the byte, followed by N zero bytes.
+ */
+struct SlicingTables {
+    uint32_t tables[8][256];
+
+    SlicingTables()
+        noexcept
+    {
+        for (uint32_t value = 0; value < 256; ++value) {
+            uint32_t crc = value;
+            for (size_t bit = 0; bit < 8; ++bit) {
+                crc = (crc >> 1) ^ (kPolynomial & (0 - (crc & 1)));
+            }
+            tables[0][value] = crc;
+        }
+
+        for (uint32_t value = 0; value < 256; ++value) {
+            for (size_t table = 1; table < 8; ++table) {
+                const auto kPrevious = tables[table - 1][value];
+                tables[table][value] = (kPrevious >> 8) ^ tables[0][kPrevious & 0xFF];
+            }
+        }
+    }
+};
+
+const SlicingTables kSlicingTables;
+
+}
+
+
+uint32_t CRC32C::checksum(
+    const byte *data,
+    const size_t bytesCount)
+    noexcept
+{
+#if defined(__x86_64__)
+    static const bool kSSE42Available = __builtin_cpu_supports("sse4.2");
+    if (kSSE42Available) {
+        return ~sse42Checksum(0xFFFFFFFF, data, bytesCount);
+    }
+#endif
+
+#if defined(__aarch64__) && defined(__ARM_FEATURE_CRC32)
+    return ~armv8Checksum(0xFFFFFFFF, data, bytesCount);
+#endif
+
+    return ~softwareChecksum(0xFFFFFFFF, data, bytesCount);
+}
+
+uint32_t CRC32C::softwareChecksum(
+    uint32_t crc,
+    const byte *data,
+    size_t bytesCount)
+    noexcept
+{
+    const auto &kTables = kSlicingTables.tables;
+
+    // Bytes are combined explicitly, so the result doesn't depend on the byte order of the platform.
+    while (bytesCount >= 8) {
+        crc ^= static_cast<uint32_t>(data[0])
+             | static_cast<uint32_t>(data[1]) << 8
+             | static_cast<uint32_t>(data[2]) << 16
+             | static_cast<uint32_t>(data[3]) << 24;
+
+        crc = kTables[7][crc & 0xFF]
+            ^ kTables[6][(crc >> 8) & 0xFF]
+            ^ kTables[5][(crc >> 16) & 0xFF]
+            ^ kTables[4][crc >> 24]
+            ^ kTables[3][data[4]]
+            ^ kTables[2][data[5]]
+            ^ kTables[1][data[6]]
+            ^ kTables[0][data[7]];
+
+        data += 8;
+        bytesCount -= 8;
+    }
+
+    while (bytesCount > 0) {
+        crc = (crc >> 8) ^ kTables[0][(crc ^ *data) & 0xFF];
+        ++data;
+        --bytesCount;
+    }
+
+    return crc;
+}
+
+#if defined(__x86_64__)
+__attribute__((target("sse4.2")))
+uint32_t CRC32C::sse42Checksum(
+    uint32_t crc,
+    const byte *data,
+    size_t bytesCount)
+    noexcept
+{
+    uint64_t crc64 = crc;
+    while (bytesCount >= sizeof(uint64_t)) {
+        uint64_t word;
+        memcpy(&word, data, sizeof(word));
+        crc64 = _mm_crc32_u64(crc64, word);
+
+        data += sizeof(word);
+        bytesCount -= sizeof(word);
+    }
+
+    crc = static_cast<uint32_t>(crc64);
+    while (bytesCount > 0) {
+        crc = _mm_crc32_u8(crc, *data);
+        ++data;
+        --bytesCount;
+    }
+
+    return crc;
+}
+#endif
+
+#if defined(__aarch64__) && defined(__ARM_FEATURE_CRC32)
+uint32_t CRC32C::armv8Checksum(
+    uint32_t crc,
+    const byte *data,
+    size_t bytesCount)
+    noexcept
+{
+    while (bytesCount >= sizeof(uint64_t)) {
+        uint64_t word;
+        memcpy(&word, data, sizeof(word));
+        crc = __crc32cd(crc, word);
+
+        data += sizeof(word);
+        bytesCount -= sizeof(word);
+    }
+
+    while (bytesCount > 0) {
+        crc = __crc32cb(crc, *data);
+        ++data;
+        --bytesCount;
+    }
+
+    return crc;
+}
+#endif
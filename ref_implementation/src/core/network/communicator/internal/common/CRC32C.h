@@ -0,0 +1,58 @@
+/**
+ * This file is part of GEO Project.
+ * It is subject to the license terms in the LICENSE.md file found in the top-level directory
+ * of this distribution and at https://github.com/GEO-Project/GEO-Project/blob/master/LICENSE.md
+ *
+ * No part of GEO Project, including this file, may be copied, modified, propagated, or distributed
+ * except according to the terms contained in the LICENSE.md file.
+ */
+
+#ifndef GEO_NETWORK_CLIENT_CRC32C_H
+#define GEO_NETWORK_CLIENT_CRC32C_H
+
+#include "../../../../common/Types.h"
+
+#include <cstddef>
+#include <cstdint>
+
+
+/**
+ * CRC32C (Castagnoli) checksum of the messages.
+ *
+ * Uses CRC32 instructions of the CPU, when they are available:
+ *   - SSE4.2 on x86-64 (detected at runtime);
+ *   - ARMv8 CRC extension (detected at compile time, via __ARM_FEATURE_CRC32).
+ * Otherwise - portable slicing-by-8 implementation is used (8 bytes per iteration).
+ */
+class CRC32C {
+public:
+    static uint32_t checksum(
+        const byte *data,
+        const size_t bytesCount)
+        noexcept;
+
+protected:
+    static uint32_t softwareChecksum(
+        uint32_t crc,
+        const byte *data,
+        size_t bytesCount)
+        noexcept;
+
+#if defined(__x86_64__)
+    static uint32_t sse42Checksum(
+        uint32_t crc,
+        const byte *data,
+        size_t bytesCount)
+        noexcept;
+#endif
+
+#if defined(__aarch64__) && defined(__ARM_FEATURE_CRC32)
+    static uint32_t armv8Checksum(
+        uint32_t crc,
+        const byte *data,
+        size_t bytesCount)
+        noexcept;
+#endif
+};
+
+#endif //GEO_NETWORK_CLIENT_CRC32C_H
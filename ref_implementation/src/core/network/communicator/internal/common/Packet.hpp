@@ -12,6 +12,8 @@
 
 #include "../../../../common/Types.h"
 
+#include <limits>
+
 
 /**
  * Network packet scheme:
@@ -42,6 +44,16 @@ public:
       + sizeof(PacketIndex);
 
 
+    // Max packet size never exceeds 2**15, so the highest bit of the packet size field is used as a flag.
+    // In data packets it is set in case if the checksum of the message is CRC32C (otherwise it is CRC32).
+    // In service packets it is set by the nodes, that are able to check CRC32C.
+    static const PacketSize kCRC32CFlag = 0x8000;
+    static const PacketSize kPacketSizeMask = 0x7FFF;
+
+    // The next bit is used only in service packets:
+    // it is set by the nodes, that are able to parse amounts of the messages in compact encoding.
+    static const PacketSize kCompactAmountsFlag = 0x4000;
+
     static const uint16_t kPacketSizeOffset   = 0;
     static const uint16_t kChannelIndexOffset = kPacketSizeOffset     + sizeof(PacketSize);
     static const uint16_t kPacketsCountOffset = kChannelIndexOffset   + sizeof(ChannelIndex);
@@ -58,14 +70,14 @@ public:
 
     static const size_t kCRCChecksumBytesCount = sizeof(uint32_t);
 
+    // Packet size is selected for each remote node separately (see OutgoingRemoteNode).
+    // Each node starts with the default size, and steps up to the larger sizes,
+    // only when the remote node confirms, that it is able to receive packets of such size.
 #ifdef ENGINE_TYPE_DC
     // In most cases, datacenter network is capable to process large UDP packets.
     // In case if engine is launched in the DC - there is much more efficient to use largest packet size,
     // and send less packets via the network.
-    //
-    // TODO: delivery problems may occur, on attempt ot send big packets to the decentralized network.
-    // It would be great to be able to switch data packet size for each endpoint.
-    static const Size kMaxSize = 2048;
+    static const Size kDefaultSize = 2048;
 #endif
 
 #ifndef ENGINE_TYPE_DC
@@ -73,10 +85,49 @@ public:
     // Some space in the packet must be reserved for the IP headers.
     //
     // For the details: http://stackoverflow.com/questions/1098897/what-is-the-largest-safe-udp-packet-size-on-the-internet
-    static const Size kMaxSize = 508;
+    static const Size kDefaultSize = 508;
 #endif
 
+    // Packet, that fits into the standard ethernet frame (1500B MTU) with IP and UDP headers.
+    static const Size kEthernetSize = 1400;
+
+    // Packet, that fits into the jumbo ethernet frame (9000B MTU).
+    // This is the largest packet, that might be sent or received.
+    static const Size kMaxSize = 8192;
+
     static const constexpr Size kMinSize = PacketHeader::kSize + 1;
+
+    /**
+     * @returns packet size, that should be probed after the "size".
+     * In case if "size" is already the largest one - 0 would be returned.
+     */
+    static Size nextSize(
+        const Size size)
+        noexcept
+    {
+        if (size < kEthernetSize) {
+            return kEthernetSize;
+        }
+
+        if (size < kMaxSize) {
+            return kMaxSize;
+        }
+
+        return 0;
+    }
+
+    /**
+     * @returns max size of the message, that might be transferred in packets of the "packetSize".
+     */
+    static size_t maxMessageSize(
+        const Size packetSize)
+        noexcept
+    {
+        return
+            static_cast<size_t>(numeric_limits<PacketHeader::TotalPacketsCount>::max())
+            * (packetSize - PacketHeader::kSize)
+            - kCRCChecksumBytesCount;
+    }
 };
 
 #endif // PACKET_H
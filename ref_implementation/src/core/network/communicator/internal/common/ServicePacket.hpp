@@ -0,0 +1,217 @@
+/**
+ * This file is part of GEO Project.
+ * It is subject to the license terms in the LICENSE.md file found in the top-level directory
+ * of this distribution and at https://github.com/GEO-Project/GEO-Project/blob/master/LICENSE.md
+ *
+ * No part of GEO Project, including this file, may be copied, modified, propagated, or distributed
+ * except according to the terms contained in the LICENSE.md file.
+ */
+
+#ifndef GEO_NETWORK_CLIENT_SERVICEPACKET_H
+#define GEO_NETWORK_CLIENT_SERVICEPACKET_H
+
+#include "Types.h"
+#include "Packet.hpp"
+
+#include <boost/array.hpp>
+
+#include <bitset>
+#include <limits>
+#include <cstring>
+
+
+/**
+ * Service packets are exchanged between the communicators itself and never contain messages data.
+ * They are used for the packets delivery control of the multi-packet messages.
+ *
+ * Service packet has the same header as the data packet, but:
+ *   - CRC32C flag of the "Packet size" field is always set by the nodes, that support CRC32C checksums
+ *     (sender of the messages switches to CRC32C only after this flag was received from the remote node);
+ *   - compact amounts flag of the "Packet size" field is always set by the nodes, that are able to parse
+ *     amounts of the messages in compact encoding (sender switches to it only after this flag was received);
+ *   - "Total packets count" field is always 0
+ *     (data packet with such header is invalid, so nodes, that doesn't support service packets, simply drop them);
+ *   - "Current packet index" field contains the type of the service packet;
+ *   - "Channel index" field contains the channel of the message, to which the service packet is related.
+ *
+ * Service packets types:
+ *   - Acknowledgement: message was collected by the receiver, no retransmission would be needed;
+ *   - MissingPacketsRequest: receiver has not received some packets of the message;
+ *     body contains 32B bitmap of the missing packets indexes (bit N is set if packet N is missing);
+ *   - PacketSizeProbe: sender checks if the packets of this size are delivered to the receiver;
+ *     packet is padded with zeroes up to the probed size;
+ *   - PacketSizeConfirmation: receiver confirms, that the probe was received,
+ *     "Channel index" field contains the size of the received probe.
+ */
+class ServicePacket {
+public:
+    enum Type {
+        Acknowledgement = 1,
+        MissingPacketsRequest = 2,
+        PacketSizeProbe = 3,
+        PacketSizeConfirmation = 4,
+    };
+
+    using Buffers = boost::array<boost::asio::const_buffer, 2>;
+
+    using PacketsBitmap = bitset<
+        static_cast<size_t>(numeric_limits<PacketHeader::TotalPacketsCount>::max()) + 1>;
+
+    static const constexpr size_t kBitmapBytesCount = PacketsBitmap().size() / 8;
+    static const constexpr size_t kMaxSize = PacketHeader::kSize + kBitmapBytesCount;
+
+public:
+    ServicePacket(
+        const Type type,
+        const PacketHeader::ChannelIndex channelIndex)
+        noexcept :
+
+        mSize(PacketHeader::kSize),
+        mPaddingSize(0)
+    {
+        writeHeader(type, channelIndex);
+    }
+
+    /**
+     * Creates packet size probe of the "probedSize".
+     */
+    explicit ServicePacket(
+        const Packet::Size probedSize)
+        noexcept :
+
+        mSize(PacketHeader::kSize),
+        mPaddingSize(static_cast<PacketHeader::PacketSize>(probedSize - PacketHeader::kSize))
+    {
+        writeHeader(PacketSizeProbe, 0);
+    }
+
+    ServicePacket(
+        const PacketHeader::ChannelIndex channelIndex,
+        const PacketsBitmap &missingPackets)
+        noexcept :
+
+        mSize(kMaxSize),
+        mPaddingSize(0)
+    {
+        writeHeader(MissingPacketsRequest, channelIndex);
+
+        auto bitmap = mBytes + PacketHeader::kDataOffset;
+        memset(bitmap, 0, kBitmapBytesCount);
+        for (size_t index = 0; index < missingPackets.size(); ++index) {
+            if (missingPackets.test(index)) {
+                bitmap[index / 8] |= static_cast<byte>(1 << (index % 8));
+            }
+        }
+    }
+
+    Buffers buffers() const
+        noexcept
+    {
+        // Padding is never copied into the packet:
+        // all probes refer to the same static zeroed memory block.
+        static const byte kPadding[Packet::kMaxSize] = {};
+
+        return Buffers{{
+            boost::asio::buffer(mBytes, mSize),
+            boost::asio::buffer(kPadding, mPaddingSize)}};
+    }
+
+    /**
+     * @returns "true" if "bytes" contains service packet (and not a data packet).
+     */
+    static bool isServicePacket(
+        const byte *bytes,
+        const size_t bytesCount)
+        noexcept
+    {
+        return bytesCount >= PacketHeader::kSize
+            and bytes[PacketHeader::kPacketsCountOffset] == 0;
+    }
+
+    /**
+     * @returns "true" if the node, that sent service packet "bytes", is able to check CRC32C checksums.
+     */
+    static bool isCRC32CSupported(
+        const byte *bytes)
+        noexcept
+    {
+        PacketHeader::PacketSize packetSize;
+        memcpy(&packetSize, bytes + PacketHeader::kPacketSizeOffset, sizeof(packetSize));
+        return (packetSize & PacketHeader::kCRC32CFlag) != 0;
+    }
+
+    /**
+     * @returns "true" if the node, that sent service packet "bytes", is able to parse compact amounts.
+     */
+    static bool isCompactAmountsSupported(
+        const byte *bytes)
+        noexcept
+    {
+        PacketHeader::PacketSize packetSize;
+        memcpy(&packetSize, bytes + PacketHeader::kPacketSizeOffset, sizeof(packetSize));
+        return (packetSize & PacketHeader::kCompactAmountsFlag) != 0;
+    }
+
+    static Type type(
+        const byte *bytes)
+        noexcept
+    {
+        return static_cast<Type>(bytes[PacketHeader::kPacketIndexOffset]);
+    }
+
+    static PacketHeader::ChannelIndex channelIndex(
+        const byte *bytes)
+        noexcept
+    {
+        PacketHeader::ChannelIndex index;
+        memcpy(&index, bytes + PacketHeader::kChannelIndexOffset, sizeof(index));
+        return index;
+    }
+
+    /**
+     * @returns bitmap of the missing packets from the "MissingPacketsRequest" service packet.
+     * In case if packet is too short - empty bitmap would be returned.
+     */
+    static PacketsBitmap missingPackets(
+        const byte *bytes,
+        const size_t bytesCount)
+        noexcept
+    {
+        PacketsBitmap missingPackets;
+        if (bytesCount < kMaxSize) {
+            return missingPackets;
+        }
+
+        const auto bitmap = bytes + PacketHeader::kDataOffset;
+        for (size_t index = 0; index < missingPackets.size(); ++index) {
+            if (bitmap[index / 8] & (1 << (index % 8))) {
+                missingPackets.set(index);
+            }
+        }
+        return missingPackets;
+    }
+
+protected:
+    void writeHeader(
+        const Type type,
+        const PacketHeader::ChannelIndex channelIndex)
+        noexcept
+    {
+        const PacketHeader::PacketSize kPacketSize =
+            (mSize + mPaddingSize) | PacketHeader::kCRC32CFlag | PacketHeader::kCompactAmountsFlag;
+        const PacketHeader::TotalPacketsCount kTotalPacketsCount = 0;
+        const PacketHeader::PacketIndex kType = static_cast<PacketHeader::PacketIndex>(type);
+
+        memcpy(mBytes + PacketHeader::kPacketSizeOffset, &kPacketSize, sizeof(kPacketSize));
+        memcpy(mBytes + PacketHeader::kChannelIndexOffset, &channelIndex, sizeof(channelIndex));
+        memcpy(mBytes + PacketHeader::kPacketsCountOffset, &kTotalPacketsCount, sizeof(kTotalPacketsCount));
+        memcpy(mBytes + PacketHeader::kPacketIndexOffset, &kType, sizeof(kType));
+    }
+
+protected:
+    byte mBytes[kMaxSize];
+    PacketHeader::PacketSize mSize;
+    PacketHeader::PacketSize mPaddingSize;
+};
+
+#endif //GEO_NETWORK_CLIENT_SERVICEPACKET_H
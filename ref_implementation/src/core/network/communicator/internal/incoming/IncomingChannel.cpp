@@ -13,21 +13,28 @@
 IncomingChannel::IncomingChannel(
     MessagesParser &messagesParser,
     TimePoint &nodeHandlerLastUpdate,
+    size_t &nodeHandlerReservedBytesCount,
     Logger &logger)
     noexcept :
 
     mLastRemoteNodeHandlerUpdated(nodeHandlerLastUpdate),
+    mRemoteNodeHandlerReservedBytesCount(nodeHandlerReservedBytesCount),
+    mReservedBytesCount(0),
     mMessagesParser(messagesParser),
     mLog(logger),
-    mExpectedPacketsCount(0)
+    mExpectedPacketsCount(0),
+    mReceivedPacketsCount(0),
+    mBufferSize(0),
+    mSegmentSize(0),
+    mIsCRC32C(false),
+    mLastPacketSize(0),
+    mMissingPacketsRequestsCount(0)
 {}
 
-IncomingChannel::~IncomingChannel()
-    noexcept
-{
-    clear();
-}
-
+/**
+ * Prepares channel for the message of "count" packets.
+ * Message buffer itself is reserved later, when the data segment size would be known.
+ */
 void IncomingChannel::reservePacketsSlots(
     const PacketHeader::TotalPacketsCount count)
     noexcept(false)
@@ -38,31 +45,97 @@ void IncomingChannel::reservePacketsSlots(
     //
     // Each packet contains info about total packets count of the message.
     // So, theoretically, "count" may change from call to call.
-    if (mExpectedPacketsCount != count) {
-        mExpectedPacketsCount = count;
-        mPackets.reserve(count);
+    // In this case packets of the previous message can't be used anymore.
+    if (mExpectedPacketsCount == count) {
+        return;
     }
+
+    clear();
+    mExpectedPacketsCount = count;
 }
 
 /**
- * Inserts packet bytes to the corresponding packet slot of the channel.
+ * Accounts "bytesCount" of the incomplete message in the bytes limit of the remote node.
+ * Single-packet messages are collected immediately, so only multi-packet messages are accounted.
  *
- * @param index - specifies packet slot index.
+ * @throws OverflowError in case if the incomplete messages of the remote node would exceed the limit.
+ */
+void IncomingChannel::reserveMessageBytes(
+    const size_t bytesCount)
+    noexcept(false)
+{
+    const auto kOtherChannelsReservedBytesCount = mRemoteNodeHandlerReservedBytesCount - mReservedBytesCount;
+    if (kOtherChannelsReservedBytesCount + bytesCount > kMaxNodeReservedBytesCount) {
+        throw OverflowError(
+            "IncomingChannel::reserveMessageBytes: "
+            "too many bytes are reserved for the incomplete messages of the remote node.");
+    }
+
+    mRemoteNodeHandlerReservedBytesCount = kOtherChannelsReservedBytesCount + bytesCount;
+    mReservedBytesCount = bytesCount;
+}
+
+/**
+ * Message buffer may be reused only if it is large enough,
+ * and no one message, that was collected previously, still refers to it.
+ *
+ * @throws bad_alloc;
+ */
+void IncomingChannel::reserveBuffer(
+    const size_t bytesCount)
+    noexcept(false)
+{
+    if (mBuffer == nullptr or mBufferSize < bytesCount or mBuffer.use_count() > 1) {
+        mBuffer = tryMalloc(bytesCount);
+        mBufferSize = bytesCount;
+    }
+}
+
+/**
+ * Copies packet bytes into the message buffer at the position of the packet.
+ *
+ * @param index - specifies packet index.
  * @param bytes - bytes sequence of the packet.
  * @param bytesCount - count of bytes in sequence "bytes".
+ * @param isCRC32C - "true" if the checksum of the message is CRC32C (otherwise - CRC32).
  *
  *
+ * @throws ValueError in case if packet index is out of range,
+ * or if non-last packet size differs from the size of the other non-last packets of the message.
+ * @throws OverflowError in case if the message doesn't fit into the reserved bytes limit of the remote node.
  * @throws bad_alloc;
  */
 void IncomingChannel::addPacket(
     const PacketHeader::PacketIndex index,
-    byte *bytes,
-    const PacketHeader::PacketSize bytesCount)
+    const byte *bytes,
+    const PacketHeader::PacketSize bytesCount,
+    const bool isCRC32C)
     noexcept(false)
 {
-    auto buffer = malloc(bytesCount);
-    if (buffer == nullptr) {
-        throw bad_alloc();
+    if (index >= mExpectedPacketsCount or bytesCount > kMaxSegmentSize) {
+        throw ValueError(
+            "IncomingChannel::addPacket: "
+            "packet doesn't fit into the channel.");
+    }
+
+    const bool kIsLastPacket = index == mExpectedPacketsCount - 1;
+    if (not kIsLastPacket) {
+        if (mSegmentSize == 0) {
+            if (bytesCount == 0) {
+                throw ValueError(
+                    "IncomingChannel::addPacket: "
+                    "non-last packet of the message can't be empty.");
+            }
+
+            reserveMessageBytes(mExpectedPacketsCount * bytesCount);
+            mSegmentSize = bytesCount;
+            reserveBuffer(mReservedBytesCount);
+
+        } else if (bytesCount != mSegmentSize) {
+            throw ValueError(
+                "IncomingChannel::addPacket: "
+                "packet size differs from the other packets of the message.");
+        }
     }
 
     // In case if sender node begins sending several messages into one channel -
@@ -71,69 +144,83 @@ void IncomingChannel::addPacket(
     // In case if packet slot is already occupied - no exception should be thrown,
     // and packet processing must be continued. Otherwise, both packets would be lost,
     // and no one message would be collected.
-    //
-    //
-    // To prevent memory leak - previous packet must be dropped.
-    if (mPackets.count(index) > 0){
-        free(mPackets[index].first);
+    // Previous packet is simply overwritten.
+    if (not mReceivedPackets.test(index)) {
+        mReceivedPackets.set(index);
+        ++mReceivedPacketsCount;
     }
 
-    memcpy(
-        buffer,
-        bytes,
-        bytesCount);
+    mIsCRC32C = isCRC32C;
+    if (kIsLastPacket) {
+        memcpy(mLastPacket.data(), bytes, bytesCount);
+        mLastPacketSize = bytesCount;
 
-    mPackets[index] = make_pair(
-        buffer,
-        bytesCount);
+    } else {
+        memcpy(
+            mBuffer.get() + index * mSegmentSize,
+            bytes,
+            bytesCount);
+    }
 
     mLastPacketReceived = chrono::steady_clock::now();
     mLastRemoteNodeHandlerUpdated = mLastPacketReceived;
 }
 
+/**
+ * Checks if all packets of the message was received, and if so - tries to deserialize the message.
+ * In both cases (message collected or message is broken) - channel is cleared and might be reused.
+ */
 pair<bool, Message::Shared> IncomingChannel::tryCollectMessage()
 {
-    if (receivedPacketsCount() != expectedPacketsCount()) {
+    if (mExpectedPacketsCount == 0 or receivedPacketsCount() != expectedPacketsCount()) {
         return make_pair(false, Message::Shared(nullptr));
     }
 
-    size_t totalBytesReceived = 0;
-    for (const auto &kPacketIndexAndData : mPackets) {
-         totalBytesReceived += kPacketIndexAndData.second.second;
-    }
+    // Non-last packets are already in place, only the last one must be appended.
+    // (for the single-packet messages buffer is not reserved yet).
+    if (mExpectedPacketsCount == 1) {
+        reserveBuffer(mLastPacketSize);
 
-    if (totalBytesReceived <= Packet::kMaxSize - PacketHeader::kSize) {
-        // ToDo: (optimisation):
-        // Message consists only one packet.
-        // No need for additional copying of it's content into the intermediate buffer.
-        // Problem to convert it to the shared buffer and don't drop it on exit.
+    } else if (mLastPacketSize > mSegmentSize) {
+        clear();
+        return make_pair(false, Message::Shared(nullptr));
     }
 
-    // Message consists more than one packet.
-    // To be able to deserialize them - all packets must be chained into one memory block.
-    auto buffer = tryMalloc(totalBytesReceived);
+    const auto kLastPacketOffset = (mExpectedPacketsCount - 1) * mSegmentSize;
+    memcpy(
+        mBuffer.get() + kLastPacketOffset,
+        mLastPacket.data(),
+        mLastPacketSize);
 
-    size_t currentBufferOffset = 0;
-    for (PacketHeader::TotalPacketsCount index=0; index<receivedPacketsCount(); ++index) {
-        const auto &kPacketBytesAndBytesCount = mPackets[index];
-        memcpy(
-            buffer.get() + currentBufferOffset,
-            kPacketBytesAndBytesCount.first,
-            kPacketBytesAndBytesCount.second);
+    const auto totalBytesReceived = kLastPacketOffset + mLastPacketSize;
+    const auto kIsCRC32C = mIsCRC32C;
+    clear();
 
-        currentBufferOffset += kPacketBytesAndBytesCount.second;
+    if (totalBytesReceived <= Packet::kCRCChecksumBytesCount) {
+        return make_pair(false, Message::Shared(nullptr));
     }
 
 
     // CRC Checking
-    boost::crc_32_type crc;
-    crc.process_bytes(
-        buffer.get(),
-        totalBytesReceived - sizeof(uint32_t));
+    uint32_t calculatedCRC;
+    if (kIsCRC32C) {
+        calculatedCRC = CRC32C::checksum(
+            mBuffer.get(),
+            totalBytesReceived - Packet::kCRCChecksumBytesCount);
 
-    uint32_t calculatedCRC = crc.checksum();
-    uint32_t receivedCRC = *(reinterpret_cast<uint32_t*>(
-        buffer.get() + totalBytesReceived - sizeof(uint32_t)));
+    } else {
+        boost::crc_32_type crc;
+        crc.process_bytes(
+            mBuffer.get(),
+            totalBytesReceived - Packet::kCRCChecksumBytesCount);
+        calculatedCRC = crc.checksum();
+    }
+
+    uint32_t receivedCRC;
+    memcpy(
+        &receivedCRC,
+        mBuffer.get() + totalBytesReceived - Packet::kCRCChecksumBytesCount,
+        sizeof(receivedCRC));
 
     if (receivedCRC != calculatedCRC) {
 
@@ -146,26 +233,45 @@ pair<bool, Message::Shared> IncomingChannel::tryCollectMessage()
     }
 
     return mMessagesParser.processBytesSequence(
-        buffer,
+        mBuffer,
         totalBytesReceived - Packet::kCRCChecksumBytesCount);
 }
 
 /**
- * Removes all packets of the channel and frees the memory.
+ * Drops all received packets of the channel.
+ * Message buffer is not released: it would be reused by the next message.
  */
 void IncomingChannel::clear()
     noexcept
-{    
-    for (const auto &kIndexAndPacketData : mPackets) {
-        free(kIndexAndPacketData.second.first);
+{
+    mReceivedPackets.reset();
+    mReceivedPacketsCount = 0;
+    mExpectedPacketsCount = 0;
+    mSegmentSize = 0;
+    mLastPacketSize = 0;
+    mMissingPacketsRequestsCount = 0;
+
+    mRemoteNodeHandlerReservedBytesCount -= mReservedBytesCount;
+    mReservedBytesCount = 0;
+}
+
+/**
+ * Large buffers are needed only by the rare large messages,
+ * so they are not kept by the channels, that wait for reuse.
+ */
+void IncomingChannel::releaseLargeBuffer()
+    noexcept
+{
+    if (mBufferSize > kMaxReusableBufferSize) {
+        mBuffer = nullptr;
+        mBufferSize = 0;
     }
-    mPackets.clear();
 }
 
 Packet::Size IncomingChannel::receivedPacketsCount() const
     noexcept
 {
-    return static_cast<Packet::Size>(mPackets.size());
+    return mReceivedPacketsCount;
 }
 
 Packet::Size IncomingChannel::expectedPacketsCount() const
@@ -179,3 +285,57 @@ const TimePoint &IncomingChannel::lastUpdated() const
 {
     return mLastPacketReceived;
 }
+
+/**
+ * @returns "true" in case if the message is incomplete, no packets was received for some time,
+ * and the sender should be asked to retransmit the missing packets.
+ * Missing packets are requested only several times: in case if the sender doesn't respond -
+ * channel would be dropped as outdated.
+ */
+bool IncomingChannel::isMissingPacketsRequestRequired(
+    const TimePoint &now) const
+    noexcept
+{
+    if (mExpectedPacketsCount == 0 or mReceivedPacketsCount == mExpectedPacketsCount) {
+        return false;
+    }
+
+    if (mMissingPacketsRequestsCount >= kMaxMissingPacketsRequestsCount) {
+        return false;
+    }
+
+    if (now - mLastPacketReceived < kMissingPacketsRequestDelay()) {
+        return false;
+    }
+
+    return mMissingPacketsRequestsCount == 0
+        or now - mLastMissingPacketsRequest >= kMissingPacketsRequestDelay();
+}
+
+ServicePacket::PacketsBitmap IncomingChannel::missingPackets() const
+    noexcept
+{
+    auto missingPackets = ~mReceivedPackets;
+    for (size_t index = mExpectedPacketsCount; index < missingPackets.size(); ++index) {
+        missingPackets.reset(index);
+    }
+    return missingPackets;
+}
+
+void IncomingChannel::onMissingPacketsRequested(
+    const TimePoint &now)
+    noexcept
+{
+    mLastMissingPacketsRequest = now;
+    ++mMissingPacketsRequestsCount;
+}
+
+/**
+ * @returns period of silence in the channel, after which missing packets are requested from the sender.
+ */
+chrono::milliseconds IncomingChannel::kMissingPacketsRequestDelay()
+    noexcept
+{
+    static const chrono::milliseconds kDelay(150);
+    return kDelay;
+}
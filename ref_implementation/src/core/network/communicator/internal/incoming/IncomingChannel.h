@@ -13,13 +13,17 @@
 #include "MessageParser.h"
 #include "../common/Types.h"
 #include "../common/Packet.hpp"
+#include "../common/ServicePacket.hpp"
+#include "../common/CRC32C.h"
 
 #include "../../../messages/Message.hpp"
 #include "../../../../common/memory/MemoryUtils.h"
 #include "../../../../common/exceptions/ConflictError.h"
+#include "../../../../common/exceptions/ValueError.h"
+#include "../../../../common/exceptions/OverflowError.h"
 
-#include <boost/unordered_map.hpp>
 #include <boost/crc.hpp>
+#include <boost/array.hpp>
 
 #include <utility>
 #include <limits>
@@ -31,6 +35,19 @@ using namespace std;
 
 /**
  * Collects incoming packets from the remote node.
+ *
+ * Packets are copied directly into the message buffer of the channel.
+ * Packet size is negotiated by the sender for each remote node separately,
+ * but all packets of the message, except the last one, are always full,
+ * so data segment size is detected by the first non-last packet received.
+ * Each packet is placed at its final position, so packets may arrive in any order.
+ * The last packet is kept aside until the segment size is known.
+ * Received packets are tracked by the flat bitmap.
+ * Message buffer is reused by the next messages in case if no one else holds it.
+ *
+ * Message buffers of all the incomplete channels of one remote node are limited in total,
+ * so one small datagram with the large packets count can't make the node reserve megabytes of memory
+ * for each channel index the sender (or anyone spoofing it) decides to open.
  */
 class IncomingChannel {
 public:
@@ -40,13 +57,14 @@ public:
     IncomingChannel(
         MessagesParser &messageParser,
         TimePoint &nodeHandlerLastUpdate,
+        size_t &nodeHandlerReservedBytesCount,
         Logger &logger)
         noexcept;
 
-    ~IncomingChannel()
+    void clear()
         noexcept;
 
-    void clear()
+    void releaseLargeBuffer()
         noexcept;
 
     void reservePacketsSlots(
@@ -55,8 +73,9 @@ public:
 
     void addPacket(
         const PacketHeader::PacketIndex index,
-        byte* bytes,
-        const PacketHeader::PacketSize count)
+        const byte* bytes,
+        const PacketHeader::PacketSize count,
+        const bool isCRC32C)
         noexcept(false);
 
     pair<bool, Message::Shared> tryCollectMessage();
@@ -70,15 +89,75 @@ public:
     const TimePoint& lastUpdated() const
         noexcept;
 
+    bool isMissingPacketsRequestRequired(
+        const TimePoint &now) const
+        noexcept;
+
+    ServicePacket::PacketsBitmap missingPackets() const
+        noexcept;
+
+    void onMissingPacketsRequested(
+        const TimePoint &now)
+        noexcept;
+
+protected:
+    static const constexpr size_t kMaxPacketsCount =
+        static_cast<size_t>(numeric_limits<PacketHeader::TotalPacketsCount>::max()) + 1;
+
+    static const constexpr size_t kMaxMissingPacketsRequestsCount = 3;
+
+protected:
+    static chrono::milliseconds kMissingPacketsRequestDelay()
+        noexcept;
+
+    static const constexpr size_t kMaxSegmentSize = Packet::kMaxSize - PacketHeader::kSize;
+
+    // Total size of the messages, that may be collected from one remote node at once:
+    // enough for two messages of the max size.
+    static const constexpr size_t kMaxNodeReservedBytesCount = 2 * kMaxPacketsCount * kMaxSegmentSize;
+
+    // Buffers greater than this are not kept by the released channels.
+    static const constexpr size_t kMaxReusableBufferSize = 8 * kMaxSegmentSize;
+
+protected:
+    void reserveMessageBytes(
+        const size_t bytesCount)
+        noexcept(false);
+
+    void reserveBuffer(
+        const size_t bytesCount)
+        noexcept(false);
+
 protected:
     TimePoint mLastPacketReceived;
     TimePoint &mLastRemoteNodeHandlerUpdated;
 
+    // Bytes reserved by all the incomplete channels of the remote node,
+    // and the part of them, that was reserved by this channel.
+    size_t &mRemoteNodeHandlerReservedBytesCount;
+    size_t mReservedBytesCount;
+
     MessagesParser &mMessagesParser;
     Logger &mLog;
     Packet::Size mExpectedPacketsCount;
+    Packet::Size mReceivedPacketsCount;
+
+    BytesShared mBuffer;
+    size_t mBufferSize;
+
+    // 0 until the first non-last packet of the message is received.
+    size_t mSegmentSize;
+
+    // Type of the message checksum, is reported by the sender in each packet.
+    bool mIsCRC32C;
+
+    boost::array<byte, kMaxSegmentSize> mLastPacket;
+    PacketHeader::PacketSize mLastPacketSize;
+
+    ServicePacket::PacketsBitmap mReceivedPackets;
 
-    boost::unordered_map<PacketHeader::PacketIndex, pair<void*, PacketHeader::PacketSize>> mPackets;
+    TimePoint mLastMissingPacketsRequest;
+    size_t mMissingPacketsRequestsCount;
 };
 
 
@@ -21,16 +21,20 @@ IncomingMessagesHandler::IncomingMessagesHandler(
     mLog(logger),
     mMessagesParser(&logger),
     mRemoteNodesHandler(
+        mSocket,
         mMessagesParser,
         mLog),
-    mCleaningTimer(ioService)
+    mCleaningTimer(ioService),
+    mMissingPacketsRequestsTimer(ioService),
+    mReceivingRestartTimer(ioService),
+    mReceivingRestartTimeoutSeconds(1)
 {
 #ifdef ENGINE_TYPE_DC
     // Builds Data centers may have signifficantly larger read socket buffer.
     // Large read socket buffer is needed to handle potentially huge amount of messages,
     // that might arrive form the network during max flow calculation.
     const uint32_t kMaxReadSocketSize = 1024*1024*30; // 30MB of data.
-#elif
+#else
 
     // Other platforms might be unable to handle extra large buffers,
     // so the default on is used.
@@ -40,12 +44,32 @@ IncomingMessagesHandler::IncomingMessagesHandler(
     boost::asio::socket_base::receive_buffer_size option(kMaxReadSocketSize);
     mSocket.set_option(option);
 
+#ifdef LINUX
+    for (size_t datagramNumber = 0; datagramNumber < kMaxDatagramsInBatch; ++datagramNumber) {
+        mIOVectors[datagramNumber].iov_base = mIncomingBuffers[datagramNumber].data();
+        mIOVectors[datagramNumber].iov_len = kMaxIncomingBufferSize;
+    }
+#endif
+
     rescheduleCleaning();
+    rescheduleMissingPacketsRequests();
 }
 
 void IncomingMessagesHandler::beginReceivingData ()
     noexcept
 {
+#ifdef LINUX
+    // Datagrams are read in batches (see handleSocketReadable()),
+    // so only the readability of the socket is awaited here.
+    mSocket.async_wait(
+        UDPSocket::wait_read,
+        boost::bind(
+            &IncomingMessagesHandler::handleSocketReadable,
+            this,
+            boost::asio::placeholders::error));
+#endif
+
+#ifndef LINUX
     mSocket.async_receive_from(
        boost::asio::buffer(mIncomingBuffer),
        mRemoteEndpointBuffer,
@@ -54,6 +78,7 @@ void IncomingMessagesHandler::beginReceivingData ()
            this,
            boost::asio::placeholders::error,
            boost::asio::placeholders::bytes_transferred));
+#endif
 }
 
 void IncomingMessagesHandler::handleReceivedInfo(
@@ -61,85 +86,195 @@ void IncomingMessagesHandler::handleReceivedInfo(
     size_t bytesTransferred)
     noexcept
 {
-    static auto exponetialTimeoutSeconds = 1;
-    static boost::asio::steady_timer waitingTimer(mIOService);
+    if (errorMessage) {
+        restartReceivingAfterError(errorMessage);
+        return;
+    }
 
+    processDatagram(
+        mRemoteEndpointBuffer,
+        mIncomingBuffer.data(),
+        bytesTransferred);
 
+    // In all cases - messages receiving should be continued.
+    beginReceivingData();
+}
+
+#ifdef LINUX
+/**
+ * Reads all the datagrams, that are available in the socket (but no more than kMaxBatchesPerWakeup batches),
+ * and processes them in one pass.
+ */
+void IncomingMessagesHandler::handleSocketReadable(
+    const boost::system::error_code &errorMessage)
+    noexcept
+{
     if (errorMessage) {
-        error() << "handleReceivedInfo: ASIO error: " << errorMessage.message();
+        restartReceivingAfterError(errorMessage);
+        return;
+    }
 
-        // In case of error - wait for some period of time
-        // and then restart receiving messages.
-        exponetialTimeoutSeconds = exponetialTimeoutSeconds * 2;
-        waitingTimer.expires_from_now(
-            chrono::seconds(
-                exponetialTimeoutSeconds));
+    for (size_t batchNumber = 0; batchNumber < kMaxBatchesPerWakeup; ++batchNumber) {
+        boost::system::error_code receivingError;
+        const auto kDatagramsCount = receiveDatagramsBatch(receivingError);
+        if (receivingError) {
+            restartReceivingAfterError(receivingError);
+            return;
+        }
 
-        waitingTimer.async_wait([this] (const boost::system::error_code&) {
-            beginReceivingData();});
+        for (size_t datagramNumber = 0; datagramNumber < kDatagramsCount; ++datagramNumber) {
+            processDatagram(
+                mRemoteEndpointsBuffers[datagramNumber],
+                mIncomingBuffers[datagramNumber].data(),
+                mMessagesHeaders[datagramNumber].msg_len);
+        }
 
-        return;
+        if (kDatagramsCount < kMaxDatagramsInBatch) {
+            // Socket is drained.
+            break;
+        }
+    }
+
+    // In all cases - messages receiving should be continued.
+    beginReceivingData();
+}
+
+size_t IncomingMessagesHandler::receiveDatagramsBatch(
+    boost::system::error_code &error)
+    noexcept
+{
+    for (size_t datagramNumber = 0; datagramNumber < kMaxDatagramsInBatch; ++datagramNumber) {
+        auto &endpoint = mRemoteEndpointsBuffers[datagramNumber];
+        auto &header = mMessagesHeaders[datagramNumber].msg_hdr;
+
+        memset(&header, 0, sizeof(header));
+        header.msg_name = endpoint.data();
+        header.msg_namelen = static_cast<socklen_t>(endpoint.capacity());
+        header.msg_iov = &mIOVectors[datagramNumber];
+        header.msg_iovlen = 1;
+    }
+
+    const auto kResult = ::recvmmsg(
+        mSocket.native_handle(),
+        mMessagesHeaders.data(),
+        kMaxDatagramsInBatch,
+        MSG_DONTWAIT,
+        nullptr);
+
+    if (kResult < 0) {
+        if (errno != EAGAIN and errno != EWOULDBLOCK and errno != EINTR) {
+            error.assign(errno, boost::system::system_category());
+        }
+        return 0;
     }
 
+    const auto kDatagramsCount = static_cast<size_t>(kResult);
+    for (size_t datagramNumber = 0; datagramNumber < kDatagramsCount; ++datagramNumber) {
+        mRemoteEndpointsBuffers[datagramNumber].resize(
+            mMessagesHeaders[datagramNumber].msg_hdr.msg_namelen);
+    }
+
+    return kDatagramsCount;
+}
+#endif
+
+void IncomingMessagesHandler::processDatagram(
+    const UDPEndpoint &endpoint,
+    byte *datagram,
+    const size_t bytesCount)
+    noexcept
+{
+    if (ServicePacket::isServicePacket(datagram, bytesCount)) {
+        // Packet size probe is addressed to the receiving side of the communicator,
+        // it is confirmed immediately: the probe itself is the proof, that the packet of such size was delivered.
+        if (ServicePacket::type(datagram) == ServicePacket::PacketSizeProbe) {
+            if (bytesCount <= Packet::kMaxSize) {
+                boost::system::error_code error;
+                mSocket.send_to(
+                    ServicePacket(
+                        ServicePacket::PacketSizeConfirmation,
+                        static_cast<PacketHeader::ChannelIndex>(bytesCount)).buffers(),
+                    endpoint,
+                    0,
+                    error);
+            }
+            return;
+        }
+
+        signalServicePacketReceived(
+            endpoint,
+            datagram,
+            bytesCount);
+        return;
+    }
 
     try {
-        auto remoteNodeHandler = mRemoteNodesHandler.handler(mRemoteEndpointBuffer);
+        auto remoteNodeHandler = mRemoteNodesHandler.handler(endpoint);
         if (remoteNodeHandler->isBanned()) {
-            info() << bytesTransferred <<  "B \tRX  [ <= ] from "
-                   << mRemoteEndpointBuffer.address().to_string()
+            info() << bytesCount <<  "B \tRX  [ <= ] from "
+                   << endpoint.address().to_string()
                    << ". IGNORED!";
-
-            beginReceivingData();
             return;
-
-        } else {
+        }
 
 #ifdef DEBUG_LOG_NETWORK_COMMUNICATOR
-            if (mIncomingBuffer.size() > PacketHeader::kSize) {
-                const PacketHeader::ChannelIndex kChannelIndex =
-                    *(reinterpret_cast<PacketHeader::ChannelIndex*>(
-                        mIncomingBuffer.data() + PacketHeader::kChannelIndexOffset));
-
-                const PacketHeader::PacketIndex kPacketIndex =
-                    (*(reinterpret_cast<PacketHeader::PacketIndex*>(
-                        mIncomingBuffer.data() + PacketHeader::kPacketIndexOffset))) + 1;
-
-                const PacketHeader::TotalPacketsCount kTotalPacketsCount =
-                    *(reinterpret_cast<PacketHeader::TotalPacketsCount*>(
-                        mIncomingBuffer.data() + PacketHeader::kPacketsCountOffset));
-
-                debug()
-                    << setw(4) << bytesTransferred <<  "B RX [ <= ] "
-                    << mRemoteEndpointBuffer.address() << ":" << mRemoteEndpointBuffer.port() << "; "
-                    << "Channel: " << setw(9) << (kChannelIndex) << "; "
-                    << "Packet: " << setw(3) << static_cast<size_t>(kPacketIndex)
-                    << "/" << static_cast<size_t>(kTotalPacketsCount);
-            }
+        if (bytesCount > PacketHeader::kSize) {
+            const PacketHeader::ChannelIndex kChannelIndex =
+                *(reinterpret_cast<PacketHeader::ChannelIndex*>(
+                    datagram + PacketHeader::kChannelIndexOffset));
+
+            const PacketHeader::PacketIndex kPacketIndex =
+                (*(reinterpret_cast<PacketHeader::PacketIndex*>(
+                    datagram + PacketHeader::kPacketIndexOffset))) + 1;
+
+            const PacketHeader::TotalPacketsCount kTotalPacketsCount =
+                *(reinterpret_cast<PacketHeader::TotalPacketsCount*>(
+                    datagram + PacketHeader::kPacketsCountOffset));
+
+            debug()
+                << setw(4) << bytesCount <<  "B RX [ <= ] "
+                << endpoint.address() << ":" << endpoint.port() << "; "
+                << "Channel: " << setw(9) << (kChannelIndex) << "; "
+                << "Packet: " << setw(3) << static_cast<size_t>(kPacketIndex)
+                << "/" << static_cast<size_t>(kTotalPacketsCount);
+        }
 #endif
 
-            remoteNodeHandler->processIncomingBytesSequence(
-                mIncomingBuffer.data(),
-                bytesTransferred);
-
-            // Sending all collected messages (if exists) for further processing.
-            for (;;) {
-                auto message = remoteNodeHandler->popNextMessage();
-                if (message != nullptr) {
-                    signalMessageParsed(message);
-                }
-                else {
-                    break;
-                }
+        remoteNodeHandler->processIncomingBytesSequence(
+            datagram,
+            bytesCount);
+
+        // Sending all collected messages (if exists) for further processing.
+        for (;;) {
+            auto message = remoteNodeHandler->popNextMessage();
+            if (message != nullptr) {
+                signalMessageParsed(message);
+            }
+            else {
+                break;
             }
         }
 
     } catch (exception &e) {
         error() << e.what();
     }
+}
 
+void IncomingMessagesHandler::restartReceivingAfterError(
+    const boost::system::error_code &errorMessage)
+    noexcept
+{
+    error() << "handleReceivedInfo: ASIO error: " << errorMessage.message();
 
-    // In all cases - messages receiving should be continued.
-    beginReceivingData();
+    // In case of error - wait for some period of time
+    // and then restart receiving messages.
+    mReceivingRestartTimeoutSeconds = mReceivingRestartTimeoutSeconds * 2;
+    mReceivingRestartTimer.expires_from_now(
+        chrono::seconds(
+            mReceivingRestartTimeoutSeconds));
+
+    mReceivingRestartTimer.async_wait([this] (const boost::system::error_code&) {
+        beginReceivingData();});
 }
 
 void IncomingMessagesHandler::rescheduleCleaning()
@@ -165,6 +300,22 @@ void IncomingMessagesHandler::rescheduleCleaning()
     });
 }
 
+void IncomingMessagesHandler::rescheduleMissingPacketsRequests()
+    noexcept
+{
+    const auto kCheckInterval = chrono::milliseconds(50);
+
+    mMissingPacketsRequestsTimer.expires_from_now(kCheckInterval);
+    mMissingPacketsRequestsTimer.async_wait([this] (const boost::system::error_code &error) {
+        if (error == boost::asio::error::operation_aborted) {
+            return;
+        }
+
+        this->mRemoteNodesHandler.requestMissingPackets();
+        this->rescheduleMissingPacketsRequests();
+    });
+}
+
 string IncomingMessagesHandler::logHeader()
     noexcept
 {
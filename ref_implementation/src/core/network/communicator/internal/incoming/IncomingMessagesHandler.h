@@ -11,12 +11,18 @@
 #define GEO_NETWORK_CLIENT_INCOMINGCONNECTIONSHANDLER_H
 
 #include "../common/Types.h"
+#include "../common/ServicePacket.hpp"
 #include "../../internal/incoming/IncomingNodesHandler.h"
 #include "../../../../common/exceptions/ValueError.h"
 #include "../../../../common/exceptions/ConflictError.h"
 
 #include <boost/asio/steady_timer.hpp>
 
+#ifdef LINUX
+#include <sys/socket.h>
+#include <sys/uio.h>
+#endif
+
 
 using namespace std;
 
@@ -25,6 +31,10 @@ class IncomingMessagesHandler {
 public:
     signals::signal<void(Message::Shared)> signalMessageParsed;
 
+    // Is emitted when the remote node responds with the service packet
+    // on the multi-packet message, that was sent from this node.
+    signals::signal<void(const UDPEndpoint&, const byte*, size_t)> signalServicePacketReceived;
+
 public:
     IncomingMessagesHandler(
         IOService &ioService,
@@ -41,9 +51,36 @@ protected:
         size_t bytesTransferred)
         noexcept;
 
+#ifdef LINUX
+    void handleSocketReadable(
+        const boost::system::error_code &error)
+        noexcept;
+
+    /**
+     * @returns count of datagrams, that was read from the socket in one recvmmsg() call.
+     * In case of error (except "no data available") - "error" would be set.
+     */
+    size_t receiveDatagramsBatch(
+        boost::system::error_code &error)
+        noexcept;
+#endif
+
+    void processDatagram(
+        const UDPEndpoint &endpoint,
+        byte *datagram,
+        const size_t bytesCount)
+        noexcept;
+
+    void restartReceivingAfterError(
+        const boost::system::error_code &error)
+        noexcept;
+
     void rescheduleCleaning()
         noexcept;
 
+    void rescheduleMissingPacketsRequests()
+        noexcept;
+
     static string logHeader()
         noexcept;
 
@@ -62,6 +99,13 @@ protected:
 protected:
     static constexpr const size_t kMaxIncomingBufferSize = Packet::kMaxSize * 2;
 
+    // Count of datagrams, that may be read from the socket in one recvmmsg() call.
+    static constexpr const size_t kMaxDatagramsInBatch = 32;
+
+    // Count of batches, that may be read on one socket readability event.
+    // Limits time, during which other handlers of the IO service are blocked on heavy incoming traffic.
+    static constexpr const size_t kMaxBatchesPerWakeup = 8;
+
 protected:
     UDPSocket &mSocket;
     IOService &mIOService;
@@ -70,10 +114,26 @@ protected:
     boost::array<byte, kMaxIncomingBufferSize> mIncomingBuffer;
     UDPEndpoint mRemoteEndpointBuffer;
 
+#ifdef LINUX
+    // Ring of preallocated buffers for the batched receiving.
+    // Each datagram of the batch is read into its own buffer, together with its source endpoint.
+    boost::array<boost::array<byte, kMaxIncomingBufferSize>, kMaxDatagramsInBatch> mIncomingBuffers;
+    boost::array<UDPEndpoint, kMaxDatagramsInBatch> mRemoteEndpointsBuffers;
+    boost::array<iovec, kMaxDatagramsInBatch> mIOVectors;
+    boost::array<mmsghdr, kMaxDatagramsInBatch> mMessagesHeaders;
+#endif
+
     MessagesParser mMessagesParser;
     IncomingNodesHandler mRemoteNodesHandler;
 
     boost::asio::deadline_timer mCleaningTimer;
+    boost::asio::steady_timer mMissingPacketsRequestsTimer;
+
+    // Receiving is restarted after a socket error with exponential back-off.
+    // Each handler (one per network worker) has its own timer and back-off,
+    // bound to the IO service of the worker.
+    boost::asio::steady_timer mReceivingRestartTimer;
+    uint32_t mReceivingRestartTimeoutSeconds;
 };
 
 #endif //GEO_NETWORK_CLIENT_INCOMINGCONNECTIONSHANDLER_H
@@ -11,10 +11,12 @@
 
 
 IncomingNodesHandler::IncomingNodesHandler(
+    UDPSocket &socket,
     MessagesParser &messagesParser,
     Logger &logger)
     noexcept :
 
+    mSocket(socket),
     mMessagesParser(messagesParser),
     mLog(logger)
 {}
@@ -35,6 +37,7 @@ IncomingRemoteNode* IncomingNodesHandler::handler (
             kEndpointKey,
             make_unique<IncomingRemoteNode>(
                 endpoint,
+                mSocket,
                 mMessagesParser,
                 mLog));
     }
@@ -115,6 +118,17 @@ void IncomingNodesHandler::removeOutdatedChannelsOfPresentEndpoints()
 #endif
 }
 
+/**
+ * Asks remote nodes to retransmit packets of the incomplete messages.
+ */
+void IncomingNodesHandler::requestMissingPackets()
+{
+    const auto kNow = chrono::steady_clock::now();
+    for (const auto &indexAndHandler : mNodes) {
+        indexAndHandler.second->requestMissingPackets(kNow);
+    }
+}
+
 /**
  * Returns 8 bytes unsigned interger,
  * where first 4 bytes - are IPv4 address,
@@ -29,6 +29,7 @@ using namespace std;
 class IncomingNodesHandler {
 public:
     IncomingNodesHandler(
+        UDPSocket &socket,
         MessagesParser &messagesParser,
         Logger &logger)
         noexcept;
@@ -41,6 +42,8 @@ public:
 
     void removeOutdatedChannelsOfPresentEndpoints();
 
+    void requestMissingPackets();
+
 protected:
     static uint64_t key(
         const UDPEndpoint &endpoint)
@@ -50,6 +53,7 @@ protected:
         noexcept;
 
 protected:
+    UDPSocket &mSocket;
     MessagesParser &mMessagesParser;
     Logger &mLog;
 
@@ -12,11 +12,15 @@
 
 IncomingRemoteNode::IncomingRemoteNode(
     const UDPEndpoint &endpoint,
+    UDPSocket &socket,
     MessagesParser &messagesParser,
     Logger &logger)
     noexcept:
 
     mEndpoint(endpoint),
+    mSocket(socket),
+    mReservedBytesCount(0),
+    mRecentlyCollectedChannelsCount(0),
     mMessagesParser(messagesParser),
     mLog(logger)
 {}
@@ -63,7 +67,6 @@ void IncomingRemoteNode::dropOutdatedChannels()
     // Forward list is used to not to remove elements of the map while iterating it.
     // All the obsolete channels would be removed at once after scanning;
     forward_list<PacketHeader::ChannelIndex> outdatedChannelsIndexes;
-    size_t totalOutdateChannels = 0;
 
     for (const auto &indexAndChannel : mChannels) {
         if (kNow - indexAndChannel.second->lastUpdated() > kMaxTTL) {
@@ -75,23 +78,15 @@ void IncomingRemoteNode::dropOutdatedChannels()
 #endif
 
             outdatedChannelsIndexes.push_front(kChannelIndex);
-            ++totalOutdateChannels;
         }
     }
 
-    if (totalOutdateChannels == mChannels.size()) {
-        // In case if all channels of the node are outdated -
-        // it would much more efficient to clear whoule map at once
-        // (with only one memory reallocation)
-        mChannels.clear();
+    for (const auto kOutdateChannelsIndex : outdatedChannelsIndexes) {
+        releaseChannel(kOutdateChannelsIndex);
+    }
 
-    } else {
-        // Prevent elements reallocation on removing.
-        mChannels.reserve(mChannels.size());
-        for (const auto kOutdateChannelsIndex : outdatedChannelsIndexes) {
-            mChannels.erase(kOutdateChannelsIndex);
-        }
-        mChannels.rehash(mChannels.size());
+    if (mChannels.empty()) {
+        mChannels.shrink_to_fit();
     }
 }
 
@@ -106,184 +101,252 @@ const TimePoint& IncomingRemoteNode::lastUpdated() const
     return mLastUpdated;
 }
 
+/**
+ * Processes one datagram, received from the remote node.
+ *
+ * UDP preserves datagrams boundaries, so each datagram is expected to contain exactly one packet.
+ * Packet is parsed in place and its content is copied directly into the message buffer of the corresponding channel.
+ * Datagrams that are broken are simply dropped: they can't affect the packets, that would be received after them.
+ */
 void IncomingRemoteNode::processIncomingBytesSequence (
     const byte *bytes,
     const size_t count)
     noexcept
 {
-    if (count == 0) {
+    if (count < Packet::kMinSize) {
         return;
     }
 
-    while (mBuffer.capacity() < (mBuffer.size() + count)) {
+    // Header parsing
+    PacketHeader::PacketSize headerAndBodyBytesCount;
+    memcpy(&headerAndBodyBytesCount, bytes + PacketHeader::kPacketSizeOffset, sizeof(headerAndBodyBytesCount));
 
-#ifdef LINUX
-        // Reserve one more memory page (often 4096 B)
-        //
-        // There is no reason, to reserve less than one memory page:
-        // internally reserve will call malloc(),
-        // and it would allocate at least one memory page.
-        // In case if less than one memory page would be allocated -
-        // malloc should be called more often and it would decrease performance.
-        mBuffer.reserve(
-            mBuffer.capacity() + static_cast<size_t>(getpagesize()));
-        continue;
-#endif
+    const bool kIsCRC32C = (headerAndBodyBytesCount & PacketHeader::kCRC32CFlag) != 0;
+    headerAndBodyBytesCount &= PacketHeader::kPacketSizeMask;
 
-#ifdef MAC_OS
-        // It is expected than one memory page is 4096B.
-        // ToDo: find way to get memory page size on the Mac.
-        mBuffer.reserve(
-            mBuffer.capacity() + 4096);
-        continue;
-#endif
+    PacketHeader::ChannelIndex channelIndex;
+    memcpy(&channelIndex, bytes + PacketHeader::kChannelIndexOffset, sizeof(channelIndex));
+
+    const PacketHeader::PacketIndex kPacketIndex = bytes[PacketHeader::kPacketIndexOffset];
+    const PacketHeader::TotalPacketsCount kTotalPacketsCount = bytes[PacketHeader::kPacketsCountOffset];
 
-        // ...
-        // Other OS types should go here
-        // ...
+    debug()
+        << "Packet received. Remote endpoint - " << mEndpoint
+        << "; Channel index - " << int(channelIndex)
+        << "; Packet index - " << int(kPacketIndex)
+        << "; Total packets count in message - " << int(kTotalPacketsCount);
+
+    if (headerAndBodyBytesCount != count
+        || headerAndBodyBytesCount > Packet::kMaxSize) {
+
+        // Packet bytes count field must be equal to the datagram size,
+        // and can't be greater than max packet size.
+        // Otherwise - the datagram is broken (or obfuscated).
+        //
+        // ToDo: ban the node in case if such datagrams are received too often.
+        return;
+    }
 
+    if (kTotalPacketsCount == 0
+        || kPacketIndex >= kTotalPacketsCount) {
 
-        // Default reservation
-        mBuffer.reserve(
-            mBuffer.capacity() + 1024);
+        // Invalid packet header.
+        // ToDo: ban the node.
+        return;
     }
 
+    const auto kNow = chrono::steady_clock::now();
+    if (isChannelRecentlyCollected(channelIndex, kNow)) {
+        // Late retransmitted packet of the message, that was already collected.
+        return;
+    }
 
-    // Appending received data to the previously received
-    mBuffer.resize(mBuffer.size() + count);
-    memcpy(&mBuffer[mBuffer.size() - count], bytes, count * sizeof(byte));
+    try {
+        auto channel = findChannel(channelIndex);
+        channel->reservePacketsSlots(kTotalPacketsCount);
+        channel->addPacket(
+            kPacketIndex,
+            bytes + PacketHeader::kSize,
+            headerAndBodyBytesCount - PacketHeader::kSize,
+            kIsCRC32C);
+
+        const auto kFlagAndMessage = channel->tryCollectMessage();
+        if (kFlagAndMessage.first) {
+            mCollectedMessages.push_back(kFlagAndMessage.second);
+
+            // Sender keeps multi-packet messages for the possible retransmission.
+            // Acknowledgement allows it to release the message immediately.
+            if (kTotalPacketsCount > 1) {
+                auto &collectedChannel =
+                    mRecentlyCollectedChannels[mRecentlyCollectedChannelsCount % kRecentlyCollectedChannelsCount];
+                collectedChannel.index = channelIndex;
+                collectedChannel.collected = kNow;
+                ++mRecentlyCollectedChannelsCount;
+
+                sendServicePacket(
+                    ServicePacket(
+                        ServicePacket::Acknowledgement,
+                        channelIndex));
+            }
+        }
 
-    size_t totalMessagesCollected = 0;
-    while (true) {
-        bool shouldTryCollectOneMorePacket = tryCollectNextPacket();
-        if (not shouldTryCollectOneMorePacket) {
-            break;
+        // Channel is cleared by itself, when all the packets of the message was received
+        // (regardless of the message was collected or it was broken).
+        if (channel->expectedPacketsCount() == 0) {
+            releaseChannel(channelIndex);
         }
 
-        ++totalMessagesCollected;
-    }
+    } catch (exception &e) {
+        mLog.warning("Communicator / IncomingRemoteNode")
+            << "Packet can't be processed. Details: " << e.what();
 
-    if (totalMessagesCollected > 0) {
-        // Free the unused buffer space.
-        mBuffer.shrink_to_fit();
+        // Channel, that has no packets (for example, was opened by the rejected packet),
+        // must not occupy the slot of the incomplete channel.
+        const auto kChannel = mChannels.find(channelIndex);
+        if (kChannel != mChannels.end() and kChannel->second->receivedPacketsCount() == 0) {
+            releaseChannel(channelIndex);
+        }
     }
 }
 
-/*
- * Returns "true" if packet was collected and one more collect attempt may be done.
- * Otherwise - returns "false";
+/**
+ * @throws OverflowError in case if the channel doesn't exist yet,
+ * and the remote node already has the max count of the incomplete channels.
  */
-bool IncomingRemoteNode::tryCollectNextPacket ()
+IncomingChannel* IncomingRemoteNode::findChannel(
+    const PacketHeader::ChannelIndex index)
 {
-    if (mBuffer.size() < Packet::kMinSize) {
-        return false;
+    auto channel = mChannels.find(index);
+    if (channel != mChannels.end()) {
+        return channel->second.get();
     }
 
-    // Header parsing
-    const PacketHeader::PacketSize kHeaderAndBodyBytesCount =
-        *(reinterpret_cast<PacketHeader::PacketSize*>(
-            mBuffer.data()));
-
-    const PacketHeader::ChannelIndex kChannelIndex =
-        *(reinterpret_cast<PacketHeader::ChannelIndex*>(
-            mBuffer.data() + PacketHeader::kChannelIndexOffset));
-
-    const PacketHeader::PacketIndex kPacketIndex =
-        *(reinterpret_cast<PacketHeader::PacketIndex*>(
-            mBuffer.data() + PacketHeader::kPacketIndexOffset));
+    if (mChannels.size() >= kMaxIncompleteChannelsCount) {
+        throw OverflowError(
+            "IncomingRemoteNode::findChannel: "
+            "too many incomplete channels are opened by the remote node.");
+    }
 
-    const PacketHeader::TotalPacketsCount kTotalPacketsCount =
-        *(reinterpret_cast<PacketHeader::TotalPacketsCount*>(
-            mBuffer.data() + PacketHeader::kPacketsCountOffset));
+    IncomingChannel::Unique newChannel;
+    if (not mFreeChannels.empty()) {
+        newChannel = move(mFreeChannels.back());
+        mFreeChannels.pop_back();
 
-    debug()
-        << "Packet received. Remote endpoint - " << mEndpoint
-        << "; Channel index - " << int(kChannelIndex)
-        << "; Packet index - " << int(kPacketIndex)
-        << "; Total packets count in message - " << int(kTotalPacketsCount);
+    } else {
+        newChannel = make_unique<IncomingChannel>(
+            mMessagesParser,
+            mLastUpdated,
+            mReservedBytesCount,
+            mLog);
+    }
 
-    if (kHeaderAndBodyBytesCount < Packet::kMinSize
-        || kHeaderAndBodyBytesCount > Packet::kMaxSize) {
+    return mChannels.emplace(
+        index,
+        move(newChannel)).first->second.get();
+}
 
-        // Packet bytes count field can't be less than minimal header size,
-        // and can't be greater than max packet size.
-        //
-        // In case when this field is invalid - it is impossible to know how many bytes are in current packet,
-        // and where is the first byte of next one packet. The whole bytes sequence must be dropped,
-        // and the packets exchange must be started again.
-        //
-        // To prevent possible vulnerability with infinite random bytes sequence (dos) -
-        // all the network data from this endpoint must be rejected for some period of time.
-        // This period of time must be exponentially increased if this error will not be eliminated
-        // on the next round.
+/**
+ * Removes channel from the active channels set.
+ * Channel itself would be reused for the next messages (up to several free channels are kept).
+ * Bytes, reserved by the channel, are returned to the remote node in any case.
+ */
+void IncomingRemoteNode::releaseChannel(
+    const PacketHeader::ChannelIndex index)
+    noexcept
+{
+    static const size_t kMaxFreeChannelsCount = 16;
 
-        dropEntireIncomingFlow();
+    auto channel = mChannels.find(index);
+    if (channel == mChannels.end()) {
+        return;
+    }
 
-        // ToDo: ban the node.
-        return false;
+    channel->second->clear();
+    if (mFreeChannels.size() < kMaxFreeChannelsCount) {
+        channel->second->releaseLargeBuffer();
+        mFreeChannels.push_back(move(channel->second));
     }
 
-    if (kTotalPacketsCount == 0
-        || kPacketIndex > kTotalPacketsCount) {
+    mChannels.erase(channel);
+}
 
-        // Invalid bytes flow occurred.
-        dropEntireIncomingFlow();
+/**
+ * Asks the sender to retransmit packets, that are missing in the incomplete channels.
+ * Only channels, that doesn't receive any packet for some time, are processed.
+ */
+void IncomingRemoteNode::requestMissingPackets(
+    const TimePoint &now)
+    noexcept
+{
+    for (const auto &indexAndChannel : mChannels) {
+        auto &channel = indexAndChannel.second;
+        if (not channel->isMissingPacketsRequestRequired(now)) {
+            continue;
+        }
 
-        // ToDo: ban the node.
-        return false;
-    }
+#ifdef DEBUG_LOG_NETWORK_COMMUNICATOR
+        debug() << "Missing packets of the channel " << indexAndChannel.first
+                << " are requested from the endpoint " << mEndpoint;
+#endif
 
-    if (mBuffer.size() < kHeaderAndBodyBytesCount) {
-        // There is no sufficient data was received yet.
-        // Can't start collecting packet.
-        return false;
-    }
+        sendServicePacket(
+            ServicePacket(
+                indexAndChannel.first,
+                channel->missingPackets()));
 
-    auto channel = findChannel(kChannelIndex);
-    channel->reservePacketsSlots(kTotalPacketsCount);
-    channel->addPacket(
-        kPacketIndex,
-        mBuffer.data() + PacketHeader::kSize,
-        kHeaderAndBodyBytesCount - PacketHeader::kSize);
-
-    // Cut bytes transferred to the packet from the buffer
-    mBuffer.erase(
-        mBuffer.cbegin(),
-        mBuffer.cbegin() + kHeaderAndBodyBytesCount);
-
-    const auto kFlagAndMessage = channel->tryCollectMessage();
-    if (kFlagAndMessage.first) {
-        mCollectedMessages.push_back(kFlagAndMessage.second);
+        channel->onMissingPacketsRequested(now);
     }
+}
 
-    // Return true if one more potential packet is present in buffer.
-    return mBuffer.size() >= Packet::kMinSize;
+bool IncomingRemoteNode::isChannelRecentlyCollected(
+    const PacketHeader::ChannelIndex index,
+    const TimePoint &now) const
+    noexcept
+{
+    const size_t kChannelsCount = mRecentlyCollectedChannelsCount < kRecentlyCollectedChannelsCount ?
+        mRecentlyCollectedChannelsCount : kRecentlyCollectedChannelsCount;
+    for (size_t position = 0; position < kChannelsCount; ++position) {
+        const auto &collectedChannel = mRecentlyCollectedChannels[position];
+        if (collectedChannel.index == index
+            and now - collectedChannel.collected <= kRecentlyCollectedChannelsTTL()) {
+            return true;
+        }
+    }
+    return false;
 }
 
-void IncomingRemoteNode::dropEntireIncomingFlow()
+/**
+ * @returns period during which packets of the collected channel are ignored.
+ * Packets are retransmitted only on the request of this node, so late packets of the collected message
+ * may arrive only during one round trip after the acknowledgement was sent.
+ */
+chrono::milliseconds IncomingRemoteNode::kRecentlyCollectedChannelsTTL()
+    noexcept
 {
-    // Note:
-    // Corresponding channel must not be cleared. The packet may be broken by the network, and not obfuscated.
-    // Current message would not collect and would be dropped anyway, but the packet may pointing to the channel that not belongs it.
-    // (in case if channel number was also modified).
-    // In case if the channel at which the packet points would be removed - other message may be broken.
-
-    mBuffer.clear();
-    mBuffer.shrink_to_fit();
+    static const chrono::milliseconds kTTL(1000);
+    return kTTL;
 }
 
-IncomingChannel* IncomingRemoteNode::findChannel(
-    const PacketHeader::ChannelIndex index)
+/**
+ * Service packets are small and are sent rarely,
+ * so they are sent synchronously (UDP socket never blocks for a long time).
+ */
+void IncomingRemoteNode::sendServicePacket(
+    const ServicePacket &packet)
+    noexcept
 {
-    if (mChannels.count(index) == 0)
-        mChannels.emplace(
-            index,
-            make_unique<IncomingChannel>(
-                mMessagesParser,
-                mLastUpdated,
-                mLog));
-
-    return mChannels[index].get();
+    boost::system::error_code error;
+    mSocket.send_to(
+        packet.buffers(),
+        mEndpoint,
+        0,
+        error);
+
+    if (error) {
+        mLog.warning("Communicator / IncomingRemoteNode")
+            << "Service packet can't be sent to the " << mEndpoint << ". "
+            << "Error code: " << error.value();
+    }
 }
 
 LoggerStream IncomingRemoteNode::debug() const
@@ -12,10 +12,12 @@
 
 #include "../common/Types.h"
 #include "../common/Packet.hpp"
+#include "../common/ServicePacket.hpp"
 #include "IncomingChannel.h"
 #include "MessageParser.h"
 
-#include <boost/unordered_map.hpp>
+#include <boost/container/flat_map.hpp>
+#include <boost/array.hpp>
 
 #include <vector>
 #include <forward_list>
@@ -28,6 +30,7 @@ public:
 public:
     IncomingRemoteNode(
         const UDPEndpoint &endpoint,
+        UDPSocket &socket,
         MessagesParser &messagesParser,
         Logger &logger)
         noexcept;
@@ -37,10 +40,6 @@ public:
         const size_t count)
         noexcept;
 
-    bool tryCollectNextPacket();
-
-    void dropEntireIncomingFlow();
-
     bool isBanned() const
         noexcept;
 
@@ -48,6 +47,10 @@ public:
 
     void dropOutdatedChannels();
 
+    void requestMissingPackets(
+        const TimePoint &now)
+        noexcept;
+
     const UDPEndpoint& endpoint() const
         noexcept;
 
@@ -57,24 +60,60 @@ protected:
     IncomingChannel* findChannel (
         const PacketHeader::ChannelIndex index);
 
+    void releaseChannel(
+        const PacketHeader::ChannelIndex index)
+        noexcept;
+
+    bool isChannelRecentlyCollected(
+        const PacketHeader::ChannelIndex index,
+        const TimePoint &now) const
+        noexcept;
+
+    void sendServicePacket(
+        const ServicePacket &packet)
+        noexcept;
+
     LoggerStream debug() const
         noexcept;
 
+protected:
+    struct CollectedChannel {
+        PacketHeader::ChannelIndex index;
+        TimePoint collected;
+    };
+
+    static chrono::milliseconds kRecentlyCollectedChannelsTTL()
+        noexcept;
+
+    // Count of the last collected channels, packets of which are ignored.
+    static const constexpr size_t kRecentlyCollectedChannelsCount = 16;
+
+    // Count of the incomplete channels, that may be opened by the remote node at once.
+    // Packets, that would open one more channel, are dropped.
+    static const constexpr size_t kMaxIncompleteChannelsCount = 64;
+
 protected:
     const UDPEndpoint mEndpoint;
+    UDPSocket &mSocket;
     TimePoint mLastUpdated;
 
-    boost::unordered_map<PacketHeader::ChannelIndex, IncomingChannel::Unique> mChannels;
+    // Bytes of the message buffers, that are reserved by the incomplete channels.
+    size_t mReservedBytesCount;
+
+    boost::container::flat_map<PacketHeader::ChannelIndex, IncomingChannel::Unique> mChannels;
 
+    // Channels, that have already collected their messages, are not destroyed,
+    // but are kept for the next messages (together with their message buffers).
+    vector<IncomingChannel::Unique> mFreeChannels;
 
-    // todo: ensure reserve usage
-    vector<byte> mBuffer;
+    // Packets, that are retransmitted by the sender, may arrive after the message was already collected.
+    // Such packets must not open the channel again (it would never be completed).
+    // Entries are expired by time: channel indexes of the sender may start from the beginning
+    // (for example, after the remote node restart), and its new messages must not be ignored.
+    boost::array<CollectedChannel, kRecentlyCollectedChannelsCount> mRecentlyCollectedChannels;
+    size_t mRecentlyCollectedChannelsCount;
 
-    // It is expected, that incoming bytes flow from the network, may containsseveral messages at once.
-    // There is non-zero probability, that whole bytes sequence would be processed in one read cycle,
-    // so there are several messages, may be collected at once.
-    //
-    // This container stores messages, that was collected on previous read cycles.
+    // This container stores messages, that was collected, but was not popped yet.
     vector<Message::Shared> mCollectedMessages;
 
     MessagesParser &mMessagesParser;
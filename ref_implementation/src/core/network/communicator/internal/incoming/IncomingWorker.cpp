@@ -0,0 +1,134 @@
+/**
+ * This file is part of GEO Project.
+ * It is subject to the license terms in the LICENSE.md file found in the top-level directory
+ * of this distribution and at https://github.com/GEO-Project/GEO-Project/blob/master/LICENSE.md
+ *
+ * No part of GEO Project, including this file, may be copied, modified, propagated, or distributed
+ * except according to the terms contained in the LICENSE.md file.
+ */
+
+#include "IncomingWorker.h"
+
+
+IncomingWorker::IncomingWorker(
+    IOService &coreIOService,
+    const Port port,
+    Logger &logger)
+    noexcept(false):
+
+    mCoreIOService(coreIOService),
+    mLog(logger),
+    mIOServiceWork(
+        make_unique<IOService::work>(mIOService)),
+    mSocket(
+        sharedPortSocket(
+            mIOService,
+            port)),
+    mIncomingMessagesHandler(
+        make_unique<IncomingMessagesHandler>(
+            mIOService,
+            *mSocket,
+            logger))
+{
+    mIncomingMessagesHandler->signalMessageParsed.connect(
+        boost::bind(
+            &IncomingWorker::onMessageParsed,
+            this,
+            _1));
+
+    mIncomingMessagesHandler->signalServicePacketReceived.connect(
+        boost::bind(
+            &IncomingWorker::onServicePacketReceived,
+            this,
+            _1,
+            _2,
+            _3));
+}
+
+IncomingWorker::~IncomingWorker()
+    noexcept
+{
+    mIOServiceWork.reset();
+    mIOService.stop();
+    if (mThread.joinable()) {
+        mThread.join();
+    }
+}
+
+void IncomingWorker::beginReceivingData()
+    noexcept
+{
+    if (mThread.joinable()) {
+        return;
+    }
+
+    mIncomingMessagesHandler->beginReceivingData();
+    mThread = thread([this] {
+        try {
+            mIOService.run();
+
+        } catch (exception &e) {
+            error() << "Worker stopped. Details: " << e.what();
+        }
+    });
+}
+
+void IncomingWorker::onMessageParsed(
+    Message::Shared message)
+    noexcept
+{
+    mCoreIOService.post([this, message] {
+        signalMessageParsed(message);
+    });
+}
+
+/**
+ * Service packet refers to the receive buffer of the worker, that would be reused by the next datagram,
+ * so it is copied before posting into the core thread.
+ */
+void IncomingWorker::onServicePacketReceived(
+    const UDPEndpoint &endpoint,
+    const byte *bytes,
+    const size_t bytesCount)
+    noexcept
+{
+    try {
+        auto packet = make_shared<vector<byte>>(bytes, bytes + bytesCount);
+        mCoreIOService.post([this, endpoint, packet] {
+            signalServicePacketReceived(
+                endpoint,
+                packet->data(),
+                packet->size());
+        });
+
+    } catch (exception &) {
+        // Service packets loss is tolerated by the protocol.
+    }
+}
+
+unique_ptr<UDPSocket> IncomingWorker::sharedPortSocket(
+    IOService &ioService,
+    const Port port)
+    noexcept(false)
+{
+    auto socket = make_unique<UDPSocket>(ioService);
+    socket->open(boost::asio::ip::udp::v4());
+
+#ifdef LINUX
+    using ReusePort = boost::asio::detail::socket_option::boolean<SOL_SOCKET, SO_REUSEPORT>;
+    socket->set_option(ReusePort(true));
+#endif
+
+    socket->bind(
+        UDPEndpoint(
+            boost::asio::ip::udp::v4(),
+            port));
+
+    return socket;
+}
+
+LoggerStream IncomingWorker::error() const
+    noexcept
+{
+    return mLog.error("Communicator / IncomingWorker");
+}
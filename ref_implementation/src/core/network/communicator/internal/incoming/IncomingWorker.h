@@ -0,0 +1,93 @@
+/**
+ * This file is part of GEO Project.
+ * It is subject to the license terms in the LICENSE.md file found in the top-level directory
+ * of this distribution and at https://github.com/GEO-Project/GEO-Project/blob/master/LICENSE.md
+ *
+ * No part of GEO Project, including this file, may be copied, modified, propagated, or distributed
+ * except according to the terms contained in the LICENSE.md file.
+ */
+
+#ifndef GEO_NETWORK_CLIENT_INCOMINGWORKER_H
+#define GEO_NETWORK_CLIENT_INCOMINGWORKER_H
+
+#include "../common/Types.h"
+#include "IncomingMessagesHandler.h"
+
+#include "../../../../logger/Logger.h"
+
+#include <thread>
+#include <vector>
+
+
+using namespace std;
+
+
+/**
+ * Network worker, that receives incoming messages in its own thread.
+ *
+ * Each worker owns separate IO service and separate UDP socket,
+ * that is bound to the same port as the communicator socket (SO_REUSEPORT).
+ * The kernel distributes incoming datagrams between the sockets of the port by the remote endpoint,
+ * so all packets of one remote node are always processed by the same worker.
+ *
+ * Receiving, packets reassembly, CRC checking and messages deserialization are done in the worker thread.
+ * Only ready messages (and received service packets) are posted into the core IO service,
+ * so all the signals of the worker are emitted in the core thread.
+ */
+class IncomingWorker {
+public:
+    signals::signal<void(Message::Shared)> signalMessageParsed;
+    signals::signal<void(const UDPEndpoint&, const byte*, size_t)> signalServicePacketReceived;
+
+public:
+    /**
+     * @throws boost::system::system_error in case if socket can't be bound to the port.
+     */
+    IncomingWorker(
+        IOService &coreIOService,
+        const Port port,
+        Logger &logger)
+        noexcept(false);
+
+    ~IncomingWorker()
+        noexcept;
+
+    void beginReceivingData()
+        noexcept;
+
+    /**
+     * @returns UDP socket, bound to the "port", that shares this port with other sockets of the process.
+     * @throws boost::system::system_error in case if socket can't be bound to the port.
+     */
+    static unique_ptr<UDPSocket> sharedPortSocket(
+        IOService &ioService,
+        const Port port)
+        noexcept(false);
+
+protected:
+    void onMessageParsed(
+        Message::Shared message)
+        noexcept;
+
+    void onServicePacketReceived(
+        const UDPEndpoint &endpoint,
+        const byte *bytes,
+        const size_t bytesCount)
+        noexcept;
+
+    LoggerStream error() const
+        noexcept;
+
+protected:
+    IOService &mCoreIOService;
+    Logger &mLog;
+
+    IOService mIOService;
+    unique_ptr<IOService::work> mIOServiceWork;
+    unique_ptr<UDPSocket> mSocket;
+    unique_ptr<IncomingMessagesHandler> mIncomingMessagesHandler;
+
+    thread mThread;
+};
+
+#endif //GEO_NETWORK_CLIENT_INCOMINGWORKER_H
@@ -25,201 +25,151 @@ pair<bool, Message::Shared> MessagesParser::processBytesSequence(
     }
 
     try {
+        // Compact amounts flag is processed by the message itself.
         const Message::SerializedType kMessageIdentifier =
-            *(reinterpret_cast<Message::SerializedType*>(buffer.get()));
+            *(reinterpret_cast<Message::SerializedType*>(buffer.get())) & Message::kTypeMask;
 
-        switch(kMessageIdentifier) {
+        const auto &kFactories = messagesFactories();
+        if (kMessageIdentifier >= kFactories.size() or kFactories[kMessageIdentifier] == nullptr) {
+            warning() << "processBytesSequence: "
+                << "Unexpected message identifier occurred (" << kMessageIdentifier << "). Message dropped.";
+            return messageInvalidOrIncomplete();
+        }
+
+        return make_pair(
+            true,
+            kFactories[kMessageIdentifier](buffer));
+
+    } catch (exception &) {
+        return messageInvalidOrIncomplete();
+    }
+}
+
+MessagesParser &MessagesParser::operator=(
+    const MessagesParser &other)
+    noexcept
+{
+    mLog = other.mLog;
+    return *this;
+}
+
+pair<bool, Message::Shared> MessagesParser::messageInvalidOrIncomplete()
+{
+    return make_pair(
+        false,
+        Message::Shared(nullptr));
+}
+
+const vector<MessagesParser::MessageFactory> &MessagesParser::messagesFactories()
+{
+    static const vector<MessageFactory> kFactories = [] {
+        vector<MessageFactory> factories;
+        auto registerFactory = [&factories] (
+            const Message::MessageType messageType,
+            MessageFactory factory) {
+
+            if (factories.size() <= messageType) {
+                factories.resize(messageType + 1, nullptr);
+            }
+            factories[messageType] = factory;
+        };
 
         /*
          * System messages
          */
-        case Message::System_Confirmation:
-            return messageCollected<ConfirmationMessage>(buffer);
-
+        registerFactory(Message::System_Confirmation, &constructMessage<ConfirmationMessage>);
 
         /*
          * Trust lines messages
          */
-        case Message::TrustLines_SetIncoming:
-            return messageCollected<SetIncomingTrustLineMessage>(buffer);
-
-        case Message::TrustLines_SetIncomingFromGateway:
-            return messageCollected<SetIncomingTrustLineFromGatewayMessage>(buffer);
-
-        case Message::TrustLines_CloseOutgoing:
-            return messageCollected<CloseOutgoingTrustLineMessage>(buffer);
-
+        registerFactory(Message::TrustLines_SetIncoming, &constructMessage<SetIncomingTrustLineMessage>);
+        registerFactory(Message::TrustLines_SetIncomingFromGateway, &constructMessage<SetIncomingTrustLineFromGatewayMessage>);
+        registerFactory(Message::TrustLines_CloseOutgoing, &constructMessage<CloseOutgoingTrustLineMessage>);
 
         /*
          * Payment operations messages
          */
-        case Message::Payments_CoordinatorReservationRequest:
-            return messageCollected<CoordinatorReservationRequestMessage>(buffer);
-
-        case Message::Payments_CoordinatorReservationResponse:
-            return messageCollected<CoordinatorReservationResponseMessage>(buffer);
-
-        case Message::Payments_ReceiverInitPaymentRequest:
-            return messageCollected<ReceiverInitPaymentRequestMessage>(buffer);
-
-        case Message::Payments_ReceiverInitPaymentResponse:
-            return messageCollected<ReceiverInitPaymentResponseMessage>(buffer);
-
-        case Message::Payments_IntermediateNodeReservationRequest:
-            return messageCollected<IntermediateNodeReservationRequestMessage>(buffer);
-
-        case Message::Payments_IntermediateNodeReservationResponse:
-            return messageCollected<IntermediateNodeReservationResponseMessage>(buffer);
-
-        case Message::Payments_CoordinatorCycleReservationRequest:
-            return messageCollected<CoordinatorCycleReservationRequestMessage>(buffer);
-
-        case Message::Payments_CoordinatorCycleReservationResponse:
-            return messageCollected<CoordinatorCycleReservationResponseMessage>(buffer);
-
-        case Message::Payments_IntermediateNodeCycleReservationRequest:
-            return messageCollected<IntermediateNodeCycleReservationRequestMessage>(buffer);
-
-        case Message::Payments_IntermediateNodeCycleReservationResponse:
-            return messageCollected<IntermediateNodeCycleReservationResponseMessage>(buffer);
-
-        case Message::Payments_ParticipantsVotes:
-            return messageCollected<ParticipantsVotesMessage>(buffer);
-
-        case Message::Payments_FinalPathConfiguration:
-            return messageCollected<FinalPathConfigurationMessage>(buffer);
-
-        case Message::Payments_FinalPathCycleConfiguration:
-            return messageCollected<FinalPathCycleConfigurationMessage>(buffer);
-
-        case Message::Payments_FinalAmountsConfiguration:
-            return messageCollected<FinalAmountsConfigurationMessage>(buffer);
-
-        case Message::Payments_FinalAmountsConfigurationResponse:
-            return messageCollected<FinalAmountsConfigurationResponseMessage>(buffer);
-
-        case Message::Payments_TTLProlongationRequest:
-            return messageCollected<TTLProlongationRequestMessage>(buffer);
-
-        case Message::Payments_TTLProlongationResponse:
-            return messageCollected<TTLProlongationResponseMessage>(buffer);
-
-        case Message::Payments_VotesStatusRequest:
-            return messageCollected<VotesStatusRequestMessage>(buffer);
-
-        case Message::Payments_ReservationsInRelationToNode:
-            return messageCollected<ReservationsInRelationToNodeMessage>(buffer);
-
+        registerFactory(Message::Payments_CoordinatorReservationRequest, &constructPooledMessage<CoordinatorReservationRequestMessage>);
+        registerFactory(Message::Payments_CoordinatorReservationResponse, &constructPooledMessage<CoordinatorReservationResponseMessage>);
+        registerFactory(Message::Payments_ReceiverInitPaymentRequest, &constructMessage<ReceiverInitPaymentRequestMessage>);
+        registerFactory(Message::Payments_ReceiverInitPaymentResponse, &constructMessage<ReceiverInitPaymentResponseMessage>);
+        registerFactory(Message::Payments_IntermediateNodeReservationRequest, &constructPooledMessage<IntermediateNodeReservationRequestMessage>);
+        registerFactory(Message::Payments_IntermediateNodeReservationResponse, &constructPooledMessage<IntermediateNodeReservationResponseMessage>);
+        registerFactory(Message::Payments_CoordinatorCycleReservationRequest, &constructPooledMessage<CoordinatorCycleReservationRequestMessage>);
+        registerFactory(Message::Payments_CoordinatorCycleReservationResponse, &constructPooledMessage<CoordinatorCycleReservationResponseMessage>);
+        registerFactory(Message::Payments_IntermediateNodeCycleReservationRequest, &constructPooledMessage<IntermediateNodeCycleReservationRequestMessage>);
+        registerFactory(Message::Payments_IntermediateNodeCycleReservationResponse, &constructPooledMessage<IntermediateNodeCycleReservationResponseMessage>);
+        registerFactory(Message::Payments_ParticipantsVotes, &constructPooledMessage<ParticipantsVotesMessage>);
+        registerFactory(Message::Payments_FinalPathConfiguration, &constructMessage<FinalPathConfigurationMessage>);
+        registerFactory(Message::Payments_FinalPathCycleConfiguration, &constructMessage<FinalPathCycleConfigurationMessage>);
+        registerFactory(Message::Payments_FinalAmountsConfiguration, &constructMessage<FinalAmountsConfigurationMessage>);
+        registerFactory(Message::Payments_FinalAmountsConfigurationResponse, &constructMessage<FinalAmountsConfigurationResponseMessage>);
+        registerFactory(Message::Payments_TTLProlongationRequest, &constructMessage<TTLProlongationRequestMessage>);
+        registerFactory(Message::Payments_TTLProlongationResponse, &constructMessage<TTLProlongationResponseMessage>);
+        registerFactory(Message::Payments_VotesStatusRequest, &constructPooledMessage<VotesStatusRequestMessage>);
+        registerFactory(Message::Payments_ReservationsInRelationToNode, &constructMessage<ReservationsInRelationToNodeMessage>);
 
         /*
          * Cycles processing messages
          */
-        case Message::Cycles_SixNodesMiddleware:
-            return messageCollected<CyclesSixNodesInBetweenMessage>(buffer);
-
-        case Message::Cycles_FiveNodesMiddleware:
-            return messageCollected<CyclesFiveNodesInBetweenMessage>(buffer);
-
-        case Message::Cycles_SixNodesBoundary:
-            return messageCollected<CyclesSixNodesBoundaryMessage>(buffer);
-
-        case Message::Cycles_FiveNodesBoundary:
-            return messageCollected<CyclesFiveNodesBoundaryMessage>(buffer);
-
-        case Message::Cycles_ThreeNodesBalancesResponse:
-            return messageCollected<CyclesThreeNodesBalancesResponseMessage>(buffer);
-
-        case Message::Cycles_FourNodesBalancesRequest:
-            return messageCollected<CyclesFourNodesBalancesRequestMessage>(buffer);
-
-        case Message::Cycles_FourNodesBalancesResponse:
-            return messageCollected<CyclesFourNodesBalancesResponseMessage>(buffer);
-
-        case Message::Cycles_ThreeNodesBalancesRequest:
-            return messageCollected<CyclesThreeNodesBalancesRequestMessage>(buffer);
-
+        registerFactory(Message::Cycles_SixNodesMiddleware, &constructMessage<CyclesSixNodesInBetweenMessage>);
+        registerFactory(Message::Cycles_FiveNodesMiddleware, &constructMessage<CyclesFiveNodesInBetweenMessage>);
+        registerFactory(Message::Cycles_SixNodesBoundary, &constructMessage<CyclesSixNodesBoundaryMessage>);
+        registerFactory(Message::Cycles_FiveNodesBoundary, &constructMessage<CyclesFiveNodesBoundaryMessage>);
+        registerFactory(Message::Cycles_ThreeNodesBalancesResponse, &constructMessage<CyclesThreeNodesBalancesResponseMessage>);
+        registerFactory(Message::Cycles_FourNodesBalancesRequest, &constructMessage<CyclesFourNodesBalancesRequestMessage>);
+        registerFactory(Message::Cycles_FourNodesBalancesResponse, &constructMessage<CyclesFourNodesBalancesResponseMessage>);
+        registerFactory(Message::Cycles_ThreeNodesBalancesRequest, &constructMessage<CyclesThreeNodesBalancesRequestMessage>);
 
         /*
          * Max flow calculation messages
          */
-        case Message::MaxFlow_InitiateCalculation:
-            return messageCollected<InitiateMaxFlowCalculationMessage>(buffer);
-
-        case Message::MaxFlow_ResultMaxFlowCalculation:
-            return messageCollected<ResultMaxFlowCalculationMessage>(buffer);
-
-        case Message::MaxFlow_ResultMaxFlowCalculationFromGateway:
-            return messageCollected<ResultMaxFlowCalculationGatewayMessage>(buffer);
-
-        case Message::MaxFlow_CalculationSourceFirstLevel:
-            return messageCollected<MaxFlowCalculationSourceFstLevelMessage>(buffer);
-
-        case Message::MaxFlow_CalculationTargetFirstLevel:
-            return messageCollected<MaxFlowCalculationTargetFstLevelMessage>(buffer);
-
-        case Message::MaxFlow_CalculationSourceSecondLevel:
-            return messageCollected<MaxFlowCalculationSourceSndLevelMessage>(buffer);
-
-        case Message::MaxFlow_CalculationTargetSecondLevel:
-            return messageCollected<MaxFlowCalculationTargetSndLevelMessage>(buffer);
+        registerFactory(Message::MaxFlow_InitiateCalculation, &constructMessage<InitiateMaxFlowCalculationMessage>);
+        registerFactory(Message::MaxFlow_ResultMaxFlowCalculation, &constructMessage<ResultMaxFlowCalculationMessage>);
+        registerFactory(Message::MaxFlow_ResultMaxFlowCalculationFromGateway, &constructMessage<ResultMaxFlowCalculationGatewayMessage>);
+        registerFactory(Message::MaxFlow_CalculationSourceFirstLevel, &constructMessage<MaxFlowCalculationSourceFstLevelMessage>);
+        registerFactory(Message::MaxFlow_CalculationTargetFirstLevel, &constructMessage<MaxFlowCalculationTargetFstLevelMessage>);
+        registerFactory(Message::MaxFlow_CalculationSourceSecondLevel, &constructMessage<MaxFlowCalculationSourceSndLevelMessage>);
+        registerFactory(Message::MaxFlow_CalculationTargetSecondLevel, &constructMessage<MaxFlowCalculationTargetSndLevelMessage>);
 
         /*
-         * RoutingTables
+         * Routing tables messages
          */
-        case Message::RoutingTableRequest:
-            return messageCollected<RoutingTableRequestMessage>(buffer);
-        case Message::RoutingTableResponse:
-            return messageCollected<RoutingTableResponseMessage>(buffer);
+        registerFactory(Message::RoutingTableRequest, &constructMessage<RoutingTableRequestMessage>);
+        registerFactory(Message::RoutingTableResponse, &constructMessage<RoutingTableResponseMessage>);
 
         /*
-         * Gateway notification Messages
+         * Gateway notification messages
          */
-        case Message::GatewayNotification:
-            return messageCollected<GatewayNotificationMessage>(buffer);
+        registerFactory(Message::GatewayNotification, &constructMessage<GatewayNotificationMessage>);
 
 #ifdef DEBUG
         /*
          * Debug messages
          */
-        case Message::Debug:
-            return messageCollected<DebugMessage>(buffer);
+        registerFactory(Message::Debug, &constructMessage<DebugMessage>);
 #endif
 
-        default: {
-            warning() << "processBytesSequence: "
-                << "Unexpected message identifier occurred (" << kMessageIdentifier << "). Message dropped.";
-            return messageInvalidOrIncomplete();
-        }
-
-        }
+        return factories;
+    }();
 
-    } catch (exception &) {
-        return messageInvalidOrIncomplete();
-    }
+    return kFactories;
 }
 
-MessagesParser &MessagesParser::operator=(
-    const MessagesParser &other)
-    noexcept
-{
-    mLog = other.mLog;
-}
-
-pair<bool, Message::Shared> MessagesParser::messageInvalidOrIncomplete()
+template <class MessageType>
+Message::Shared MessagesParser::constructMessage(
+    BytesShared buffer)
 {
-    return make_pair(
-        false,
-        Message::Shared(nullptr));
+    return make_shared<MessageType>(buffer);
 }
 
-template <class CollectedMessageType>
-pair<bool, Message::Shared> MessagesParser::messageCollected(
-    CollectedMessageType message) const
+template <class MessageType>
+Message::Shared MessagesParser::constructPooledMessage(
+    BytesShared buffer)
 {
-    return make_pair(
-        true,
-        static_pointer_cast<Message>(
-            make_shared<CollectedMessageType>(message)));
+    return allocate_shared<MessageType>(
+        boost::fast_pool_allocator<MessageType>(),
+        buffer);
 }
 
 string MessagesParser::logHeader()
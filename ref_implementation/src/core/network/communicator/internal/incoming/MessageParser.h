@@ -66,12 +66,22 @@
 
 #include "../../../../logger/Logger.h"
 
+#include <boost/pool/pool_alloc.hpp>
+
 #include <utility>
+#include <vector>
 
 
 using namespace std;
 
 
+/**
+ * Deserializes incoming messages.
+ *
+ * Messages are built by the factories, registered in the table, indexed by the message type identifier,
+ * so the parsing of each message is one table lookup and one (in place) construction.
+ * Messages of the hot types (payments reservations and votes) are allocated from the per-type memory pools.
+ */
 class MessagesParser {
 public:
     MessagesParser(
@@ -90,12 +100,29 @@ protected:
     const size_t kMessageIdentifierSize = 2;
     const size_t kMinimalMessageSize = kMessageIdentifierSize + 1;
 
+protected:
+    typedef Message::Shared (*MessageFactory)(BytesShared);
+
 protected:
     pair<bool, Message::Shared> messageInvalidOrIncomplete();
 
-    template <class CollectedMessageType>
-    pair<bool, Message::Shared> messageCollected(
-        CollectedMessageType message) const;
+    /**
+     * @returns table of the messages factories, indexed by the message type identifier.
+     * Table is built once, on the first call, and is shared by all the parsers
+     * (including the parsers of the network workers).
+     */
+    static const vector<MessageFactory> &messagesFactories();
+
+    template <class MessageType>
+    static Message::Shared constructMessage(
+        BytesShared buffer);
+
+    /**
+     * Pools are thread safe: messages, parsed by the network workers, are released in the core thread.
+     */
+    template <class MessageType>
+    static Message::Shared constructPooledMessage(
+        BytesShared buffer);
 
 protected:
     static string logHeader()
@@ -0,0 +1,231 @@
+/**
+ * This file is part of GEO Project.
+ * It is subject to the license terms in the LICENSE.md file found in the top-level directory
+ * of this distribution and at https://github.com/GEO-Project/GEO-Project/blob/master/LICENSE.md
+ *
+ * No part of GEO Project, including this file, may be copied, modified, propagated, or distributed
+ * except according to the terms contained in the LICENSE.md file.
+ */
+
+#include "BatchedPacketsSender.h"
+#include "OutgoingRemoteNode.h"
+
+#include <algorithm>
+
+
+BatchedPacketsSender::BatchedPacketsSender(
+    UDPSocket &socket,
+    Logger &logger)
+    noexcept :
+
+    mSocket(socket),
+    mLog(logger),
+    mWritabilityAwaited(false)
+{
+    mBatchNodes.reserve(kMaxBatchSize);
+    mBatchNodesPacketsCounts.reserve(kMaxBatchSize);
+}
+
+void BatchedPacketsSender::scheduleSending(
+    OutgoingRemoteNode *node)
+    noexcept
+{
+    mReadyNodes.push_back(node);
+    beginWaitingForWritability();
+}
+
+void BatchedPacketsSender::cancelSending(
+    OutgoingRemoteNode *node)
+    noexcept
+{
+    mReadyNodes.erase(
+        remove(mReadyNodes.begin(), mReadyNodes.end(), node),
+        mReadyNodes.end());
+}
+
+void BatchedPacketsSender::sendServicePacket(
+    const ServicePacket &packet,
+    const UDPEndpoint &endpoint)
+    noexcept
+{
+    boost::system::error_code error;
+    mSocket.send_to(packet.buffers(), endpoint, 0, error);
+    if (error and error != boost::asio::error::would_block) {
+        errors()
+            << "BatchedPacketsSender::sendServicePacket: "
+            << "Service packet can't be sent. "
+            << "Error code: " << error.value();
+    }
+}
+
+void BatchedPacketsSender::beginWaitingForWritability()
+    noexcept
+{
+    if (mWritabilityAwaited or mReadyNodes.empty()) {
+        return;
+    }
+
+    mWritabilityAwaited = true;
+    mSocket.async_wait(
+        UDPSocket::wait_write,
+        [this] (const boost::system::error_code &error) {
+            mWritabilityAwaited = false;
+            if (error) {
+                errors()
+                    << "BatchedPacketsSender::beginWaitingForWritability: "
+                    << "Socket can't be awaited for the writing. "
+                    << "Error code: " << error.value();
+            }
+
+            sendNextBatch();
+        });
+}
+
+void BatchedPacketsSender::sendNextBatch()
+    noexcept
+{
+    mBatchNodes.clear();
+    mBatchNodesPacketsCounts.clear();
+
+    // Ready nodes are served in order of their registration.
+    // Nodes that was not included into this batch would stay in the ready list.
+    while (not mReadyNodes.empty() and mBatchNodes.size() < kMaxBatchSize) {
+        mBatchNodes.push_back(mReadyNodes.front());
+        mBatchNodesPacketsCounts.push_back(0);
+        mReadyNodes.pop_front();
+    }
+
+    // Packets are collected one per node at a time,
+    // so one big message would not block other nodes for the whole batch.
+    size_t packetsCount = 0;
+    for (bool packetsCollected = true; packetsCollected and packetsCount < kMaxBatchSize; ) {
+        packetsCollected = false;
+
+        for (size_t nodeNumber = 0; nodeNumber < mBatchNodes.size(); ++nodeNumber) {
+            if (packetsCount == kMaxBatchSize) {
+                break;
+            }
+
+            auto node = mBatchNodes[nodeNumber];
+            auto &nodePacketsCount = mBatchNodesPacketsCounts[nodeNumber];
+            if (nodePacketsCount == node->packetsAvailableForSending()) {
+                continue;
+            }
+
+            mBatchPackets[packetsCount] = &node->packet(nodePacketsCount);
+            mBatchPacketsOwners[packetsCount] = nodeNumber;
+            ++nodePacketsCount;
+            ++packetsCount;
+            packetsCollected = true;
+        }
+    }
+
+    boost::system::error_code error;
+    auto packetsSent = transferBatch(packetsCount, error);
+    if (error) {
+        // The first packet of the batch was rejected by the kernel.
+        // It must be dropped, otherwise it would block the whole queue.
+        // (the same behaviour as in the case of the async_send_to error).
+        ++packetsSent;
+    }
+
+    // Packets counts are reused to report to each node how many of its packets was processed.
+    fill(mBatchNodesPacketsCounts.begin(), mBatchNodesPacketsCounts.end(), 0);
+    for (size_t packetNumber = 0; packetNumber < packetsSent; ++packetNumber) {
+        mBatchNodesPacketsCounts[mBatchPacketsOwners[packetNumber]] += 1;
+    }
+
+    // Nodes may register themselves back into the ready list (or schedule delayed sending),
+    // so the waiting flag must not be set at this moment.
+    for (size_t nodeNumber = 0; nodeNumber < mBatchNodes.size(); ++nodeNumber) {
+        mBatchNodes[nodeNumber]->onPacketsSent(
+            mBatchNodesPacketsCounts[nodeNumber],
+            error);
+    }
+
+    beginWaitingForWritability();
+}
+
+size_t BatchedPacketsSender::transferBatch(
+    const size_t packetsCount,
+    boost::system::error_code &error)
+    noexcept
+{
+    if (packetsCount == 0) {
+        return 0;
+    }
+
+#ifdef LINUX
+    static const auto kBuffersPerPacket = OutgoingPacket::Buffers::static_size;
+
+    for (size_t packetNumber = 0; packetNumber < packetsCount; ++packetNumber) {
+        const auto kPacket = mBatchPackets[packetNumber];
+        const auto &kEndpoint = mBatchNodes[mBatchPacketsOwners[packetNumber]]->endpoint();
+        const auto kBuffers = kPacket->buffers();
+
+        auto packetIOVectors = mIOVectors.data() + packetNumber * kBuffersPerPacket;
+        for (size_t bufferNumber = 0; bufferNumber < kBuffersPerPacket; ++bufferNumber) {
+            packetIOVectors[bufferNumber].iov_base = const_cast<void*>(
+                boost::asio::buffer_cast<const void*>(kBuffers[bufferNumber]));
+            packetIOVectors[bufferNumber].iov_len = boost::asio::buffer_size(kBuffers[bufferNumber]);
+        }
+
+        auto &header = mMessagesHeaders[packetNumber].msg_hdr;
+        memset(&header, 0, sizeof(header));
+        header.msg_name = const_cast<sockaddr*>(kEndpoint.data());
+        header.msg_namelen = static_cast<socklen_t>(kEndpoint.size());
+        header.msg_iov = packetIOVectors;
+        header.msg_iovlen = kBuffersPerPacket;
+    }
+
+    const auto kResult = ::sendmmsg(
+        mSocket.native_handle(),
+        mMessagesHeaders.data(),
+        static_cast<unsigned int>(packetsCount),
+        MSG_DONTWAIT);
+
+    if (kResult >= 0) {
+        return static_cast<size_t>(kResult);
+    }
+
+    if (errno != EAGAIN and errno != EWOULDBLOCK and errno != EINTR) {
+        error.assign(errno, boost::system::system_category());
+    }
+    return 0;
+#endif
+
+#ifndef LINUX
+    if (not mSocket.non_blocking()) {
+        mSocket.non_blocking(true);
+    }
+
+    for (size_t packetNumber = 0; packetNumber < packetsCount; ++packetNumber) {
+        mSocket.send_to(
+            mBatchPackets[packetNumber]->buffers(),
+            mBatchNodes[mBatchPacketsOwners[packetNumber]]->endpoint(),
+            0,
+            error);
+
+        if (error == boost::asio::error::would_block) {
+            error.clear();
+            return packetNumber;
+        }
+
+        if (error) {
+            // Only the first packet of the batch may be reported as failed,
+            // the rest of the batch would be retried on the next writability event.
+            if (packetNumber > 0) {
+                error.clear();
+            }
+            return packetNumber;
+        }
+    }
+
+    return packetsCount;
+#endif
+}
+
+LoggerStream BatchedPacketsSender::errors() const
+{
+    return mLog.warning("Communicator / BatchedPacketsSender");
+}
@@ -0,0 +1,119 @@
+/**
+ * This file is part of GEO Project.
+ * It is subject to the license terms in the LICENSE.md file found in the top-level directory
+ * of this distribution and at https://github.com/GEO-Project/GEO-Project/blob/master/LICENSE.md
+ *
+ * No part of GEO Project, including this file, may be copied, modified, propagated, or distributed
+ * except according to the terms contained in the LICENSE.md file.
+ */
+
+#ifndef GEO_NETWORK_CLIENT_BATCHEDPACKETSSENDER_H
+#define GEO_NETWORK_CLIENT_BATCHEDPACKETSSENDER_H
+
+#include "../common/Types.h"
+#include "OutgoingPacket.hpp"
+#include "../common/ServicePacket.hpp"
+
+#include "../../../../logger/Logger.h"
+
+#include <boost/array.hpp>
+
+#include <deque>
+#include <vector>
+
+#ifdef LINUX
+#include <sys/socket.h>
+#include <sys/uio.h>
+#endif
+
+
+using namespace std;
+
+
+class OutgoingRemoteNode;
+
+
+/**
+ * Transfers packets of all the outgoing remote nodes, that share the same UDP socket.
+ *
+ * Nodes, that have packets to send, are registered in the ready list.
+ * As soon as the socket becomes writable - up to kMaxBatchSize packets are collected
+ * from the ready nodes queues (round robin, one packet per node at a time)
+ * and are transferred via one sendmmsg() call.
+ *
+ * On the platforms without sendmmsg() packets of the batch are sent one by one
+ * via non-blocking send_to(), but still in one reactor round trip.
+ */
+class BatchedPacketsSender {
+public:
+    static const constexpr size_t kMaxBatchSize = 64;
+
+public:
+    BatchedPacketsSender(
+        UDPSocket &socket,
+        Logger &logger)
+        noexcept;
+
+    /**
+     * Registers node as ready for the packets sending.
+     * Node would be served on the next socket writability event.
+     */
+    void scheduleSending(
+        OutgoingRemoteNode *node)
+        noexcept;
+
+    /**
+     * Removes node from the ready list (if present).
+     * Must be called before the node would be destroyed.
+     */
+    void cancelSending(
+        OutgoingRemoteNode *node)
+        noexcept;
+
+    /**
+     * Sends service packet immediately, bypassing the ready list.
+     * Service packets are rare and small, so they are not batched.
+     */
+    void sendServicePacket(
+        const ServicePacket &packet,
+        const UDPEndpoint &endpoint)
+        noexcept;
+
+protected:
+    void beginWaitingForWritability()
+        noexcept;
+
+    void sendNextBatch()
+        noexcept;
+
+    /**
+     * @returns count of packets of the batch, that was transferred to the kernel.
+     * In case if the first packet of the batch was rejected by the kernel - "error" would be set.
+     */
+    size_t transferBatch(
+        const size_t packetsCount,
+        boost::system::error_code &error)
+        noexcept;
+
+    LoggerStream errors() const;
+
+protected:
+    UDPSocket &mSocket;
+    Logger &mLog;
+
+    deque<OutgoingRemoteNode*> mReadyNodes;
+    bool mWritabilityAwaited;
+
+    // Per-batch buffers are allocated once and are reused for every batch.
+    boost::array<const OutgoingPacket*, kMaxBatchSize> mBatchPackets;
+    boost::array<size_t, kMaxBatchSize> mBatchPacketsOwners;
+    vector<OutgoingRemoteNode*> mBatchNodes;
+    vector<size_t> mBatchNodesPacketsCounts;
+
+#ifdef LINUX
+    boost::array<mmsghdr, kMaxBatchSize> mMessagesHeaders;
+    boost::array<iovec, kMaxBatchSize * OutgoingPacket::Buffers::static_size> mIOVectors;
+#endif
+};
+
+#endif //GEO_NETWORK_CLIENT_BATCHEDPACKETSSENDER_H
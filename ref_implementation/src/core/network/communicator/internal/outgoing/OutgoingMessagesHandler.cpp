@@ -40,3 +40,14 @@ void OutgoingMessagesHandler::sendMessage(
             << "Message type: " << message->typeID();
     }
 }
+
+void OutgoingMessagesHandler::processServicePacket(
+    const UDPEndpoint &endpoint,
+    const byte *bytes,
+    size_t bytesCount)
+{
+    mNodes.processServicePacket(
+        endpoint,
+        bytes,
+        bytesCount);
+}
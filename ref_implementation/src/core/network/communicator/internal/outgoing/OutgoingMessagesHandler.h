@@ -28,6 +28,11 @@ public:
         const Message::Shared message,
         const NodeUUID &addressee);
 
+    void processServicePacket(
+        const UDPEndpoint &endpoint,
+        const byte *bytes,
+        size_t bytesCount);
+
 protected:
     Logger &mLog;
     OutgoingNodesHandler mNodes;
@@ -17,6 +17,9 @@ OutgoingNodesHandler::OutgoingNodesHandler(
     Logger &logger)
     noexcept:
 
+    mPacketsSender(
+        socket,
+        logger),
     mIOService(ioService),
     mSocket(socket),
     mUUID2AddressService(UUID2AddressService),
@@ -31,18 +34,69 @@ OutgoingRemoteNode *OutgoingNodesHandler::handler(
     noexcept
 {
     if (0 == mNodes.count(remoteNodeUUID)) {
-        mNodes[remoteNodeUUID] = make_unique<OutgoingRemoteNode>(
+        auto node = make_unique<OutgoingRemoteNode>(
             remoteNodeUUID,
             mUUID2AddressService,
-            mSocket,
+            mPacketsSender,
             mIOService,
             mLog);
+
+        node->signalEndpointChanged.connect(
+            [this] (OutgoingRemoteNode *changedNode, const UDPEndpoint &previousEndpoint) {
+                onNodeEndpointChanged(changedNode, previousEndpoint);
+            });
+
+        mNodes[remoteNodeUUID] = move(node);
     }
 
     mLastAccessDateTimes[remoteNodeUUID] = utc_now();
     return mNodes[remoteNodeUUID].get();
 }
 
+/**
+ * Transfers service packet, received from the "endpoint", to the handler of the corresponding remote node.
+ * Service packets are related only to the messages, that was sent recently,
+ * so the handler of the node must be present (otherwise the packet is ignored).
+ */
+void OutgoingNodesHandler::processServicePacket(
+    const UDPEndpoint &endpoint,
+    const byte *bytes,
+    const size_t bytesCount)
+    noexcept
+{
+    const auto kNode = mNodesByEndpoints.find(endpoint);
+    if (kNode == mNodesByEndpoints.end()) {
+        return;
+    }
+
+    kNode->second->processServicePacket(
+        bytes,
+        bytesCount);
+}
+
+void OutgoingNodesHandler::onNodeEndpointChanged(
+    OutgoingRemoteNode *node,
+    const UDPEndpoint &previousEndpoint)
+    noexcept
+{
+    const auto kPreviousNode = mNodesByEndpoints.find(previousEndpoint);
+    if (kPreviousNode != mNodesByEndpoints.end() and kPreviousNode->second == node) {
+        mNodesByEndpoints.erase(kPreviousNode);
+    }
+
+    mNodesByEndpoints[node->endpoint()] = node;
+}
+
+void OutgoingNodesHandler::removeNodeEndpoint(
+    OutgoingRemoteNode *node)
+    noexcept
+{
+    const auto kNode = mNodesByEndpoints.find(node->endpoint());
+    if (kNode != mNodesByEndpoints.end() and kNode->second == node) {
+        mNodesByEndpoints.erase(kNode);
+    }
+}
+
 /**
  * @brief OutgoingNodesHandler::kHandlersTTL
  * @returns timeout that must be wait, before remote node handler would be considered as obsolete.
@@ -120,9 +174,11 @@ void OutgoingNodesHandler::removeOutdatedHandlers()
     if (totalOutdateElements == mNodes.size()) {
         mNodes.clear();
         mLastAccessDateTimes.clear();
+        mNodesByEndpoints.clear();
 
     } else {
         for (const auto &outdatedHandlerUUID : outdatedHandlersUUIDs) {
+            removeNodeEndpoint(mNodes[outdatedHandlerUUID].get());
             mLastAccessDateTimes.erase(outdatedHandlerUUID);
             mNodes.erase(outdatedHandlerUUID);
         }
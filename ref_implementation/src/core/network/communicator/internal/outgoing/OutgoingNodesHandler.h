@@ -11,9 +11,11 @@
 #define OUTGOINGNODESHANDLER_H
 
 #include "OutgoingRemoteNode.h"
+#include "BatchedPacketsSender.h"
 
 #include <boost/unordered/unordered_map.hpp>
 #include <forward_list>
+#include <map>
 
 using namespace std;
 
@@ -31,6 +33,12 @@ public:
         const NodeUUID &nodeUUID)
         noexcept;
 
+    void processServicePacket(
+        const UDPEndpoint &endpoint,
+        const byte *bytes,
+        const size_t bytesCount)
+        noexcept;
+
 protected:
     static chrono::seconds kHandlersTTL()
         noexcept;
@@ -42,6 +50,15 @@ protected:
     void removeOutdatedHandlers()
         noexcept;
 
+    void onNodeEndpointChanged(
+        OutgoingRemoteNode *node,
+        const UDPEndpoint &previousEndpoint)
+        noexcept;
+
+    void removeNodeEndpoint(
+        OutgoingRemoteNode *node)
+        noexcept;
+
     static string logHeader()
         noexcept;
 
@@ -49,8 +66,17 @@ protected:
         noexcept;
 
 protected:
+    // Must be declared before the nodes handlers:
+    // nodes handlers unregister themselves from the sender on destruction.
+    BatchedPacketsSender mPacketsSender;
+
     boost::unordered_map<NodeUUID, OutgoingRemoteNode::Unique> mNodes;
     boost::unordered_map<NodeUUID, DateTime> mLastAccessDateTimes;
+
+    // Index of the nodes handlers by their resolved endpoints.
+    // Service packets are received from the endpoint, so the handler is found without nodes scanning.
+    map<UDPEndpoint, OutgoingRemoteNode*> mNodesByEndpoints;
+
     boost::asio::steady_timer mCleaningTimer;
 
     IOService &mIOService;
@@ -0,0 +1,131 @@
+/**
+ * This file is part of GEO Project.
+ * It is subject to the license terms in the LICENSE.md file found in the top-level directory
+ * of this distribution and at https://github.com/GEO-Project/GEO-Project/blob/master/LICENSE.md
+ *
+ * No part of GEO Project, including this file, may be copied, modified, propagated, or distributed
+ * except according to the terms contained in the LICENSE.md file.
+ */
+
+#ifndef GEO_NETWORK_CLIENT_OUTGOINGPACKET_H
+#define GEO_NETWORK_CLIENT_OUTGOINGPACKET_H
+
+#include "../common/Types.h"
+#include "../common/Packet.hpp"
+
+#include "../../../../common/Types.h"
+
+#include <boost/array.hpp>
+
+#include <cstring>
+
+
+/**
+ * Packet, that is enqueued for the sending, but is not transferred yet.
+ *
+ * Packet is never copied into the separate memory block.
+ * Instead of that, it is sent as a scatter/gather sequence of 3 buffers:
+ *   - header, that is stored in the packet itself;
+ *   - body, that points directly into the serialized message;
+ *   - CRC32 checksum of the message (or its part),
+ *     present only in the last packet (or in the last 2 packets) of the message.
+ *
+ * Serialized message is shared between all packets of the message
+ * and would be released only when the last of them would be sent.
+ */
+class OutgoingPacket {
+public:
+    using Buffers = boost::array<boost::asio::const_buffer, 3>;
+
+public:
+    OutgoingPacket(
+        BytesShared message,
+        const size_t bodyOffset,
+        const PacketHeader::PacketSize bodyBytesCount,
+        const PacketHeader::ChannelIndex channelIndex,
+        const PacketHeader::TotalPacketsCount totalPacketsCount,
+        const PacketHeader::PacketIndex packetIndex,
+        const PacketHeader::PacketSize sizeFlags = 0)
+        noexcept :
+
+        mMessage(message),
+        mBody(message.get() + bodyOffset),
+        mBodyBytesCount(bodyBytesCount),
+        mTrailerBytesCount(0),
+        mSizeFlags(sizeFlags)
+    {
+        const PacketHeader::PacketSize kPacketSize = (PacketHeader::kSize + bodyBytesCount) | mSizeFlags;
+
+        memcpy(mHeader + PacketHeader::kPacketSizeOffset, &kPacketSize, sizeof(kPacketSize));
+        memcpy(mHeader + PacketHeader::kChannelIndexOffset, &channelIndex, sizeof(channelIndex));
+        memcpy(mHeader + PacketHeader::kPacketsCountOffset, &totalPacketsCount, sizeof(totalPacketsCount));
+        memcpy(mHeader + PacketHeader::kPacketIndexOffset, &packetIndex, sizeof(packetIndex));
+    }
+
+    /**
+     * Appends "count" bytes of the CRC32 checksum of the message, starting from the "offset", to the packet.
+     * All packets except the last one are always full, so the checksum may be split between 2 last packets.
+     */
+    void appendChecksum(
+        const uint32_t checksum,
+        const size_t offset = 0,
+        const size_t count = sizeof(uint32_t))
+        noexcept
+    {
+        memcpy(mTrailer, reinterpret_cast<const byte*>(&checksum) + offset, count);
+        mTrailerBytesCount = static_cast<PacketHeader::PacketSize>(count);
+
+        const PacketHeader::PacketSize kPacketSize = size() | mSizeFlags;
+        memcpy(mHeader + PacketHeader::kPacketSizeOffset, &kPacketSize, sizeof(kPacketSize));
+    }
+
+    PacketHeader::PacketSize size() const
+        noexcept
+    {
+        return static_cast<PacketHeader::PacketSize>(
+            PacketHeader::kSize + mBodyBytesCount + mTrailerBytesCount);
+    }
+
+    Buffers buffers() const
+        noexcept
+    {
+        return Buffers{{
+            boost::asio::buffer(mHeader, PacketHeader::kSize),
+            boost::asio::buffer(mBody, mBodyBytesCount),
+            boost::asio::buffer(mTrailer, mTrailerBytesCount)}};
+    }
+
+    PacketHeader::ChannelIndex channelIndex() const
+        noexcept
+    {
+        PacketHeader::ChannelIndex index;
+        memcpy(&index, mHeader + PacketHeader::kChannelIndexOffset, sizeof(index));
+        return index;
+    }
+
+    PacketHeader::PacketIndex packetIndex() const
+        noexcept
+    {
+        return mHeader[PacketHeader::kPacketIndexOffset];
+    }
+
+    PacketHeader::TotalPacketsCount totalPacketsCount() const
+        noexcept
+    {
+        return mHeader[PacketHeader::kPacketsCountOffset];
+    }
+
+protected:
+    BytesShared mMessage;
+    const byte *mBody;
+    PacketHeader::PacketSize mBodyBytesCount;
+
+    byte mHeader[PacketHeader::kSize];
+    byte mTrailer[Packet::kCRCChecksumBytesCount];
+    PacketHeader::PacketSize mTrailerBytesCount;
+
+    // Flags, that are transferred in the packet size field of the header.
+    PacketHeader::PacketSize mSizeFlags;
+};
+
+#endif //GEO_NETWORK_CLIENT_OUTGOINGPACKET_H
@@ -13,7 +13,7 @@
 OutgoingRemoteNode::OutgoingRemoteNode(
     const NodeUUID &remoteNodeUUID,
     UUID2Address &uuid2addressService,
-    UDPSocket &socket,
+    BatchedPacketsSender &packetsSender,
     IOService &ioService,
     Logger &logger)
     noexcept :
@@ -21,13 +21,25 @@ OutgoingRemoteNode::OutgoingRemoteNode(
     mRemoteNodeUUID(remoteNodeUUID),
     mUUID2AddressService(uuid2addressService),
     mIOService(ioService),
-    mSocket(socket),
+    mPacketsSender(packetsSender),
     mLog(logger),
+    mEndpointResolving(false),
+    mPriorityPacketsInRow(0),
     mNextAvailableChannelIndex(0),
-    mCyclesStats(boost::posix_time::microsec_clock::universal_time(), 0),
+    mPacketSize(uuid2addressService.packetSize(remoteNodeUUID)),
+    mProbedPacketSize(0),
+    mFailedPacketSizeProbesCount(0),
+    mCRC32CSupported(uuid2addressService.isCRC32CSupported(remoteNodeUUID)),
+    mCompactAmountsSupported(uuid2addressService.isCompactAmountsSupported(remoteNodeUUID)),
     mSendingDelayTimer(mIOService)
 {}
 
+OutgoingRemoteNode::~OutgoingRemoteNode()
+    noexcept
+{
+    mPacketsSender.cancelSending(this);
+}
+
 void OutgoingRemoteNode::sendMessage(
     Message::Shared message)
     noexcept
@@ -36,10 +48,11 @@ void OutgoingRemoteNode::sendMessage(
         // In case if queue already contains packets -
         // then async handler is already scheduled.
         // Otherwise - it must be initialised.
-        bool packetsSendingAlreadyScheduled = mPacketsQueue.size() > 0;
+        bool packetsSendingAlreadyScheduled = containsPacketsInQueue();
 
-        auto bytesAndBytesCount = message->serializeToBytes();
-        if (bytesAndBytesCount.second > Message::maxSize()) {
+        auto bytesAndBytesCount = message->serializeToBytes(
+            mCompactAmountsSupported ? CompactAmountsEncoding : FixedAmountsEncoding);
+        if (bytesAndBytesCount.second > Packet::maxMessageSize(mPacketSize)) {
             errors() << "Message is too big to be transferred via the network";
             return;
         }
@@ -47,7 +60,7 @@ void OutgoingRemoteNode::sendMessage(
 #ifdef DEBUG_LOG_NETWORK_COMMUNICATOR
         const Message::SerializedType kMessageType =
             *(reinterpret_cast<Message::SerializedType*>(
-                bytesAndBytesCount.first.get()));
+                bytesAndBytesCount.first.get())) & Message::kTypeMask;
 
         debug()
             << "Message of type "
@@ -56,13 +69,19 @@ void OutgoingRemoteNode::sendMessage(
 #endif
 
         populateQueueWithNewPackets(
-            bytesAndBytesCount.first.get(),
-            bytesAndBytesCount.second);
+            bytesAndBytesCount.first,
+            bytesAndBytesCount.second,
+            priority(message->typeID()));
 
         if (not packetsSendingAlreadyScheduled) {
             beginPacketsSending();
         }
 
+        // Multi-packet messages would benefit from the larger packets.
+        if (bytesAndBytesCount.second + Packet::kCRCChecksumBytesCount > mPacketSize - PacketHeader::kSize) {
+            tryProbeLargerPacketSize();
+        }
+
     } catch (exception &e) {
         errors()
             << "Exception occured: "
@@ -72,7 +91,53 @@ void OutgoingRemoteNode::sendMessage(
 
 bool OutgoingRemoteNode::containsPacketsInQueue() const
 {
-    return mPacketsQueue.size() > 0;
+    if (mPacketsQueue.size() > 0) {
+        return true;
+    }
+
+    for (const auto &lane : mLanes) {
+        if (lane.size() > 0) {
+            return true;
+        }
+    }
+    return false;
+}
+
+OutgoingRemoteNode::Priority OutgoingRemoteNode::priority(
+    const Message::MessageType messageType)
+    noexcept
+{
+    switch (messageType) {
+    case Message::System_Confirmation:
+        return HighPriority;
+
+    case Message::Cycles_ThreeNodesBalancesRequest:
+    case Message::Cycles_ThreeNodesBalancesResponse:
+    case Message::Cycles_FourNodesBalancesRequest:
+    case Message::Cycles_FourNodesBalancesResponse:
+    case Message::Cycles_FiveNodesBoundary:
+    case Message::Cycles_FiveNodesMiddleware:
+    case Message::Cycles_SixNodesBoundary:
+    case Message::Cycles_SixNodesMiddleware:
+    case Message::MaxFlow_InitiateCalculation:
+    case Message::MaxFlow_CalculationSourceFirstLevel:
+    case Message::MaxFlow_CalculationTargetFirstLevel:
+    case Message::MaxFlow_CalculationSourceSecondLevel:
+    case Message::MaxFlow_CalculationTargetSecondLevel:
+    case Message::MaxFlow_ResultMaxFlowCalculation:
+    case Message::MaxFlow_ResultMaxFlowCalculationFromGateway:
+    case Message::RoutingTableRequest:
+    case Message::RoutingTableResponse:
+        return BulkPriority;
+
+    default: {
+        // All payments messages types are placed in the range 200-299.
+        if (messageType >= 200 and messageType < 300) {
+            return HighPriority;
+        }
+        return NormalPriority;
+    }
+    }
 }
 
 uint32_t OutgoingRemoteNode::crc32Checksum(
@@ -85,231 +150,661 @@ uint32_t OutgoingRemoteNode::crc32Checksum(
     return result.checksum();
 }
 
-void OutgoingRemoteNode::populateQueueWithNewPackets(
-    byte *messageData,
-    const size_t messageBytesCount)
+/**
+ * @returns checksum of the message, that is expected by the remote node:
+ * CRC32C in case if the node supports it, otherwise - CRC32.
+ */
+uint32_t OutgoingRemoteNode::messageChecksum(
+    byte *data,
+    size_t bytesCount) const
+    noexcept
 {
-    const auto kMessageContentWithCRC32BytesCount = messageBytesCount + sizeof(uint32_t);
+    if (mCRC32CSupported) {
+        return CRC32C::checksum(data, bytesCount);
+    }
 
-    PacketHeader::TotalPacketsCount kTotalPacketsCount =
-        static_cast<PacketHeader::TotalPacketsCount>(
-            kMessageContentWithCRC32BytesCount / Packet::kMaxSize);
+    return crc32Checksum(data, bytesCount);
+}
 
-    if (kMessageContentWithCRC32BytesCount % Packet::kMaxSize != 0)
-        kTotalPacketsCount += 1;
+/**
+ * Splits serialized message into the packets and enqueues them for the sending.
+ *
+ * No packet data is copied and no memory is allocated per packet:
+ * each packet only references the corresponding segment of the "messageData",
+ * and the CRC32 checksum of the message is attached to the end of the message.
+ *
+ * Packets are cut using the packet size, negotiated with the remote node.
+ * All packets of the message, except the last one, are always full:
+ * so the receiver is able to detect data segment size by any of them.
+ *
+ * Multi-packet messages are retained for some time after enqueueing,
+ * so the packets, that would be lost by the network, might be retransmitted on the remote node request.
+ */
+void OutgoingRemoteNode::populateQueueWithNewPackets(
+    BytesShared messageData,
+    const size_t messageBytesCount,
+    const Priority priority)
+{
+    const size_t kPacketDataSegmentSize = mPacketSize - PacketHeader::kSize;
 
+    const auto kMessageContentWithCRC32BytesCount = messageBytesCount + Packet::kCRCChecksumBytesCount;
+    size_t totalPacketsCount = kMessageContentWithCRC32BytesCount / kPacketDataSegmentSize;
+    if (kMessageContentWithCRC32BytesCount % kPacketDataSegmentSize != 0) {
+        totalPacketsCount += 1;
+    }
 
-    PacketHeader::ChannelIndex channelIndex = nextChannelIndex();
-    uint32_t crcChecksum = crc32Checksum(
-        messageData,
+    const auto kTotalPacketsCount = static_cast<PacketHeader::TotalPacketsCount>(totalPacketsCount);
+    const auto kChannelIndex = nextChannelIndex();
+    const auto kChecksum = messageChecksum(
+        messageData.get(),
         messageBytesCount);
 
+    const PacketHeader::PacketSize kSizeFlags = mCRC32CSupported ? PacketHeader::kCRC32CFlag : 0;
+
+    for (Packet::Index packetIndex = 0; packetIndex < kTotalPacketsCount; ++packetIndex) {
+        enqueuePacket(
+            priority,
+            messageData,
+            messageBytesCount,
+            mPacketSize,
+            kChannelIndex,
+            kTotalPacketsCount,
+            packetIndex,
+            kChecksum,
+            kSizeFlags);
+    }
 
-    size_t messageContentBytesProcessed = 0;
-    Packet::Index packetIndex = 0;
     if (kTotalPacketsCount > 1) {
-        for (; packetIndex<kTotalPacketsCount-1; ++packetIndex) {
-
-            // ToDo: remove all previously created packets from the queue to prevent memory leak.
-            auto buffer = static_cast<byte*>(malloc(Packet::kMaxSize));
-            if (buffer == nullptr) {
-                // Memory error occured.
-                // Current packet can't be enqueued, so there is no reason to try to enqueue the rest packets.
-                // Already created packets would be removed from the queue on the cleaning stage.
-                throw bad_alloc();
+        retainMessage({
+            kChannelIndex,
+            kTotalPacketsCount,
+            mPacketSize,
+            priority,
+            messageData,
+            messageBytesCount,
+            kChecksum,
+            kSizeFlags,
+            chrono::steady_clock::now(),
+            TimePoint(),
+            false});
+    }
+}
+
+/**
+ * Enqueues one packet of the message.
+ * Message content and its CRC32 checksum are considered as one continuous stream,
+ * that is cut by the fixed data segments of the "packetSize",
+ * so any packet of the message may be (re)created independently from the others.
+ *
+ * In case if the checksum crosses the segments border -
+ * it would be split between the two last packets of the message.
+ */
+void OutgoingRemoteNode::enqueuePacket(
+    const Priority priority,
+    BytesShared messageData,
+    const size_t messageBytesCount,
+    const Packet::Size packetSize,
+    const PacketHeader::ChannelIndex channelIndex,
+    const PacketHeader::TotalPacketsCount totalPacketsCount,
+    const PacketHeader::PacketIndex packetIndex,
+    const uint32_t checksum,
+    const PacketHeader::PacketSize sizeFlags)
+{
+    const size_t kPacketDataSegmentSize = packetSize - PacketHeader::kSize;
+
+    const auto kSegmentBegin = static_cast<size_t>(packetIndex) * kPacketDataSegmentSize;
+    const auto kSegmentEnd = min(
+        kSegmentBegin + kPacketDataSegmentSize,
+        messageBytesCount + Packet::kCRCChecksumBytesCount);
+
+    const auto kBodyOffset = min(kSegmentBegin, messageBytesCount);
+    const auto kBodyBytesCount = static_cast<PacketHeader::PacketSize>(
+        min(kSegmentEnd, messageBytesCount) - kBodyOffset);
+
+    auto &lane = mLanes[priority];
+    lane.emplace_back(
+        messageData,
+        kBodyOffset,
+        kBodyBytesCount,
+        channelIndex,
+        totalPacketsCount,
+        packetIndex,
+        sizeFlags);
+
+    if (kSegmentEnd > messageBytesCount) {
+        const auto kChecksumOffset = max(kSegmentBegin, messageBytesCount) - messageBytesCount;
+        lane.back().appendChecksum(
+            checksum,
+            kChecksumOffset,
+            kSegmentEnd - messageBytesCount - kChecksumOffset);
+    }
+}
+
+void OutgoingRemoteNode::processServicePacket(
+    const byte *bytes,
+    const size_t bytesCount)
+    noexcept
+{
+    dropExpiredRetainedMessages();
+
+    if (not mCRC32CSupported and ServicePacket::isCRC32CSupported(bytes)) {
+        mCRC32CSupported = true;
+        try {
+            mUUID2AddressService.setCRC32CSupported(mRemoteNodeUUID);
+        } catch (exception &) {}
+    }
+
+    if (not mCompactAmountsSupported and ServicePacket::isCompactAmountsSupported(bytes)) {
+        mCompactAmountsSupported = true;
+        try {
+            mUUID2AddressService.setCompactAmountsSupported(mRemoteNodeUUID);
+        } catch (exception &) {}
+    }
+
+    const auto kChannelIndex = ServicePacket::channelIndex(bytes);
+    switch (ServicePacket::type(bytes)) {
+    case ServicePacket::Acknowledgement: {
+        for (auto it = mRetainedMessages.begin(); it != mRetainedMessages.end(); ++it) {
+            if (it->channelIndex == kChannelIndex) {
+                // RTT is not measured on the retransmitted messages:
+                // it is impossible to find out which transmission was acknowledged.
+                if (not it->retransmitted and it->sent != TimePoint()) {
+                    mRateController.onRTTMeasured(
+                        chrono::duration_cast<chrono::microseconds>(
+                            chrono::steady_clock::now() - it->sent));
+                }
+
+                mRateController.onPacketsDelivered(it->totalPacketsCount);
+                mRetainedMessages.erase(it);
+                break;
             }
+        }
+        return;
+    }
 
-            memcpy(
-                buffer,
-                &Packet::kMaxSize,
-                sizeof(Packet::kMaxSize));
-
-            memcpy(
-                buffer + PacketHeader::kChannelIndexOffset,
-                &channelIndex,
-                sizeof(channelIndex));
-
-            memcpy(
-                buffer + PacketHeader::kPacketsCountOffset,
-                &kTotalPacketsCount,
-                sizeof(kTotalPacketsCount));
-
-            memcpy(
-                buffer + PacketHeader::kPacketIndexOffset,
-                &packetIndex,
-                sizeof(packetIndex));
-
-            memcpy(
-                buffer + PacketHeader::kDataOffset,
-                messageData + messageContentBytesProcessed,
-                Packet::kMaxSize - PacketHeader::kSize);
-
-            messageContentBytesProcessed += Packet::kMaxSize - PacketHeader::kSize;
-
-            const auto packetMaxSize = Packet::kMaxSize;
-            mPacketsQueue.push(
-                make_pair(
-                    buffer,
-                    packetMaxSize));
+    case ServicePacket::MissingPacketsRequest: {
+        retransmitPackets(
+            kChannelIndex,
+            ServicePacket::missingPackets(bytes, bytesCount));
+        return;
+    }
+
+    case ServicePacket::PacketSizeConfirmation: {
+        // Confirmation contains the size of the received probe instead of the channel index.
+        onPacketSizeConfirmed(
+            static_cast<Packet::Size>(kChannelIndex));
+        return;
+    }
+
+    default: {
+        errors()
+            << "OutgoingRemoteNode::processServicePacket: "
+            << "Unexpected service packet type occurred. Packet dropped.";
+    }
+    }
+}
+
+/**
+ * Enqueues again packets of the retained message, that was not received by the remote node.
+ * Request is ignored in case if message is not retained anymore,
+ * or if some of its packets are still waiting in the queue (remote node requested them too early).
+ */
+void OutgoingRemoteNode::retransmitPackets(
+    const PacketHeader::ChannelIndex channelIndex,
+    const ServicePacket::PacketsBitmap &packets)
+    noexcept
+{
+    const auto kMessage = find_if(
+        mRetainedMessages.begin(),
+        mRetainedMessages.end(),
+        [channelIndex] (const RetainedMessage &message) {
+            return message.channelIndex == channelIndex;
+        });
+
+    if (kMessage == mRetainedMessages.end()) {
+        return;
+    }
+
+    for (const auto &packet : mPacketsQueue) {
+        if (packet.channelIndex() == channelIndex) {
+            return;
+        }
+    }
+
+    for (const auto &packet : mLanes[kMessage->priority]) {
+        if (packet.channelIndex() == channelIndex) {
+            return;
         }
     }
 
-    // Writing last packet
-    const PacketHeader::PacketSize kLastPacketSize =
-        static_cast<PacketHeader::PacketSize>(kMessageContentWithCRC32BytesCount - messageContentBytesProcessed) + PacketHeader::kSize;
+    try {
+        const bool kPacketsSendingAlreadyScheduled = containsPacketsInQueue();
+
+        size_t packetsRetransmitted = 0;
+        for (size_t index = 0; index < kMessage->totalPacketsCount; ++index) {
+            if (not packets.test(index)) {
+                continue;
+            }
+
+            enqueuePacket(
+                kMessage->priority,
+                kMessage->bytes,
+                kMessage->bytesCount,
+                kMessage->packetSize,
+                kMessage->channelIndex,
+                kMessage->totalPacketsCount,
+                static_cast<PacketHeader::PacketIndex>(index),
+                kMessage->checksum,
+                kMessage->sizeFlags);
+
+            ++packetsRetransmitted;
+        }
+
+#ifdef DEBUG_LOG_NETWORK_COMMUNICATOR
+        debug() << packetsRetransmitted << " packet(s) of the channel " << channelIndex
+                << " enqueued for the retransmission";
+#endif
+
+        if (packetsRetransmitted == 0) {
+            return;
+        }
+
+        kMessage->retransmitted = true;
+        mRateController.onPacketsLost(packetsRetransmitted, chrono::steady_clock::now());
+        mRateController.onPacketsRetransmitted(packetsRetransmitted);
+
+#ifdef DEBUG_LOG_NETWORK_COMMUNICATOR
+        debug() << "Pacing rate: " << static_cast<size_t>(rateStats().rate) << " packets/s; "
+                << "congestion window: " << static_cast<size_t>(rateStats().congestionWindow) << "; "
+                << "smoothed RTT: " << rateStats().smoothedRTT.count() << "us";
+#endif
+
+        if (not kPacketsSendingAlreadyScheduled) {
+            beginPacketsSending();
+        }
 
-    byte *buffer = static_cast<byte*>(malloc(kLastPacketSize));
-    if (buffer == nullptr) {
-        throw bad_alloc();
+    } catch (exception &e) {
+        errors()
+            << "OutgoingRemoteNode::retransmitPackets: "
+            << "Exception occured: " << e.what();
     }
+}
 
-    memcpy(
-        buffer,
-        &kLastPacketSize,
-        sizeof(kLastPacketSize));
+void OutgoingRemoteNode::retainMessage(
+    RetainedMessage &&message)
+    noexcept
+{
+    dropExpiredRetainedMessages();
 
-    memcpy(
-        buffer + PacketHeader::kChannelIndexOffset,
-        &channelIndex,
-        sizeof(channelIndex));
+    if (mRetainedMessages.size() == kMaxRetainedMessagesCount) {
+        mRetainedMessages.pop_front();
+    }
 
-    memcpy(
-        buffer + PacketHeader::kPacketsCountOffset,
-        &kTotalPacketsCount,
-        sizeof(kTotalPacketsCount));
+    mRetainedMessages.push_back(move(message));
+}
 
-    memcpy(
-        buffer + PacketHeader::kPacketIndexOffset,
-        &packetIndex,
-        sizeof(packetIndex));
+void OutgoingRemoteNode::dropExpiredRetainedMessages()
+    noexcept
+{
+    const auto kNow = chrono::steady_clock::now();
+    while (not mRetainedMessages.empty()
+           and kNow - mRetainedMessages.front().enqueued > kMessagesRetentionPeriod()) {
+        mRetainedMessages.pop_front();
+    }
+}
 
-    memcpy(
-        buffer + PacketHeader::kDataOffset,
-        messageData + messageContentBytesProcessed,
-        kLastPacketSize - sizeof(crcChecksum) - PacketHeader::kSize);
+/**
+ * @returns period during which multi-packet message is kept for the possible retransmission.
+ * There is no reason to keep it longer, than the remote node keeps incomplete channels.
+ */
+chrono::seconds OutgoingRemoteNode::kMessagesRetentionPeriod()
+    noexcept
+{
+    static const chrono::seconds kPeriod(5);
+    return kPeriod;
+}
 
-    messageContentBytesProcessed += kLastPacketSize - sizeof(crcChecksum) - PacketHeader::kSize;
+/**
+ * Sends probe of the next packet size to the remote node (in case if there is no probe in flight).
+ * Probe, that was not confirmed during the timeout, is considered as lost:
+ * after several lost probes of the same size, the size is considered as unsupported by the network path.
+ *
+ * Nodes, that doesn't support packet size probing, never confirm the probes,
+ * so the default packet size would be used for them.
+ */
+void OutgoingRemoteNode::tryProbeLargerPacketSize()
+    noexcept
+{
+    const auto kNextPacketSize = Packet::nextSize(mPacketSize);
+    if (kNextPacketSize == 0 or mFailedPacketSizeProbesCount >= kMaxFailedPacketSizeProbesCount) {
+        return;
+    }
 
-    // Copying CRC32 checksum
-    memcpy(
-        buffer + PacketHeader::kDataOffset + kLastPacketSize - sizeof(crcChecksum) - PacketHeader::kSize,
-        &crcChecksum,
-        sizeof(crcChecksum));
+    const auto kNow = chrono::steady_clock::now();
+    if (mProbedPacketSize != 0) {
+        if (kNow - mPacketSizeProbeSent < kPacketSizeProbeTimeout()) {
+            return;
+        }
 
-    messageContentBytesProcessed += sizeof(crcChecksum);
+        mProbedPacketSize = 0;
+        if (++mFailedPacketSizeProbesCount >= kMaxFailedPacketSizeProbesCount) {
+#ifdef DEBUG_LOG_NETWORK_COMMUNICATOR
+            debug() << "Packet size " << kNextPacketSize << " is not supported by the node (" << mRemoteNodeUUID << ")";
+#endif
+            return;
+        }
+    }
+
+    // Endpoint is resolved on the packets sending,
+    // probe is never sent to the node, that has no known endpoint.
+    if (mEndpoint.port() == 0) {
+        return;
+    }
+
+    mProbedPacketSize = kNextPacketSize;
+    mPacketSizeProbeSent = kNow;
+    mPacketsSender.sendServicePacket(
+        ServicePacket(kNextPacketSize),
+        mEndpoint);
+}
+
+void OutgoingRemoteNode::onPacketSizeConfirmed(
+    const Packet::Size packetSize)
+    noexcept
+{
+    if (mProbedPacketSize == 0 or packetSize != mProbedPacketSize) {
+        return;
+    }
+
+    mRateController.onRTTMeasured(
+        chrono::duration_cast<chrono::microseconds>(
+            chrono::steady_clock::now() - mPacketSizeProbeSent));
 
-    mPacketsQueue.push(
-        make_pair(
-            buffer,
-            kLastPacketSize));
+#ifdef DEBUG_LOG_NETWORK_COMMUNICATOR
+    debug() << "Packet size " << packetSize << " confirmed by the node (" << mRemoteNodeUUID << ")";
+#endif
+
+    mPacketSize = packetSize;
+    mProbedPacketSize = 0;
+    mFailedPacketSizeProbesCount = 0;
+
+    try {
+        mUUID2AddressService.setPacketSize(mRemoteNodeUUID, packetSize);
+    } catch (exception &) {}
+}
+
+chrono::milliseconds OutgoingRemoteNode::kPacketSizeProbeTimeout()
+    noexcept
+{
+    static const chrono::milliseconds kTimeout(1000);
+    return kTimeout;
 }
 
+/**
+ * Resolves the endpoint of the remote node and registers the node in the packets sender.
+ * Packets itself would be sent by the sender, in batches, together with the packets of other nodes.
+ *
+ * Note: it is expected, that this method is called only when there is no pending sending
+ * (no delay timer is armed and the node is not registered in the sender).
+ */
 void OutgoingRemoteNode::beginPacketsSending()
 {
-    if (mPacketsQueue.empty()) {
+    if (not containsPacketsInQueue()) {
         return;
     }
 
 
-    UDPEndpoint endpoint;
+    // Endpoint lookup in the global cache requires network exchange,
+    // so it is performed asynchronously: IO service is never blocked by the slow global cache.
+    if (not mUUID2AddressService.isEndpointCached(mRemoteNodeUUID)) {
+        if (not mEndpointResolving) {
+            mEndpointResolving = true;
+            mUUID2AddressService.resolveEndpoint(
+                mRemoteNodeUUID,
+                [this] (const boost::system::error_code &error, const UDPEndpoint &endpoint) {
+                    onEndpointResolved(error, endpoint);
+                });
+        }
+        return;
+    }
+
     try {
-        endpoint = mUUID2AddressService.endpoint(mRemoteNodeUUID);
+        setEndpoint(
+            mUUID2AddressService.endpoint(mRemoteNodeUUID));
 
     } catch  (exception &) {
         errors()
             << "Endpoint can't be fetched from uuid2address. "
             << "No messages can be sent. Outgoing queue cleared.";
 
-        while (!mPacketsQueue.empty()) {
-            const auto packetDataAndSize = mPacketsQueue.front();
-            free(packetDataAndSize.first);
-            mPacketsQueue.pop();
-        }
+        clearQueues();
+        return;
+    }
+
+    continuePacketsSending();
+}
+
+/**
+ * Offers packets to the packets sender, using the endpoint, that was already resolved.
+ */
+void OutgoingRemoteNode::continuePacketsSending()
+{
+    // Packets are paced by the rate controller of the node:
+    // in case if the tokens bucket is empty - sending is delayed until the next token would be available.
+    mRateController.refill(chrono::steady_clock::now());
+    if (mRateController.availablePackets() == 0) {
+        mRateController.onSendingDelayed();
+        mSendingDelayTimer.expires_from_now(mRateController.delayUntilNextPacket());
+        mSendingDelayTimer.async_wait([this] (const boost::system::error_code &error) {
+            if (error == boost::asio::error::operation_aborted or not containsPacketsInQueue()) {
+                return;
+            }
+
+            this->continuePacketsSending();
+        });
+        return;
+    }
+
+    stagePackets();
+    mPacketsSender.scheduleSending(this);
+}
+
+/**
+ * Note: node is never removed while it contains packets,
+ * so it is still alive, when the endpoint lookup is finished.
+ */
+void OutgoingRemoteNode::onEndpointResolved(
+    const boost::system::error_code &error,
+    const UDPEndpoint &endpoint)
+    noexcept
+{
+    mEndpointResolving = false;
+
+    if (error) {
+        errors()
+            << "Endpoint can't be fetched from uuid2address. "
+            << "No messages can be sent. Outgoing queue cleared. "
+            << "Error code: " << error.value();
+
+        clearQueues();
+        return;
+    }
 
+    // Resolved endpoint is used as is: it may be the expired endpoint,
+    // that is used while the global cache is unreachable (and is not reported as cached).
+    setEndpoint(endpoint);
+    if (not containsPacketsInQueue()) {
         return;
     }
 
+    try {
+        continuePacketsSending();
+
+    } catch (exception &e) {
+        errors()
+            << "OutgoingRemoteNode::onEndpointResolved: "
+            << "Exception occured: " << e.what();
+    }
+}
+
+void OutgoingRemoteNode::setEndpoint(
+    const UDPEndpoint &endpoint)
+    noexcept
+{
+    if (endpoint == mEndpoint) {
+        return;
+    }
 
-    // The next code inserts delay between sending packets in case of high traffic.
-    const auto kShortSendingTimeInterval = boost::posix_time::milliseconds(20);
-    const auto kTimeoutFromLastSending = boost::posix_time::microsec_clock::universal_time() - mCyclesStats.first;
-    if (kTimeoutFromLastSending < kShortSendingTimeInterval) {
-        // Increasing short sendings counter.
-        mCyclesStats.second += 1;
+    const auto kPreviousEndpoint = mEndpoint;
+    mEndpoint = endpoint;
+    signalEndpointChanged(this, kPreviousEndpoint);
+}
 
-        const auto kMaxShortSendings = 30;
-        if (mCyclesStats.second > kMaxShortSendings) {
-            mCyclesStats.second = 0;
-            mSendingDelayTimer.expires_from_now(kShortSendingTimeInterval);
-            mSendingDelayTimer.async_wait([this] (const boost::system::error_code &_){
-                this->beginPacketsSending();
-                debug() << "Sending delayed";
+/**
+ * Moves packets from the lanes into the queue of the packets sender.
+ *
+ * Lanes are served from the highest priority to the lowest one, packet by packet:
+ * so packets of different messages are interleaved, and the urgent message never waits
+ * for the whole bulk message to be transferred.
+ * Each kMaxPriorityPacketsInRow packets, one packet is taken from the next waiting lower priority lane.
+ */
+void OutgoingRemoteNode::stagePackets()
+    noexcept
+{
+    while (mPacketsQueue.size() < kMaxStagedPacketsCount) {
+        size_t lane = 0;
+        while (lane < mLanes.size() and mLanes[lane].empty()) {
+            ++lane;
+        }
 
-            });
+        if (lane == mLanes.size()) {
             return;
         }
 
-    } else {
-        mCyclesStats.second = 0;
-    }
+        size_t lowerLane = lane + 1;
+        while (lowerLane < mLanes.size() and mLanes[lowerLane].empty()) {
+            ++lowerLane;
+        }
 
+        if (lowerLane == mLanes.size()) {
+            mPriorityPacketsInRow = 0;
 
-    const auto packetDataAndSize = mPacketsQueue.front();
-    mSocket.async_send_to(
-        boost::asio::buffer(
-            packetDataAndSize.first,
-            packetDataAndSize.second),
-        endpoint,
-        [this, endpoint] (const boost::system::error_code &error, const size_t bytesTransferred) {
+        } else if (mPriorityPacketsInRow == kMaxPriorityPacketsInRow) {
+            mPriorityPacketsInRow = 0;
+            lane = lowerLane;
 
-            const auto packetDataAndSize = mPacketsQueue.front();
-            if (bytesTransferred != packetDataAndSize.second) {
-                if (error) {
-                    errors()
-                        << "OutgoingRemoteNode::beginPacketsSending: "
-                        << "Next packet can't be sent to the node (" << mRemoteNodeUUID << "). "
-                        << "Error code: " << error.value();
-                }
+        } else {
+            ++mPriorityPacketsInRow;
+        }
 
-                // Removing packet from the memory
-                free(packetDataAndSize.first);
-                mPacketsQueue.pop();
-                if (mPacketsQueue.size() > 0) {
-                    beginPacketsSending();
-                }
+        mPacketsQueue.push_back(move(mLanes[lane].front()));
+        mLanes[lane].pop_front();
+    }
+}
 
-                return;
-            }
+void OutgoingRemoteNode::clearQueues()
+    noexcept
+{
+    mPacketsQueue.clear();
+    for (auto &lane : mLanes) {
+        lane.clear();
+    }
+}
 
-#ifdef DEBUG_LOG_NETWORK_COMMUNICATOR
-            const PacketHeader::ChannelIndex channelIndex =
-                *(new(packetDataAndSize.first + PacketHeader::kChannelIndexOffset) PacketHeader::ChannelIndex);
+const UDPEndpoint& OutgoingRemoteNode::endpoint() const
+    noexcept
+{
+    return mEndpoint;
+}
+
+/**
+ * @returns count of packets from the head of the queue, that may be included into the next batch.
+ * Packets, that exceeds the tokens of the rate controller, would be sent only after the delay.
+ */
+size_t OutgoingRemoteNode::packetsAvailableForSending() const
+    noexcept
+{
+    return min(
+        mPacketsQueue.size(),
+        mRateController.availablePackets());
+}
 
-            const PacketHeader::PacketIndex packetIndex =
-                *(new(packetDataAndSize.first + PacketHeader::kPacketIndexOffset) PacketHeader::PacketIndex) + 1;
+const OutgoingPacket& OutgoingRemoteNode::packet(
+    const size_t number) const
+    noexcept
+{
+    return mPacketsQueue[number];
+}
 
-            const PacketHeader::TotalPacketsCount totalPacketsCount =
-                *(new(packetDataAndSize.first + PacketHeader::kPacketsCountOffset) PacketHeader::TotalPacketsCount);
+/**
+ * Is called by the packets sender, when the batch, that contains packets of this node, was processed.
+ * "packetsCount" packets from the head of the queue are considered as transferred (or dropped, in case of error).
+ */
+void OutgoingRemoteNode::onPacketsSent(
+    const size_t packetsCount,
+    const boost::system::error_code &error)
+    noexcept
+{
+    if (error and packetsCount > 0) {
+        errors()
+            << "OutgoingRemoteNode::onPacketsSent: "
+            << "Next packet can't be sent to the node (" << mRemoteNodeUUID << "). "
+            << "Error code: " << error.value();
+    }
 
-            this->debug()
-                << setw(4) << bytesTransferred <<  "B TX [ => ] "
-                << endpoint.address() << ":" << endpoint.port() << "; "
-                << "Channel: " << setw(10) << static_cast<size_t>(channelIndex) << "; "
-                << "Packet: " << setw(3) << static_cast<size_t>(packetIndex)
-                << "/" << static_cast<size_t>(totalPacketsCount);
+    const auto kNow = chrono::steady_clock::now();
+    for (size_t packetNumber = 0; packetNumber < packetsCount; ++packetNumber) {
+#ifdef DEBUG_LOG_NETWORK_COMMUNICATOR
+        const auto &packet = mPacketsQueue.front();
+        this->debug()
+            << setw(4) << packet.size() <<  "B TX [ => ] "
+            << mEndpoint.address() << ":" << mEndpoint.port() << "; "
+            << "Channel: " << setw(10) << static_cast<size_t>(packet.channelIndex()) << "; "
+            << "Packet: " << setw(3) << static_cast<size_t>(packet.packetIndex() + 1)
+            << "/" << static_cast<size_t>(packet.totalPacketsCount());
 #endif
 
-            // Removing packet from the memory
-            free(packetDataAndSize.first);
-            mPacketsQueue.pop();
+        const auto &kPacket = mPacketsQueue.front();
+        if (kPacket.totalPacketsCount() > 1 and kPacket.packetIndex() == kPacket.totalPacketsCount() - 1) {
+            onMessageSent(kPacket.channelIndex(), kNow);
+        }
+
+        // Removing packet from the queue.
+        // Serialized message would be released together with its last packet.
+        mPacketsQueue.pop_front();
+    }
 
+    mRateController.onPacketsSent(packetsCount);
 
+    if (containsPacketsInQueue()) {
+        beginPacketsSending();
+    }
+}
 
-            mCyclesStats.first = boost::posix_time::microsec_clock::universal_time();
-            if (mPacketsQueue.size() > 0) {
-                beginPacketsSending();
+/**
+ * Remembers the time, when the last packet of the retained message was transferred.
+ * Only the first transmission is taken into account.
+ */
+void OutgoingRemoteNode::onMessageSent(
+    const PacketHeader::ChannelIndex channelIndex,
+    const TimePoint &now)
+    noexcept
+{
+    // Message, that was sent, is usually the most recently retained one.
+    for (auto it = mRetainedMessages.rbegin(); it != mRetainedMessages.rend(); ++it) {
+        if (it->channelIndex == channelIndex) {
+            if (it->sent == TimePoint()) {
+                it->sent = now;
             }
-        });
+            return;
+        }
+    }
+}
+
+const PacketsRateController::Stats& OutgoingRemoteNode::rateStats() const
+    noexcept
+{
+    return mRateController.stats();
 }
 
 PacketHeader::ChannelIndex OutgoingRemoteNode::nextChannelIndex()
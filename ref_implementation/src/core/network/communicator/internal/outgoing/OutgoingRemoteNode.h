@@ -12,7 +12,12 @@
 
 #include "../common/Types.h"
 #include "../common/Packet.hpp"
+#include "../common/ServicePacket.hpp"
+#include "../common/CRC32C.h"
 #include "../uuid2address/UUID2Address.h"
+#include "OutgoingPacket.hpp"
+#include "BatchedPacketsSender.h"
+#include "PacketsRateController.h"
 
 #include "../../../messages/Message.hpp"
 
@@ -23,7 +28,7 @@
 
 #include <boost/crc.hpp>
 #include <boost/asio/steady_timer.hpp>
-#include <queue>
+#include <deque>
 
 
 class OutgoingRemoteNode {
@@ -31,33 +36,193 @@ public:
     using Shared = shared_ptr<OutgoingRemoteNode>;
     using Unique = unique_ptr<OutgoingRemoteNode>;
 
+public:
+    // Is emitted when the endpoint of the node is changed (previous endpoint is passed).
+    signals::signal<void(OutgoingRemoteNode*, const UDPEndpoint&)> signalEndpointChanged;
+
 public:
     OutgoingRemoteNode(
         const NodeUUID &remoteNodeUUID,
         UUID2Address &uuid2addressService,
-        UDPSocket &socket,
+        BatchedPacketsSender &packetsSender,
         IOService &ioService,
         Logger &logger)
         noexcept;
 
+    ~OutgoingRemoteNode()
+        noexcept;
+
     void sendMessage(
         Message::Shared message)
         noexcept;
 
     bool containsPacketsInQueue() const;
 
+    /**
+     * Processes acknowledgement or missing packets request from the remote node.
+     */
+    void processServicePacket(
+        const byte *bytes,
+        const size_t bytesCount)
+        noexcept;
+
+    /*
+     * Packets sender interface.
+     */
+    const UDPEndpoint& endpoint() const
+        noexcept;
+
+    size_t packetsAvailableForSending() const
+        noexcept;
+
+    const OutgoingPacket& packet(
+        const size_t number) const
+        noexcept;
+
+    void onPacketsSent(
+        const size_t packetsCount,
+        const boost::system::error_code &error)
+        noexcept;
+
+    /**
+     * @returns pacing and delivery statistics of the node.
+     */
+    const PacketsRateController::Stats& rateStats() const
+        noexcept;
+
+protected:
+    /**
+     * Sending priority of the message.
+     * Each priority has its own packets queue (lane), lanes are served from the highest to the lowest,
+     * so packets of the urgent messages overtake packets of the bulk messages, that are already enqueued.
+     */
+    enum Priority {
+        // Payments (including votes and TTL prolongation) and confirmations.
+        HighPriority = 0,
+        // Trust lines and all other messages.
+        NormalPriority = 1,
+        // Topology collection: max flow calculation, cycles, routing tables.
+        BulkPriority = 2,
+
+        PrioritiesCount
+    };
+
+    // Count of packets, that may be taken from the higher priority lanes in a row,
+    // while the lower priority lanes are waiting.
+    // Prevents starvation of the lower priority lanes.
+    static const constexpr size_t kMaxPriorityPacketsInRow = 8;
+
+    // Max count of packets, that are taken from the lanes for the next batches.
+    // Limits the delay of the urgent packets, that arrive after the bulk packets was already staged.
+    static const constexpr size_t kMaxStagedPacketsCount = 16;
+
+    // Max count of multi-packet messages, that are kept for the possible retransmission.
+    static const constexpr size_t kMaxRetainedMessagesCount = 32;
+
+protected:
+    /**
+     * Multi-packet message, that was sent recently,
+     * and might be requested by the remote node for the partial retransmission.
+     */
+    struct RetainedMessage {
+        PacketHeader::ChannelIndex channelIndex;
+        PacketHeader::TotalPacketsCount totalPacketsCount;
+        Packet::Size packetSize;
+        Priority priority;
+        BytesShared bytes;
+        size_t bytesCount;
+        uint32_t checksum;
+        PacketHeader::PacketSize sizeFlags;
+        TimePoint enqueued;
+
+        // Time when the last packet of the message was transferred (used for the RTT measurement).
+        TimePoint sent;
+        bool retransmitted;
+    };
+
+    static chrono::seconds kMessagesRetentionPeriod()
+        noexcept;
+
+    static chrono::milliseconds kPacketSizeProbeTimeout()
+        noexcept;
+
+    // Count of the unconfirmed probes of the packet size, after which this size is not probed anymore.
+    static const constexpr size_t kMaxFailedPacketSizeProbesCount = 2;
+
 protected:
     uint32_t crc32Checksum(
         byte* data,
         size_t bytesCount)
         const noexcept;
 
+    uint32_t messageChecksum(
+        byte* data,
+        size_t bytesCount)
+        const noexcept;
+
+    static Priority priority(
+        const Message::MessageType messageType)
+        noexcept;
+
     void populateQueueWithNewPackets(
-        byte* messageData,
-        const size_t bytesCount);
+        BytesShared messageData,
+        const size_t bytesCount,
+        const Priority priority);
+
+    void enqueuePacket(
+        const Priority priority,
+        BytesShared messageData,
+        const size_t messageBytesCount,
+        const Packet::Size packetSize,
+        const PacketHeader::ChannelIndex channelIndex,
+        const PacketHeader::TotalPacketsCount totalPacketsCount,
+        const PacketHeader::PacketIndex packetIndex,
+        const uint32_t checksum,
+        const PacketHeader::PacketSize sizeFlags);
+
+    void retainMessage(
+        RetainedMessage &&message)
+        noexcept;
+
+    void dropExpiredRetainedMessages()
+        noexcept;
+
+    void tryProbeLargerPacketSize()
+        noexcept;
+
+    void onPacketSizeConfirmed(
+        const Packet::Size packetSize)
+        noexcept;
+
+    void retransmitPackets(
+        const PacketHeader::ChannelIndex channelIndex,
+        const ServicePacket::PacketsBitmap &packets)
+        noexcept;
 
     void beginPacketsSending();
 
+    void onEndpointResolved(
+        const boost::system::error_code &error,
+        const UDPEndpoint &endpoint)
+        noexcept;
+
+    void setEndpoint(
+        const UDPEndpoint &endpoint)
+        noexcept;
+
+    void continuePacketsSending();
+
+    void stagePackets()
+        noexcept;
+
+    void clearQueues()
+        noexcept;
+
+    void onMessageSent(
+        const PacketHeader::ChannelIndex channelIndex,
+        const TimePoint &now)
+        noexcept;
+
     PacketHeader::ChannelIndex nextChannelIndex()
         noexcept;
 
@@ -70,16 +235,43 @@ protected:
 
     UUID2Address &mUUID2AddressService;
     IOService &mIOService;
-    UDPSocket &mSocket;
+    BatchedPacketsSender &mPacketsSender;
     Logger &mLog;
 
-    queue<pair<byte*, Packet::Size>> mPacketsQueue;
+    UDPEndpoint mEndpoint;
+
+    // "true" while the endpoint of the node is fetched from the global cache.
+    // Packets are kept in the lanes until the endpoint would be known.
+    bool mEndpointResolving;
+
+    // Packets, that are waiting for the sending, grouped by the priority of their messages.
+    boost::array<deque<OutgoingPacket>, PrioritiesCount> mLanes;
+    size_t mPriorityPacketsInRow;
+
+    // Packets, that was taken from the lanes and are offered to the packets sender.
+    deque<OutgoingPacket> mPacketsQueue;
     PacketHeader::ChannelIndex mNextAvailableChannelIndex;
 
-    // This pair contains date time of last packet sendind
-    // and count of sending operations, that would be done in interval, less than 50 msecs between 2 operations.
-    pair<boost::posix_time::ptime, size_t> mCyclesStats;
-    as::deadline_timer mSendingDelayTimer;
+    // Ordered by the sending time (and by the channel index).
+    deque<RetainedMessage> mRetainedMessages;
+
+    // Size of the packets, that are sent to the remote node.
+    // Starts from the default size and is increased, when the remote node confirms larger packets probe.
+    Packet::Size mPacketSize;
+    Packet::Size mProbedPacketSize;
+    TimePoint mPacketSizeProbeSent;
+    size_t mFailedPacketSizeProbesCount;
+
+    // Messages are checksummed by CRC32C, only when the remote node reported, that it supports it.
+    // Otherwise - CRC32 is used (compatibility with the nodes, that doesn't support CRC32C).
+    bool mCRC32CSupported;
+
+    // Amounts of the messages are sent in compact encoding, only when the remote node reported, that it supports it.
+    // Otherwise - fixed encoding is used (compatibility with the nodes, that doesn't support compact amounts).
+    bool mCompactAmountsSupported;
+
+    PacketsRateController mRateController;
+    as::steady_timer mSendingDelayTimer;
 
 };
 
@@ -0,0 +1,177 @@
+/**
+ * This file is part of GEO Project.
+ * It is subject to the license terms in the LICENSE.md file found in the top-level directory
+ * of this distribution and at https://github.com/GEO-Project/GEO-Project/blob/master/LICENSE.md
+ *
+ * No part of GEO Project, including this file, may be copied, modified, propagated, or distributed
+ * except according to the terms contained in the LICENSE.md file.
+ */
+
+#include "PacketsRateController.h"
+
+
+PacketsRateController::PacketsRateController()
+    noexcept :
+
+    mTokens(kInitialCongestionWindow),
+    mLastRefill(chrono::steady_clock::now()),
+    mSlowStart(true),
+    mRTTMeasured(false)
+{
+    mStats.congestionWindow = kInitialCongestionWindow;
+    mStats.smoothedRTT = kInitialRTT();
+    mStats.packetsSent = 0;
+    mStats.packetsRetransmitted = 0;
+    mStats.packetsDelivered = 0;
+    mStats.packetsLost = 0;
+    mStats.lossEvents = 0;
+    mStats.delayedSendings = 0;
+
+    updateRate();
+}
+
+void PacketsRateController::refill(
+    const TimePoint &now)
+    noexcept
+{
+    if (now <= mLastRefill) {
+        return;
+    }
+
+    const auto kElapsedSeconds = chrono::duration<double>(now - mLastRefill).count();
+    mLastRefill = now;
+
+    const double kBurst = mStats.congestionWindow < kMaxBurst ? mStats.congestionWindow : kMaxBurst;
+    mTokens += mStats.rate * kElapsedSeconds;
+    if (mTokens > kBurst) {
+        mTokens = kBurst;
+    }
+}
+
+size_t PacketsRateController::availablePackets() const
+    noexcept
+{
+    return mTokens < 1 ? 0 : static_cast<size_t>(mTokens);
+}
+
+chrono::microseconds PacketsRateController::delayUntilNextPacket() const
+    noexcept
+{
+    if (mTokens >= 1) {
+        return chrono::microseconds(0);
+    }
+
+    // At least 1 microsecond: timer with zero delay would be fired immediately
+    // and would not accumulate any token.
+    const auto kDelay = static_cast<chrono::microseconds::rep>((1 - mTokens) / mStats.rate * 1000000) + 1;
+    return chrono::microseconds(kDelay);
+}
+
+void PacketsRateController::onPacketsSent(
+    const size_t packetsCount)
+    noexcept
+{
+    mTokens -= packetsCount;
+    mStats.packetsSent += packetsCount;
+}
+
+void PacketsRateController::onPacketsRetransmitted(
+    const size_t packetsCount)
+    noexcept
+{
+    mStats.packetsRetransmitted += packetsCount;
+}
+
+void PacketsRateController::onSendingDelayed()
+    noexcept
+{
+    mStats.delayedSendings += 1;
+}
+
+void PacketsRateController::onRTTMeasured(
+    const chrono::microseconds &rtt)
+    noexcept
+{
+    const auto kRTT = rtt < kMinRTT() ? kMinRTT() : rtt;
+    if (not mRTTMeasured) {
+        mRTTMeasured = true;
+        mStats.smoothedRTT = kRTT;
+
+    } else {
+        mStats.smoothedRTT = (mStats.smoothedRTT * 7 + kRTT) / 8;
+    }
+
+    updateRate();
+}
+
+void PacketsRateController::onPacketsDelivered(
+    const size_t packetsCount)
+    noexcept
+{
+    mStats.packetsDelivered += packetsCount;
+
+    if (mSlowStart) {
+        mStats.congestionWindow += packetsCount;
+    } else {
+        mStats.congestionWindow += packetsCount / mStats.congestionWindow;
+    }
+
+    if (mStats.congestionWindow > kMaxCongestionWindow) {
+        mStats.congestionWindow = kMaxCongestionWindow;
+    }
+
+    updateRate();
+}
+
+void PacketsRateController::onPacketsLost(
+    const size_t packetsCount,
+    const TimePoint &now)
+    noexcept
+{
+    mStats.packetsLost += packetsCount;
+
+    if (now - mLastWindowDecrease < mStats.smoothedRTT) {
+        return;
+    }
+
+    mLastWindowDecrease = now;
+    mSlowStart = false;
+    mStats.lossEvents += 1;
+
+    mStats.congestionWindow *= kWindowDecreaseFactor;
+    if (mStats.congestionWindow < kMinCongestionWindow) {
+        mStats.congestionWindow = kMinCongestionWindow;
+    }
+
+    updateRate();
+}
+
+const PacketsRateController::Stats& PacketsRateController::stats() const
+    noexcept
+{
+    return mStats;
+}
+
+void PacketsRateController::updateRate()
+    noexcept
+{
+    mStats.rate = mStats.congestionWindow / chrono::duration<double>(mStats.smoothedRTT).count();
+}
+
+chrono::microseconds PacketsRateController::kInitialRTT()
+    noexcept
+{
+    static const chrono::microseconds kRTT(20000);
+    return kRTT;
+}
+
+/**
+ * @returns lower bound of the RTT samples.
+ * Prevents unlimited rate on the loopback and on the very fast links.
+ */
+chrono::microseconds PacketsRateController::kMinRTT()
+    noexcept
+{
+    static const chrono::microseconds kRTT(100);
+    return kRTT;
+}
@@ -0,0 +1,136 @@
+/**
+ * This file is part of GEO Project.
+ * It is subject to the license terms in the LICENSE.md file found in the top-level directory
+ * of this distribution and at https://github.com/GEO-Project/GEO-Project/blob/master/LICENSE.md
+ *
+ * No part of GEO Project, including this file, may be copied, modified, propagated, or distributed
+ * except according to the terms contained in the LICENSE.md file.
+ */
+
+#ifndef GEO_NETWORK_CLIENT_PACKETSRATECONTROLLER_H
+#define GEO_NETWORK_CLIENT_PACKETSRATECONTROLLER_H
+
+#include "../common/Types.h"
+
+#include <chrono>
+
+
+using namespace std;
+
+
+/**
+ * Paces packets, that are sent to one remote node.
+ *
+ * Packets are sent only when the token bucket of the node contains enough tokens.
+ * Bucket is refilled with the rate of (congestion window / smoothed RTT) packets per second,
+ * and its capacity (max burst) is equal to the congestion window.
+ *
+ * Congestion window is adjusted by the feedback of the remote node:
+ *   - delivered packets (acknowledged multi-packet messages) increase the window:
+ *     exponentially until the first loss (slow start), and linearly after it;
+ *   - lost packets (missing packets requests) decrease the window multiplicatively,
+ *     but not more often than once per RTT (one loss event may be reported by several requests).
+ *
+ * RTT is measured on the acknowledgements of the messages, that was not retransmitted,
+ * and on the packet size confirmations.
+ */
+class PacketsRateController {
+public:
+    struct Stats {
+        // Current pacing rate, packets per second.
+        double rate;
+        double congestionWindow;
+        chrono::microseconds smoothedRTT;
+
+        size_t packetsSent;
+        size_t packetsRetransmitted;
+        size_t packetsDelivered;
+        size_t packetsLost;
+        size_t lossEvents;
+        size_t delayedSendings;
+    };
+
+public:
+    PacketsRateController()
+        noexcept;
+
+    /**
+     * Adds tokens, that was accumulated since the previous refill.
+     */
+    void refill(
+        const TimePoint &now)
+        noexcept;
+
+    /**
+     * @returns count of packets, that may be sent right now.
+     */
+    size_t availablePackets() const
+        noexcept;
+
+    /**
+     * @returns time, after which at least one packet would be available for the sending.
+     */
+    chrono::microseconds delayUntilNextPacket() const
+        noexcept;
+
+    void onPacketsSent(
+        const size_t packetsCount)
+        noexcept;
+
+    void onPacketsRetransmitted(
+        const size_t packetsCount)
+        noexcept;
+
+    void onSendingDelayed()
+        noexcept;
+
+    void onRTTMeasured(
+        const chrono::microseconds &rtt)
+        noexcept;
+
+    void onPacketsDelivered(
+        const size_t packetsCount)
+        noexcept;
+
+    void onPacketsLost(
+        const size_t packetsCount,
+        const TimePoint &now)
+        noexcept;
+
+    const Stats& stats() const
+        noexcept;
+
+protected:
+    // Initial window and RTT give the same rate, as the previously used fixed throttle (30 packets per 20ms).
+    static const constexpr double kInitialCongestionWindow = 30;
+    static const constexpr double kMinCongestionWindow = 4;
+    static const constexpr double kMaxCongestionWindow = 4096;
+
+    // Window decrease factor on the loss event.
+    static const constexpr double kWindowDecreaseFactor = 0.7;
+
+    // Max count of packets, that might be sent in one burst.
+    static const constexpr double kMaxBurst = 256;
+
+    static chrono::microseconds kInitialRTT()
+        noexcept;
+
+    static chrono::microseconds kMinRTT()
+        noexcept;
+
+protected:
+    void updateRate()
+        noexcept;
+
+protected:
+    Stats mStats;
+
+    double mTokens;
+    TimePoint mLastRefill;
+
+    bool mSlowStart;
+    bool mRTTMeasured;
+    TimePoint mLastWindowDecrease;
+};
+
+#endif //GEO_NETWORK_CLIENT_PACKETSRATECONTROLLER_H
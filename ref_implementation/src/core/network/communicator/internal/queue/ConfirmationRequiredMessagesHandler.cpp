@@ -19,14 +19,17 @@ ConfirmationRequiredMessagesHandler::ConfirmationRequiredMessagesHandler(
     LoggerMixin(logger),
     mCommunicatorStorageHandler(communicatorStorageHandler),
     mIOService(ioService),
-    mCleaningTimer(ioService)
+    mCleaningTimer(ioService),
+    mIsJournalFlushingScheduled(false),
+    mJournalFlushingTimer(ioService),
+    mJournalFlushingRetryTimeoutSeconds(kJournalFlushingMinRetryTimeoutSeconds)
 {
     mDeserializationMessagesTimer = make_unique<as::steady_timer>(
         mIOService);
     deserializeMessages();
 }
 
-void ConfirmationRequiredMessagesHandler::tryEnqueueMessage(
+bool ConfirmationRequiredMessagesHandler::tryEnqueueMessage(
     const NodeUUID &contractorUUID,
     const Message::Shared message)
 {
@@ -39,8 +42,7 @@ void ConfirmationRequiredMessagesHandler::tryEnqueueMessage(
         // Appropriate message occurred and must be enqueued.
         // In case if no queue is present for this contractor - new one must be created.
         if (mQueues.count(contractorUUID) == 0) {
-            auto newQueue = make_shared<ConfirmationRequiredMessagesQueue>(
-                contractorUUID);
+            auto newQueue = createQueue(contractorUUID);
             newQueue->signalSaveMessageToStorage.connect(
                 boost::bind(
                     &ConfirmationRequiredMessagesHandler::addMessageToStorage,
@@ -53,25 +55,31 @@ void ConfirmationRequiredMessagesHandler::tryEnqueueMessage(
                     this,
                     _1,
                     _2));
-            mQueues[contractorUUID] = newQueue;
+
+            // Timeout of the new queue might be closer, than the timeout of the resending timer.
+            // (Deserialized messages are resent only after the delay, so the timer must not be touched till then.)
+            if (mDeserializationMessagesTimer == nullptr
+                and mQueuesSchedule.earliest() == newQueue) {
+                rescheduleResending();
+            }
         }
 
-        ioTransactionUnique = mCommunicatorStorageHandler->beginTransactionUnique();
         mQueues[contractorUUID]->enqueue(
             static_pointer_cast<TransactionMessage>(message));
-        ioTransactionUnique = nullptr;
+
+        mMessagesAwaitingStoring.push_back(
+            make_pair(
+                contractorUUID,
+                static_pointer_cast<TransactionMessage>(message)));
+        scheduleJournalFlushing();
 
 #ifdef DEBUG_LOG_NETWORK_COMMUNICATOR
         debug() << "Message of type " << message->typeID() << " enqueued for confirmation receiving.";
 #endif
-
-        if (mQueues.size() == 1
-            and mQueues.begin()->second->size() == 1) {
-
-            // First message was added for further re-sending.
-            rescheduleResending();
-        }
+        return true;
     }
+
+    return false;
 }
 
 void ConfirmationRequiredMessagesHandler::tryProcessConfirmation(
@@ -95,10 +103,10 @@ void ConfirmationRequiredMessagesHandler::tryProcessConfirmation(
             info() << "Contractor " << contractorUUID << " reject incoming TL";
         }
 
-        auto ioTransaction = mCommunicatorStorageHandler->beginTransaction();
-        ioTransaction->communicatorMessagesQueueHandler()->deleteRecord(
+        mCommunicatorStorageHandler->journalMessageRemoving(
             contractorUUID,
             confirmationMessage->transactionUUID());
+        scheduleJournalFlushing();
 
 #ifdef DEBUG_LOG_NETWORK_COMMUNICATOR
         debug() << "Confirmation for message with transaction UUID " << confirmationMessage->transactionUUID() << " received. "
@@ -108,6 +116,7 @@ void ConfirmationRequiredMessagesHandler::tryProcessConfirmation(
         // In case if last message was removed from the queue -
         // the queue itself must be removed too.
         if (queue->size() == 0) {
+            mQueuesSchedule.remove(queue);
             mQueues.erase(contractorUUID);
         }
     }
@@ -122,21 +131,11 @@ const string ConfirmationRequiredMessagesHandler::logHeader() const
 const DateTime ConfirmationRequiredMessagesHandler::closestQueueSendingTimestamp() const
     noexcept
 {
-    DateTime nextClearingDateTime = utc_now() + boost::posix_time::seconds(2);
-    bool nextClearingDateTimeInitialisedWithFirstTimestamp = false;
-
-    for (const auto &contractorUUIDAndQueue : mQueues) {
-        const auto kQueueNextAttemptPlanned = contractorUUIDAndQueue.second->nextSendingAttemptDateTime();
-
-        if (not nextClearingDateTimeInitialisedWithFirstTimestamp) {
-            nextClearingDateTime = kQueueNextAttemptPlanned;
-
-        } else if (kQueueNextAttemptPlanned < nextClearingDateTime) {
-            nextClearingDateTime = kQueueNextAttemptPlanned;
-        }
+    if (mQueuesSchedule.empty()) {
+        return utc_now() + boost::posix_time::seconds(2);
     }
 
-    return nextClearingDateTime;
+    return mQueuesSchedule.earliest()->nextSendingAttemptDateTime();
 }
 
 void ConfirmationRequiredMessagesHandler::rescheduleResending()
@@ -172,34 +171,53 @@ void ConfirmationRequiredMessagesHandler::rescheduleResending()
     });
 }
 
-void ConfirmationRequiredMessagesHandler::sendPostponedMessages() const
+void ConfirmationRequiredMessagesHandler::sendPostponedMessages()
 {
     const auto now = utc_now();
 
-    for (const auto &contractorUUIDAndQueue : mQueues) {
-        const auto kContractor = contractorUUIDAndQueue.first;
-        const auto kQueue = contractorUUIDAndQueue.second;
-
+    while (not mQueuesSchedule.empty()) {
+        const auto kQueue = mQueuesSchedule.earliest();
         if (kQueue->nextSendingAttemptDateTime() > now) {
-            // This queue's timeout is not fired up yet.
-            continue;
+            // Timeouts of this queue and of all the next ones are not fired up yet.
+            break;
         }
 
-        for (const auto &transactionUUIDAndMessage : kQueue->messages()) {
+        // Getting of the messages moves the next sending attempt of the queue forward,
+        // so the queue must be moved to its new place in the schedule.
+        const auto &kMessages = kQueue->messages();
+        mQueuesSchedule.update(kQueue);
+
+        for (const auto &transactionUUIDAndMessage : kMessages) {
+            if (isAwaitingStoring(transactionUUIDAndMessage.second)) {
+                // Message must not be sent until it is written to the storage.
+                continue;
+            }
+
             signalOutgoingMessageReady(
                 make_pair(
-                    kContractor,
+                    kQueue->contractorUUID(),
                     transactionUUIDAndMessage.second));
         }
     }
 }
 
+ConfirmationRequiredMessagesQueue::Shared ConfirmationRequiredMessagesHandler::createQueue(
+    const NodeUUID &contractorUUID)
+{
+    auto queue = make_shared<ConfirmationRequiredMessagesQueue>(
+        contractorUUID);
+    mQueues[contractorUUID] = queue;
+    mQueuesSchedule.push(queue);
+    return queue;
+}
+
 void ConfirmationRequiredMessagesHandler::addMessageToStorage(
     const NodeUUID &contractorUUID,
     Message::Shared message)
 {
-    auto bufferAndSize = message->serializeToBytes();
-    ioTransactionUnique->communicatorMessagesQueueHandler()->saveRecord(
+    // Stored messages are independent from the encodings, that are supported by the remote nodes.
+    auto bufferAndSize = message->serializeToBytes(FixedAmountsEncoding);
+    mCommunicatorStorageHandler->journalMessageSaving(
         contractorUUID,
         (static_pointer_cast<TransactionMessage>(message))->transactionUUID(),
         message->typeID(),
@@ -211,11 +229,80 @@ void ConfirmationRequiredMessagesHandler::removeMessageFromStorage(
     const NodeUUID &contractorUUID,
     Message::SerializedType messageType)
 {
-    ioTransactionUnique->communicatorMessagesQueueHandler()->deleteRecord(
+    mCommunicatorStorageHandler->journalMessageRemoving(
         contractorUUID,
         messageType);
 }
 
+void ConfirmationRequiredMessagesHandler::scheduleJournalFlushing()
+{
+    if (mIsJournalFlushingScheduled) {
+        return;
+    }
+
+    mIsJournalFlushingScheduled = true;
+    mIOService.post(
+        boost::bind(
+            &ConfirmationRequiredMessagesHandler::flushJournal,
+            this));
+}
+
+void ConfirmationRequiredMessagesHandler::flushJournal()
+{
+    try {
+        mCommunicatorStorageHandler->flushJournal();
+
+    } catch (exception &e) {
+        // Journal is kept by the storage handler, so all the changes would be written by the next attempt.
+        // Enqueued messages are not sent until then.
+        mLog.error(logHeader()) << "Enqueued messages can't be written to the storage. "
+                                << "Next attempt would be performed in "
+                                << mJournalFlushingRetryTimeoutSeconds << " seconds. Details: " << e.what();
+        scheduleJournalFlushingRetry();
+        return;
+    }
+
+    mIsJournalFlushingScheduled = false;
+    mJournalFlushingRetryTimeoutSeconds = kJournalFlushingMinRetryTimeoutSeconds;
+
+    vector<pair<NodeUUID, TransactionMessage::Shared>> messages;
+    messages.swap(mMessagesAwaitingStoring);
+    for (const auto &contractorUUIDAndMessage : messages) {
+        signalOutgoingMessageReady(contractorUUIDAndMessage);
+    }
+}
+
+void ConfirmationRequiredMessagesHandler::scheduleJournalFlushingRetry()
+{
+    // "mIsJournalFlushingScheduled" is left set, so no other flushing would be posted till the retry.
+    mJournalFlushingTimer.expires_from_now(
+        chrono::seconds(mJournalFlushingRetryTimeoutSeconds));
+    mJournalFlushingTimer.async_wait([this] (const boost::system::error_code &e) {
+
+        if (e == boost::asio::error::operation_aborted) {
+            return;
+        }
+
+        this->flushJournal();
+    });
+
+    if (mJournalFlushingRetryTimeoutSeconds < kJournalFlushingMaxRetryTimeoutSeconds) {
+        mJournalFlushingRetryTimeoutSeconds *= 2;
+    }
+}
+
+bool ConfirmationRequiredMessagesHandler::isAwaitingStoring(
+    const TransactionMessage::Shared message) const
+    noexcept
+{
+    for (const auto &contractorUUIDAndMessage : mMessagesAwaitingStoring) {
+        if (contractorUUIDAndMessage.second == message) {
+            return true;
+        }
+    }
+    return false;
+}
+
 void ConfirmationRequiredMessagesHandler::deserializeMessages()
 {
     vector<tuple<const NodeUUID, BytesShared, Message::SerializedType>> messages;
@@ -224,6 +311,9 @@ void ConfirmationRequiredMessagesHandler::deserializeMessages()
         messages = ioTransaction->communicatorMessagesQueueHandler()->allMessages();
     }
     if (messages.empty()) {
+        // There is nothing to resend with the delay,
+        // so the resending is scheduled as usual (on the first enqueued message).
+        mDeserializationMessagesTimer = nullptr;
         return;
     }
     this->warning() << "Serialized messages count: " << messages.size();
@@ -295,15 +385,11 @@ void ConfirmationRequiredMessagesHandler::tryEnqueueMessageWithoutConnectingSign
         // Appropriate message occurred and must be enqueued.
         // In case if no queue is present for this contractor - new one must be created.
         if (mQueues.count(contractorUUID) == 0) {
-            auto newQueue = make_shared<ConfirmationRequiredMessagesQueue>(
-                contractorUUID);
-            mQueues[contractorUUID] = newQueue;
+            createQueue(contractorUUID);
         }
 
-        ioTransactionUnique = mCommunicatorStorageHandler->beginTransactionUnique();
         mQueues[contractorUUID]->enqueue(
             static_pointer_cast<TransactionMessage>(message));
-        ioTransactionUnique = nullptr;
 
 #ifdef DEBUG_LOG_NETWORK_COMMUNICATOR
         debug() << "Message of type " << message->typeID() << " enqueued for confirmation receiving.";
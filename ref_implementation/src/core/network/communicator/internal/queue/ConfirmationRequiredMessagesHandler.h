@@ -11,6 +11,7 @@
 #define CONFIRMATIONREQUIREDMESSAGESHANDLER_H
 
 #include "ConfirmationRequiredMessagesQueue.h"
+#include "ConfirmationRequiredQueuesSchedule.h"
 #include "../../internal/common/Types.h"
 #include "../../../../common/exceptions/RuntimeError.h"
 #include "../../../../logger/LoggerMixin.hpp"
@@ -22,8 +23,9 @@
 
 #include <boost/asio/steady_timer.hpp>
 #include <boost/signals2.hpp>
+#include <boost/functional/hash.hpp>
 
-#include <map>
+#include <unordered_map>
 
 
 using namespace std;
@@ -67,6 +69,10 @@ public:
      * and messages of this queue must be sent to the remote node once more time.
      *
      * This signal would be emitted for each message in the queue.
+     *
+     * Also, this signal is emitted for the first sending of each enqueued message,
+     * right after the message was written to the storage.
+     * Messages that are not written yet are never sent (even by the re-sending).
      */
     signals::signal<void(pair<NodeUUID, TransactionMessage::Shared>)> signalOutgoingMessageReady;
 
@@ -86,8 +92,11 @@ public:
      *
      * @param contractorUUID - remote node UUID.
      * @param message - message that must be confirmed by the remote node.
+     *
+     * @returns "true" in case if message was enqueued. Such message must not be sent directly:
+     * it would be sent via "signalOutgoingMessageReady" as soon as it would be written to the storage.
      */
-    void tryEnqueueMessage(
+    bool tryEnqueueMessage(
         const NodeUUID &contractorUUID,
         const Message::Shared message);
 
@@ -106,9 +115,8 @@ protected:
         noexcept;
 
     /**
-     * @returns timestamp, when next timer awakeness must be performed.
-     * This method checks all queues and returns the smalles one time duration,
-     * between now and queue timeout.
+     * @returns timestamp, when next timer awakeness must be performed
+     * (next sending attempt of the earliest scheduled queue).
      */
     const DateTime closestQueueSendingTimestamp() const
         noexcept;
@@ -121,8 +129,12 @@ protected:
     /**
      * Sends postponed messages to the remote nodes.
      * This method would be called every time when some queue timeout would fire up.
+     * Only queues, which timeouts are fired up, are processed.
      */
-    void sendPostponedMessages() const;
+    void sendPostponedMessages();
+
+    ConfirmationRequiredMessagesQueue::Shared createQueue(
+        const NodeUUID &contractorUUID);
 
     void addMessageToStorage(
         const NodeUUID &contractorUUID,
@@ -132,6 +144,31 @@ protected:
         const NodeUUID &contractorUUID,
         Message::SerializedType messageType);
 
+    /**
+     * Schedules writing of the storage journal at the end of the current IO service cycle,
+     * so all the changes of the cycle are written in one transaction.
+     */
+    void scheduleJournalFlushing();
+
+    /**
+     * Writes storage journal and sends the messages, that was waiting for it.
+     * In case of error - messages are kept unsent, and the writing is retried later.
+     */
+    void flushJournal();
+
+    /**
+     * Schedules next attempt of the journal writing.
+     * Timeout between the attempts exponentially increases, up to the "kJournalFlushingMaxRetryTimeoutSeconds".
+     */
+    void scheduleJournalFlushingRetry();
+
+    /**
+     * @returns "true" in case if "message" was enqueued, but is not written to the storage yet.
+     */
+    bool isAwaitingStoring(
+        const TransactionMessage::Shared message) const
+        noexcept;
+
     void deserializeMessages();
 
     void tryEnqueueMessageWithoutConnectingSignalsToSlots(
@@ -142,16 +179,17 @@ protected:
 
 protected:
     static const uint16_t kMessagesDeserializationDelayedSecondsTime = 150;
+    static const uint16_t kJournalFlushingMinRetryTimeoutSeconds = 1;
+    static const uint16_t kJournalFlushingMaxRetryTimeoutSeconds = 60;
 
 protected:
     /**
-     * Map is used because it is expected,
-     * that queues count would very rarely grow more than 200-300 objects.
-     *
-     * Current GCC realisation of the "map" and "unordered_map"
-     * makes simple "map" faster up to several thousand of items.
+     * Gateways might have tens of thousands of queues (one per each contractor),
+     * so hash map is used, and queues are ordered by their timeouts in the separate schedule.
+     * Resending timer is always set to the timeout of the earliest queue of the schedule.
      */
-    map<NodeUUID, ConfirmationRequiredMessagesQueue::Shared> mQueues;
+    unordered_map<NodeUUID, ConfirmationRequiredMessagesQueue::Shared, boost::hash<boost::uuids::uuid>> mQueues;
+    ConfirmationRequiredQueuesSchedule mQueuesSchedule;
 
     IOService &mIOService;
 
@@ -159,8 +197,14 @@ protected:
 
     as::steady_timer mCleaningTimer;
 
-    // this field used for removing and adding messages to storage during enqueue messages
-    unique_ptr<CommunicatorIOTransaction> ioTransactionUnique;
+    bool mIsJournalFlushingScheduled;
+
+    // Enqueued messages, that would be sent right after they would be written to the storage.
+    vector<pair<NodeUUID, TransactionMessage::Shared>> mMessagesAwaitingStoring;
+
+    // Used for retrying of the journal writing in case of storage errors.
+    as::steady_timer mJournalFlushingTimer;
+    uint16_t mJournalFlushingRetryTimeoutSeconds;
 
     unique_ptr<as::steady_timer> mDeserializationMessagesTimer;
 };
@@ -13,7 +13,8 @@
 ConfirmationRequiredMessagesQueue::ConfirmationRequiredMessagesQueue(
     const NodeUUID &contractorUUID)
     noexcept:
-    mContractorUUID(contractorUUID)
+    mContractorUUID(contractorUUID),
+    mSchedulePosition(kNotScheduled)
 {
     resetInternalTimeout();
     mNextSendingAttemptDateTime = utc_now() + boost::posix_time::seconds(mNextTimeoutSeconds);
@@ -84,6 +85,12 @@ const size_t ConfirmationRequiredMessagesQueue::size() const
     return mMessages.size();
 }
 
+const NodeUUID &ConfirmationRequiredMessagesQueue::contractorUUID() const
+    noexcept
+{
+    return mContractorUUID;
+}
+
 void ConfirmationRequiredMessagesQueue::resetInternalTimeout()
     noexcept
 {
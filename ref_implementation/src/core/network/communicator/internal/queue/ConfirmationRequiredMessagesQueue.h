@@ -20,6 +20,7 @@
 #include <boost/signals2.hpp>
 
 #include <map>
+#include <limits>
 
 namespace signals = boost::signals2;
 
@@ -28,6 +29,8 @@ namespace signals = boost::signals2;
  * until appropriate confirmation would be received.
  */
 class ConfirmationRequiredMessagesQueue {
+    friend class ConfirmationRequiredQueuesSchedule;
+
 public:
     typedef shared_ptr<ConfirmationRequiredMessagesQueue> Shared;
 
@@ -74,6 +77,9 @@ public:
     const size_t size() const
         noexcept;
 
+    const NodeUUID &contractorUUID() const
+        noexcept;
+
 protected:
     /**
      * Sets re-sending timeout to the default value.
@@ -117,6 +123,10 @@ protected:
     DateTime mNextSendingAttemptDateTime;
 
     NodeUUID mContractorUUID;
+
+    // Position of the queue in the resending schedule (see ConfirmationRequiredQueuesSchedule).
+    static const size_t kNotScheduled = numeric_limits<size_t>::max();
+    size_t mSchedulePosition;
 };
 
 #endif // CONFIRMATIONREQUIREDMESSAGESQUEUE_H
@@ -0,0 +1,60 @@
+/**
+ * This file is part of GEO Project.
+ * It is subject to the license terms in the LICENSE.md file found in the top-level directory
+ * of this distribution and at https://github.com/GEO-Project/GEO-Project/blob/master/LICENSE.md
+ *
+ * No part of GEO Project, including this file, may be copied, modified, propagated, or distributed
+ * except according to the terms contained in the LICENSE.md file.
+ */
+
+#include "ConfirmationRequiredQueuesSchedule.h"
+
+
+void ConfirmationRequiredQueuesSchedule::push(
+    ConfirmationRequiredMessagesQueue::Shared queue)
+{
+    mHeap.push(move(queue));
+}
+
+void ConfirmationRequiredQueuesSchedule::update(
+    ConfirmationRequiredMessagesQueue::Shared queue)
+    noexcept
+{
+    if (not isScheduled(queue)) {
+        return;
+    }
+
+    mHeap.update(queue->mSchedulePosition);
+}
+
+void ConfirmationRequiredQueuesSchedule::remove(
+    ConfirmationRequiredMessagesQueue::Shared queue)
+    noexcept
+{
+    if (not isScheduled(queue)) {
+        return;
+    }
+
+    mHeap.remove(queue->mSchedulePosition);
+    queue->mSchedulePosition = ConfirmationRequiredMessagesQueue::kNotScheduled;
+}
+
+ConfirmationRequiredMessagesQueue::Shared ConfirmationRequiredQueuesSchedule::earliest() const
+    noexcept
+{
+    return mHeap.front();
+}
+
+bool ConfirmationRequiredQueuesSchedule::empty() const
+    noexcept
+{
+    return mHeap.empty();
+}
+
+bool ConfirmationRequiredQueuesSchedule::isScheduled(
+    const ConfirmationRequiredMessagesQueue::Shared &queue) const
+    noexcept
+{
+    const auto kPosition = queue->mSchedulePosition;
+    return kPosition < mHeap.size() and mHeap[kPosition] == queue;
+}
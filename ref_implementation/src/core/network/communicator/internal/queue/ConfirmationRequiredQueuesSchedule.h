@@ -0,0 +1,84 @@
+/**
+ * This file is part of GEO Project.
+ * It is subject to the license terms in the LICENSE.md file found in the top-level directory
+ * of this distribution and at https://github.com/GEO-Project/GEO-Project/blob/master/LICENSE.md
+ *
+ * No part of GEO Project, including this file, may be copied, modified, propagated, or distributed
+ * except according to the terms contained in the LICENSE.md file.
+ */
+
+#ifndef CONFIRMATIONREQUIREDQUEUESSCHEDULE_H
+#define CONFIRMATIONREQUIREDQUEUESSCHEDULE_H
+
+#include "ConfirmationRequiredMessagesQueue.h"
+
+#include "../../../../common/heap/IndexedMinHeap.hpp"
+
+
+/**
+ * Orders queues of the confirmation required messages by the time of their next sending attempt.
+ *
+ * Implemented as indexed binary min-heap. Position of each queue in the heap is stored in the queue itself,
+ * so the queue could be rescheduled or removed (on the last confirmation) without searching it.
+ *
+ * Earliest queue - O(1), push / update / remove - O(log n).
+ */
+class ConfirmationRequiredQueuesSchedule {
+public:
+    void push(
+        ConfirmationRequiredMessagesQueue::Shared queue);
+
+    /**
+     * Restores the order of the queue, after its next sending attempt time was changed.
+     */
+    void update(
+        ConfirmationRequiredMessagesQueue::Shared queue)
+        noexcept;
+
+    void remove(
+        ConfirmationRequiredMessagesQueue::Shared queue)
+        noexcept;
+
+    /**
+     * @returns queue with the closest sending attempt.
+     * Schedule must not be empty.
+     */
+    ConfirmationRequiredMessagesQueue::Shared earliest() const
+        noexcept;
+
+    bool empty() const
+        noexcept;
+
+protected:
+    struct EarlierSendingAttempt {
+        bool operator()(
+            const ConfirmationRequiredMessagesQueue::Shared &first,
+            const ConfirmationRequiredMessagesQueue::Shared &second) const
+            noexcept
+        {
+            return first->nextSendingAttemptDateTime() < second->nextSendingAttemptDateTime();
+        }
+    };
+
+    struct SchedulePosition {
+        size_t &operator()(
+            const ConfirmationRequiredMessagesQueue::Shared &queue) const
+            noexcept
+        {
+            return queue->mSchedulePosition;
+        }
+    };
+
+protected:
+    bool isScheduled(
+        const ConfirmationRequiredMessagesQueue::Shared &queue) const
+        noexcept;
+
+protected:
+    IndexedMinHeap<
+        ConfirmationRequiredMessagesQueue::Shared,
+        EarlierSendingAttempt,
+        SchedulePosition> mHeap;
+};
+
+#endif // CONFIRMATIONREQUIREDQUEUESSCHEDULE_H
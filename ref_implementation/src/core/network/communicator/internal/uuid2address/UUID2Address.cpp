@@ -12,24 +12,34 @@
 
 UUID2Address::UUID2Address(
     as::io_service &IOService,
+    CommunicatorStorageHandler *communicatorStorageHandler,
+    Logger &logger,
     const string host,
     const uint16_t port) :
 
-    mIOService(IOService),
-    mResolver(mIOService),
+    mPrefetchesInProgress(0),
+    mIsBatchLookupSupported(true),
     mServiceIP(host),
     mServicePort(port),
-    mQuery(mServiceIP, boost::lexical_cast<string>(mServicePort)),
-    mSocket(mIOService),
-    mRequestStream(&mRequest)
+    mIOService(IOService),
+    mCommunicatorStorageHandler(communicatorStorageHandler),
+    mLog(logger),
+    mResolver(mIOService),
+    mQuery(mServiceIP, boost::lexical_cast<string>(mServicePort))
 {
     mEndpointIterator = mResolver.resolve(mQuery);
-}
 
-UUID2Address::~UUID2Address()
-{
-    mRequest.consume(mRequest.size());
-    mSocket.close();
+    stringstream serviceHost;
+    serviceHost << mServiceIP << ":" << mServicePort;
+    for (size_t connectionNumber = 0; connectionNumber < kConnectionsCount; ++connectionNumber) {
+        mConnections.push_back(
+            make_unique<UUID2AddressConnection>(
+                mIOService,
+                mEndpointIterator,
+                serviceHost.str()));
+    }
+
+    loadStoredRecords();
 }
 
 void UUID2Address::registerInGlobalCache(
@@ -52,74 +62,37 @@ void UUID2Address::registerInGlobalCache(
          << "}";
 
 
-    mRequest.consume(mRequest.size());
-    mRequestStream << "POST " << url.str() << " HTTP/1.0\r\n";
-    mRequestStream << "Host: " << host.str() << "\r\n";
-    mRequestStream << "Accept: */*\r\n";
-    mRequestStream << "Content-Length: " << body.str().length() << "\r\n";
-    mRequestStream << "Content-Type: application/json\r\n";
-    mRequestStream << "Connection: close\r\n\r\n";
-    mRequestStream << body.str();
+    as::streambuf request;
+    std::ostream requestStream(&request);
+    requestStream << "POST " << url.str() << " HTTP/1.0\r\n";
+    requestStream << "Host: " << host.str() << "\r\n";
+    requestStream << "Accept: */*\r\n";
+    requestStream << "Content-Length: " << body.str().length() << "\r\n";
+    requestStream << "Content-Type: application/json\r\n";
+    requestStream << "Connection: close\r\n\r\n";
+    requestStream << body.str();
 
-    as::connect(mSocket, mEndpointIterator);
-    as::write(mSocket, mRequest);
+    // Registration is performed once, on the node start, before the IO service is run,
+    // so it is the only request to the global cache, that is sent synchronously.
+    tcp::socket socket(mIOService);
+    as::connect(socket, mEndpointIterator);
+    as::write(socket, request);
 
-    auto response = processResponse();
+    auto response = processResponse(socket);
     if (response.first != 200) {
         throw Exception("UUID2Address::registerInGlobalCache: "
                             "Cant issue the request.");
     }
 }
 
-UDPEndpoint& UUID2Address::fetchFromGlobalCache(
-    const NodeUUID &uuid)
+const pair<unsigned int, string> UUID2Address::processResponse(
+    tcp::socket &socket)
 {
-    std::stringstream url;
-    url << "/api/v1/nodes/"
-        << boost::lexical_cast<string>(uuid.stringUUID())
-        << "/";
-
-    std::stringstream host;
-    host << mServiceIP << ":" << mServicePort;
-
-    mRequest.consume(mRequest.size());
-    mRequestStream << "GET " << url.str() << " HTTP/1.0\r\n";
-    mRequestStream << "Host: " << host.str() << "\r\n";
-    mRequestStream << "Accept: */*\r\n";
-    mRequestStream << "Connection: close\r\n\r\n";
-
-    boost::asio::connect(mSocket, mEndpointIterator);
-    boost::asio::write(mSocket, mRequest);
-
-    auto result = processResponse();
-    switch (result.first) {
-    case 200: {
-        json data = json::parse(result.second)["data"];
-        string address = data.value("ip_address", "");
-        uint16_t port = static_cast<uint16_t>(data.value("port", -1));
-
-        mCache[uuid] = as::ip::udp::endpoint(
-            as::ip::address_v4::from_string(address),
-            port);
-
-        mLastAccessTime[uuid] = chrono::steady_clock::now();
-        return mCache[uuid];
-    }
-
-    default: {
-        throw NotFoundError(
-            "UUID2Address::fetchFromGlobalCache: "
-            "One or sevaral request parameters are invalid.");
-    }
-    }
-}
-
-const pair<unsigned int, string> UUID2Address::processResponse() {
 
     boost::asio::streambuf response;
     std::istream responseStream(&response);
 
-    boost::asio::read_until(mSocket, response, "\r\n");
+    boost::asio::read_until(socket, response, "\r\n");
 
     std::string httpVersion;
     responseStream >> httpVersion;
@@ -138,7 +111,7 @@ const pair<unsigned int, string> UUID2Address::processResponse() {
 
     switch (statusCode) {
         case 200: {
-            boost::asio::read_until(mSocket, response, "\r\n\r\n");
+            boost::asio::read_until(socket, response, "\r\n\r\n");
             string header;
             while (getline(responseStream, header) && header != "\r") {}
             if (response.size() > 0) {
@@ -173,13 +146,604 @@ const pair<unsigned int, string> UUID2Address::processResponse() {
     }
 }
 
+/**
+ * Only local cache is used: endpoints, that are not cached yet, must be resolved by the "resolveEndpoint()".
+ *
+ * @throws NotFoundError in case if endpoint of the node is not cached, or is already expired.
+ */
 UDPEndpoint& UUID2Address::endpoint (
     const NodeUUID &contractorUUID)
 {
-    if (mCache.count(contractorUUID) > 0) {
+    if (not isEndpointCached(contractorUUID)) {
+        throw NotFoundError(
+            "UUID2Address::endpoint: "
+            "Endpoint of the node is not cached.");
+    }
+
+    mLastAccessTime[contractorUUID] = chrono::steady_clock::now();
+    return mCache[contractorUUID];
+}
+
+Packet::Size UUID2Address::packetSize(
+    const NodeUUID &contractorUUID) const
+    noexcept
+{
+    const auto kPacketSize = mPacketsSizes.find(contractorUUID);
+    if (kPacketSize == mPacketsSizes.cend()) {
+        return Packet::kDefaultSize;
+    }
+
+    return kPacketSize->second;
+}
+
+void UUID2Address::setPacketSize(
+    const NodeUUID &contractorUUID,
+    const Packet::Size packetSize)
+{
+    mPacketsSizes[contractorUUID] = packetSize;
+}
+
+bool UUID2Address::isCRC32CSupported(
+    const NodeUUID &contractorUUID) const
+    noexcept
+{
+    return mCRC32CNodes.count(contractorUUID) > 0;
+}
+
+void UUID2Address::setCRC32CSupported(
+    const NodeUUID &contractorUUID)
+{
+    mCRC32CNodes.insert(contractorUUID);
+}
+
+bool UUID2Address::isCompactAmountsSupported(
+    const NodeUUID &contractorUUID) const
+    noexcept
+{
+    return mCompactAmountsNodes.count(contractorUUID) > 0;
+}
+
+void UUID2Address::setCompactAmountsSupported(
+    const NodeUUID &contractorUUID)
+{
+    mCompactAmountsNodes.insert(contractorUUID);
+}
+
+bool UUID2Address::isEndpointCached(
+    const NodeUUID &contractorUUID) const
+    noexcept
+{
+    const auto kExpirationTime = mExpirationTimes.find(contractorUUID);
+    if (kExpirationTime == mExpirationTimes.cend()) {
+        return false;
+    }
+
+    return kExpirationTime->second > chrono::steady_clock::now();
+}
+
+void UUID2Address::resolveEndpoint(
+    const NodeUUID &contractorUUID,
+    EndpointHandler handler)
+    noexcept
+{
+    try {
+        if (isEndpointCached(contractorUUID)) {
+            mLastAccessTime[contractorUUID] = chrono::steady_clock::now();
+            const auto kEndpoint = mCache[contractorUUID];
+            mIOService.post([handler, kEndpoint] {
+                handler(boost::system::error_code(), kEndpoint);
+            });
+            return;
+        }
+
+        if (isNodeNotFound(contractorUUID)) {
+            mIOService.post([handler] {
+                handler(as::error::host_not_found, UDPEndpoint());
+            });
+            return;
+        }
+
+        auto pendingLookup = mPendingLookups.find(contractorUUID);
+        if (pendingLookup != mPendingLookups.end()) {
+            pendingLookup->second.push_back(handler);
+            return;
+        }
+
+        mPendingLookups[contractorUUID].push_back(handler);
+        beginLookup(contractorUUID);
+
+    } catch (exception &) {
+        mIOService.post([handler] {
+            handler(as::error::no_memory, UDPEndpoint());
+        });
+    }
+}
+
+/**
+ * @returns connection with the smallest count of pending requests.
+ */
+UUID2AddressConnection& UUID2Address::connection()
+    noexcept
+{
+    auto leastLoadedConnection = mConnections.front().get();
+    for (const auto &connection : mConnections) {
+        if (connection->pendingRequestsCount() < leastLoadedConnection->pendingRequestsCount()) {
+            leastLoadedConnection = connection.get();
+        }
+    }
+    return *leastLoadedConnection;
+}
+
+void UUID2Address::beginLookup(
+    const NodeUUID &contractorUUID)
+    noexcept
+{
+    connection().sendRequest(
+        "GET",
+        "/api/v1/nodes/" + contractorUUID.stringUUID() + "/",
+        string(),
+        [this, contractorUUID] (
+            const boost::system::error_code &error,
+            const unsigned int statusCode,
+            const string &responseBody) {
+
+            onLookupResponseReceived(
+                contractorUUID,
+                error,
+                statusCode,
+                responseBody);
+        });
+}
+
+void UUID2Address::onLookupResponseReceived(
+    const NodeUUID &contractorUUID,
+    const boost::system::error_code &error,
+    const unsigned int statusCode,
+    const string &responseBody)
+    noexcept
+{
+    if (error) {
+        finishLookup(contractorUUID, error);
+        return;
+    }
+
+    if (statusCode == 404) {
+        cacheNotFoundNode(contractorUUID);
+        flushStoredRecords();
+        finishLookup(contractorUUID, as::error::host_not_found);
+        return;
+    }
+
+    if (statusCode != 200) {
+        finishLookup(contractorUUID, as::error::try_again);
+        return;
+    }
+
+    try {
+        cacheEndpoint(contractorUUID, parseEndpoint(responseBody));
+        flushStoredRecords();
         mLastAccessTime[contractorUUID] = chrono::steady_clock::now();
-        return mCache[contractorUUID];
+        finishLookup(contractorUUID, boost::system::error_code());
+
+    } catch (exception &) {
+        finishLookup(contractorUUID, as::error::try_again);
+    }
+}
+
+/**
+ * Requests endpoints of several nodes at once:
+ * request body contains the list of UUIDs, response - endpoints of the known nodes (by UUID).
+ * Nodes, that are absent in the response, are unknown to the service.
+ */
+void UUID2Address::beginBatchLookup(
+    const vector<NodeUUID> &contractorsUUIDs)
+    noexcept
+{
+    try {
+        json request;
+        request["uuids"] = json::array();
+        for (const auto &contractorUUID : contractorsUUIDs) {
+            request["uuids"].push_back(contractorUUID.stringUUID());
+        }
+
+        connection().sendRequest(
+            "POST",
+            "/api/v1/nodes/batch/",
+            request.dump(),
+            [this, contractorsUUIDs] (
+                const boost::system::error_code &error,
+                const unsigned int statusCode,
+                const string &responseBody) {
+
+                onBatchLookupResponseReceived(
+                    contractorsUUIDs,
+                    error,
+                    statusCode,
+                    responseBody);
+            });
+
+    } catch (exception &) {
+        // Batch was formed by the prefetching, so there are no handlers waiting for the lookups yet.
+        for (const auto &contractorUUID : contractorsUUIDs) {
+            mPendingLookups.erase(contractorUUID);
+        }
+        --mPrefetchesInProgress;
+    }
+}
+
+void UUID2Address::onBatchLookupResponseReceived(
+    const vector<NodeUUID> &contractorsUUIDs,
+    const boost::system::error_code &error,
+    const unsigned int statusCode,
+    const string &responseBody)
+    noexcept
+{
+    --mPrefetchesInProgress;
+
+    if (not error and (statusCode == 404 or statusCode == 405 or statusCode == 501)) {
+        // Service doesn't support batch lookups:
+        // nodes of this batch (and all the next ones) are requested one by one.
+        mIsBatchLookupSupported = false;
+        for (const auto &contractorUUID : contractorsUUIDs) {
+            beginLookup(contractorUUID);
+        }
+        beginNextPrefetches();
+        return;
+    }
+
+    if (error or statusCode != 200) {
+        for (const auto &contractorUUID : contractorsUUIDs) {
+            finishLookup(contractorUUID, error ? error : as::error::try_again);
+        }
+        beginNextPrefetches();
+        return;
+    }
+
+    try {
+        const json kData = json::parse(responseBody)["data"];
+        for (const auto &contractorUUID : contractorsUUIDs) {
+            const auto kRecord = kData.find(contractorUUID.stringUUID());
+            if (kRecord == kData.end()) {
+                cacheNotFoundNode(contractorUUID);
+                finishLookup(contractorUUID, as::error::host_not_found);
+                continue;
+            }
+
+            try {
+                cacheEndpoint(contractorUUID, endpointFromJSON(*kRecord));
+                finishLookup(contractorUUID, boost::system::error_code());
+
+            } catch (exception &) {
+                finishLookup(contractorUUID, as::error::try_again);
+            }
+        }
+
+    } catch (exception &) {
+        // Lookups, that are already finished, are ignored.
+        for (const auto &contractorUUID : contractorsUUIDs) {
+            finishLookup(contractorUUID, as::error::try_again);
+        }
     }
 
-    return fetchFromGlobalCache(contractorUUID);
+    // Records of the whole batch are written at once.
+    flushStoredRecords();
+
+    beginNextPrefetches();
+}
+
+/**
+ * Calls all handlers, that are waiting for the lookup of the node.
+ * In case of error - handlers receive the error and the empty endpoint.
+ *
+ * In case if the global cache is unreachable, but the expired endpoint of the node is still known -
+ * it is used instead of the error: nodes endpoints change rarely,
+ * and it is better to try the old one, than to drop the messages.
+ * Stale endpoint is prolonged for kStaleEndpointTTL(), so the service is not requested on each sending,
+ * while it is unreachable.
+ */
+void UUID2Address::finishLookup(
+    const NodeUUID &contractorUUID,
+    const boost::system::error_code &error)
+    noexcept
+{
+    auto pendingLookup = mPendingLookups.find(contractorUUID);
+    if (pendingLookup == mPendingLookups.end()) {
+        return;
+    }
+
+    const auto kHandlers = move(pendingLookup->second);
+    mPendingLookups.erase(pendingLookup);
+
+    if (error and error != as::error::host_not_found and mCache.count(contractorUUID) > 0) {
+        mExpirationTimes[contractorUUID] = chrono::steady_clock::now() + kStaleEndpointTTL();
+        const auto kStaleEndpoint = mCache[contractorUUID];
+        for (const auto &handler : kHandlers) {
+            handler(boost::system::error_code(), kStaleEndpoint);
+        }
+        return;
+    }
+
+    const auto kEndpoint = error ? UDPEndpoint() : mCache[contractorUUID];
+    for (const auto &handler : kHandlers) {
+        handler(error, kEndpoint);
+    }
+}
+
+/**
+ * @throws exception in case if response body doesn't contain valid endpoint.
+ */
+UDPEndpoint UUID2Address::parseEndpoint(
+    const string &responseBody)
+{
+    return endpointFromJSON(
+        json::parse(responseBody)["data"]);
+}
+
+/**
+ * @throws exception in case if data doesn't contain valid endpoint.
+ */
+UDPEndpoint UUID2Address::endpointFromJSON(
+    const json &data)
+{
+    string address = data.value("ip_address", "");
+    uint16_t port = static_cast<uint16_t>(data.value("port", -1));
+
+    return as::ip::udp::endpoint(
+        as::ip::address_v4::from_string(address),
+        port);
+}
+
+void UUID2Address::prefetchEndpoints(
+    const vector<NodeUUID> &contractorsUUIDs)
+    noexcept
+{
+    try {
+        for (const auto &contractorUUID : contractorsUUIDs) {
+            if (isEndpointCached(contractorUUID) or isNodeNotFound(contractorUUID)) {
+                continue;
+            }
+            mPrefetchQueue.push_back(contractorUUID);
+        }
+
+    } catch (exception &e) {
+        warning() << "prefetchEndpoints: can't enqueue nodes for prefetching. Details: " << e.what();
+    }
+
+    beginNextPrefetches();
+}
+
+void UUID2Address::beginNextPrefetches()
+    noexcept
+{
+    while (mPrefetchesInProgress < kMaxConcurrentPrefetches and not mPrefetchQueue.empty()) {
+        if (not mIsBatchLookupSupported) {
+            const auto kContractorUUID = mPrefetchQueue.front();
+            mPrefetchQueue.pop_front();
+
+            ++mPrefetchesInProgress;
+            resolveEndpoint(
+                kContractorUUID,
+                [this] (const boost::system::error_code &, const UDPEndpoint &) {
+                    --mPrefetchesInProgress;
+                    beginNextPrefetches();
+                });
+            continue;
+        }
+
+        vector<NodeUUID> batch;
+        try {
+            batch.reserve(kMaxBatchSize);
+            while (batch.size() < kMaxBatchSize and not mPrefetchQueue.empty()) {
+                const auto kContractorUUID = mPrefetchQueue.front();
+                mPrefetchQueue.pop_front();
+
+                if (isEndpointCached(kContractorUUID)
+                    or isNodeNotFound(kContractorUUID)
+                    or mPendingLookups.count(kContractorUUID) > 0) {
+                    continue;
+                }
+
+                // Lookup is registered as pending, so the resolving of the node would wait for the batch.
+                mPendingLookups[kContractorUUID];
+                batch.push_back(kContractorUUID);
+            }
+
+        } catch (exception &) {
+            if (batch.empty()) {
+                return;
+            }
+        }
+
+        if (batch.empty()) {
+            continue;
+        }
+
+        ++mPrefetchesInProgress;
+        beginBatchLookup(batch);
+    }
+}
+
+bool UUID2Address::isNodeNotFound(
+    const NodeUUID &contractorUUID) const
+    noexcept
+{
+    const auto kExpirationTime = mNotFoundNodes.find(contractorUUID);
+    if (kExpirationTime == mNotFoundNodes.cend()) {
+        return false;
+    }
+
+    return kExpirationTime->second > chrono::steady_clock::now();
+}
+
+void UUID2Address::cacheEndpoint(
+    const NodeUUID &contractorUUID,
+    const UDPEndpoint &endpoint)
+    noexcept
+{
+    const auto kExpirationTime = chrono::steady_clock::now() + kEndpointTTL();
+    mCache[contractorUUID] = endpoint;
+    mExpirationTimes[contractorUUID] = kExpirationTime;
+    mNotFoundNodes.erase(contractorUUID);
+
+    storeRecord(
+        contractorUUID,
+        endpoint.address().to_string(),
+        endpoint.port(),
+        kExpirationTime);
+}
+
+void UUID2Address::cacheNotFoundNode(
+    const NodeUUID &contractorUUID)
+    noexcept
+{
+    const auto kExpirationTime = chrono::steady_clock::now() + kNotFoundTTL();
+    mNotFoundNodes[contractorUUID] = kExpirationTime;
+
+    // Endpoint of the node (if any) is not removed from the cache:
+    // it would not be used until the record of the unknown node expires,
+    // but it could be used in case if the global cache would become unreachable after.
+    mExpirationTimes.erase(contractorUUID);
+
+    storeRecord(
+        contractorUUID,
+        string(),
+        0,
+        kExpirationTime);
+}
+
+/**
+ * Enqueues the record for the writing into the storage (see flushStoredRecords()).
+ * Expiration time is stored as GEO epoch timestamp,
+ * because steady clock has no meaning between restarts of the node.
+ */
+void UUID2Address::storeRecord(
+    const NodeUUID &contractorUUID,
+    const string &address,
+    const uint16_t port,
+    const TimePoint &expirationTime)
+    noexcept
+{
+    if (mCommunicatorStorageHandler == nullptr) {
+        return;
+    }
+
+    try {
+        const auto kTimeLeft = chrono::duration_cast<chrono::microseconds>(
+            expirationTime - chrono::steady_clock::now());
+
+        mUnstoredRecords.emplace_back(
+            contractorUUID,
+            address,
+            port,
+            microsecondsSinceGEOEpoch(utc_now()) + kTimeLeft.count());
+
+    } catch (exception &e) {
+        warning() << "storeRecord: can't store the record of the node " << contractorUUID
+                  << ". Details: " << e.what();
+    }
+}
+
+/**
+ * Writes all enqueued records in one transaction
+ * (so, only one fsync is performed for the whole lookup response).
+ */
+void UUID2Address::flushStoredRecords()
+    noexcept
+{
+    if (mUnstoredRecords.empty()) {
+        return;
+    }
+
+    vector<UUID2AddressCacheHandler::Record> records;
+    records.swap(mUnstoredRecords);
+
+    try {
+        auto ioTransaction = mCommunicatorStorageHandler->beginTransaction();
+        try {
+            for (const auto &record : records) {
+                ioTransaction->uuid2AddressCacheHandler()->saveRecord(
+                    get<0>(record),
+                    get<1>(record),
+                    get<2>(record),
+                    get<3>(record));
+            }
+
+        } catch (IOError &) {
+            ioTransaction->rollback();
+            throw;
+        }
+
+    } catch (exception &e) {
+        warning() << "flushStoredRecords: " << records.size() << " record(s) can't be stored. "
+                  << "Details: " << e.what();
+    }
+}
+
+void UUID2Address::loadStoredRecords()
+    noexcept
+{
+    if (mCommunicatorStorageHandler == nullptr) {
+        return;
+    }
+
+    try {
+        const auto kNow = microsecondsSinceGEOEpoch(utc_now());
+        const auto kSteadyNow = chrono::steady_clock::now();
+
+        auto ioTransaction = mCommunicatorStorageHandler->beginTransaction();
+        ioTransaction->uuid2AddressCacheHandler()->deleteExpiredNotFoundRecords(kNow);
+        for (const auto &record : ioTransaction->uuid2AddressCacheHandler()->allRecords()) {
+            const auto &kContractorUUID = get<0>(record);
+            const auto &kAddress = get<1>(record);
+            const auto kExpirationTime = kSteadyNow + chrono::microseconds(get<3>(record) - kNow);
+
+            if (kAddress.empty()) {
+                mNotFoundNodes[kContractorUUID] = kExpirationTime;
+                continue;
+            }
+
+            boost::system::error_code error;
+            const auto kIPAddress = as::ip::address_v4::from_string(kAddress, error);
+            if (error) {
+                continue;
+            }
+
+            mCache[kContractorUUID] = UDPEndpoint(kIPAddress, get<2>(record));
+            mExpirationTimes[kContractorUUID] = kExpirationTime;
+        }
+
+    } catch (exception &e) {
+        warning() << "loadStoredRecords: stored endpoints can't be loaded. Details: " << e.what();
+    }
+}
+
+LoggerStream UUID2Address::warning() const
+    noexcept
+{
+    return mLog.warning("UUID2Address");
+}
+
+chrono::seconds UUID2Address::kEndpointTTL()
+    noexcept
+{
+    static const chrono::seconds kTTL(60 * 60);
+    return kTTL;
+}
+
+chrono::seconds UUID2Address::kNotFoundTTL()
+    noexcept
+{
+    static const chrono::seconds kTTL(60);
+    return kTTL;
+}
+
+/**
+ * @returns period, during which expired endpoint is used without new lookups,
+ * after the global cache was found unreachable.
+ */
+chrono::seconds UUID2Address::kStaleEndpointTTL()
+    noexcept
+{
+    static const chrono::seconds kTTL(60);
+    return kTTL;
 }
@@ -11,11 +11,15 @@
 #define GEO_NETWORK_CLIENT_UUID2IP_H
 
 #include "../common/Types.h"
+#include "../common/Packet.hpp"
+#include "UUID2AddressConnection.h"
 
 #include "../../../../common/NodeUUID.h"
 #include "../../../../common/exceptions/ValueError.h"
 #include "../../../../common/exceptions/IOError.h"
 #include "../../../../common/exceptions/ConflictError.h"
+#include "../../../../common/time/TimeUtils.h"
+#include "../../../../io/storage/CommunicatorStorageHandler.h"
 #include "../../../../logger/Logger.h"
 
 #include <boost/uuid/uuid.hpp>
@@ -23,6 +27,7 @@
 #include <boost/uuid/uuid_io.hpp>
 #include <boost/array.hpp>
 #include <boost/asio.hpp>
+#include <boost/asio/steady_timer.hpp>
 #include <boost/lexical_cast.hpp>
 
 #include "../../../../../libs/json/json.h"
@@ -32,6 +37,10 @@
 #include <sstream>
 #include <chrono>
 #include <map>
+#include <set>
+#include <deque>
+#include <vector>
+#include <functional>
 
 
 namespace uuids = boost::uuids;
@@ -43,15 +52,30 @@ using as::ip::address;
 using json = nlohmann::json;
 
 
+/**
+ * Resolves nodes UUIDs into their network endpoints via the global cache (UUID2Address service).
+ *
+ * Resolved endpoints are cached locally for kEndpointTTL(),
+ * nodes that are unknown to the service - for kNotFoundTTL() (so they are not requested on each sending).
+ * Both kinds of records are stored into the communicator storage (in one transaction per lookup response)
+ * and are loaded back on the next start of the node. Expired endpoints are kept:
+ * they are used, in case if the service would be unreachable.
+ *
+ * Asynchronous lookups are sent via the small pool of persistent connections to the service.
+ * Prefetched nodes are requested by batches, in case if service supports batch lookups.
+ */
 class UUID2Address {
+public:
+    using EndpointHandler = function<void(const boost::system::error_code&, const UDPEndpoint&)>;
+
 public:
     UUID2Address(
         as::io_service &IOService,
+        CommunicatorStorageHandler *communicatorStorageHandler,
+        Logger &logger,
         const string host,
         const uint16_t port = 80);
 
-    ~UUID2Address();
-
     void registerInGlobalCache(
         const NodeUUID &uuid,
         const string &nodeHost,
@@ -60,11 +84,156 @@ public:
     UDPEndpoint& endpoint (
         const NodeUUID &contractorUUUID);
 
+    /**
+     * @returns "true" if endpoint of the node is present in the local cache and is not expired yet
+     * (and would be returned by the "endpoint()").
+     */
+    bool isEndpointCached(
+        const NodeUUID &contractorUUID) const
+        noexcept;
+
+    /**
+     * Fetches endpoint of the node from the global cache, without blocking the IO service.
+     * Handler is always called from the IO service (never from this method itself).
+     *
+     * Only one lookup per node is performed at a time:
+     * in case if lookup of the node is already in progress - handler would be called on its completion.
+     * Lookups of different nodes are pipelined via the persistent connections.
+     *
+     * In case if node was recently reported by the service as unknown -
+     * handler receives "host_not_found" without any network exchange.
+     */
+    void resolveEndpoint(
+        const NodeUUID &contractorUUID,
+        EndpointHandler handler)
+        noexcept;
+
+    /**
+     * Resolves endpoints of all the nodes, that are not present in the local cache yet.
+     * Lookups are performed in the background, not more than kMaxConcurrentPrefetches at a time.
+     * Each lookup contains up to kMaxBatchSize nodes (or one node, if batch lookups are not supported).
+     */
+    void prefetchEndpoints(
+        const vector<NodeUUID> &contractorsUUIDs)
+        noexcept;
+
+    /**
+     * @returns size of the packets, that was confirmed to be delivered to the node.
+     * Only local cache is used: in case if node is unknown - default packet size would be returned.
+     */
+    Packet::Size packetSize(
+        const NodeUUID &contractorUUID) const
+        noexcept;
+
+    void setPacketSize(
+        const NodeUUID &contractorUUID,
+        const Packet::Size packetSize);
+
+    /**
+     * @returns "true" if the node is known to be able to check CRC32C checksums of the messages.
+     */
+    bool isCRC32CSupported(
+        const NodeUUID &contractorUUID) const
+        noexcept;
+
+    void setCRC32CSupported(
+        const NodeUUID &contractorUUID);
+
+    /**
+     * @returns "true" if the node is known to be able to parse amounts of the messages in compact encoding.
+     */
+    bool isCompactAmountsSupported(
+        const NodeUUID &contractorUUID) const
+        noexcept;
+
+    void setCompactAmountsSupported(
+        const NodeUUID &contractorUUID);
+
 private:
-    UDPEndpoint& fetchFromGlobalCache(
-        const NodeUUID &uuid);
+    UUID2AddressConnection& connection()
+        noexcept;
+
+    void beginLookup(
+        const NodeUUID &contractorUUID)
+        noexcept;
+
+    void onLookupResponseReceived(
+        const NodeUUID &contractorUUID,
+        const boost::system::error_code &error,
+        const unsigned int statusCode,
+        const string &responseBody)
+        noexcept;
+
+    void beginBatchLookup(
+        const vector<NodeUUID> &contractorsUUIDs)
+        noexcept;
+
+    void onBatchLookupResponseReceived(
+        const vector<NodeUUID> &contractorsUUIDs,
+        const boost::system::error_code &error,
+        const unsigned int statusCode,
+        const string &responseBody)
+        noexcept;
+
+    void finishLookup(
+        const NodeUUID &contractorUUID,
+        const boost::system::error_code &error)
+        noexcept;
 
-    const pair<unsigned int, string> processResponse();
+    static UDPEndpoint parseEndpoint(
+        const string &responseBody);
+
+    static UDPEndpoint endpointFromJSON(
+        const json &data);
+
+    bool isNodeNotFound(
+        const NodeUUID &contractorUUID) const
+        noexcept;
+
+    void cacheEndpoint(
+        const NodeUUID &contractorUUID,
+        const UDPEndpoint &endpoint)
+        noexcept;
+
+    void cacheNotFoundNode(
+        const NodeUUID &contractorUUID)
+        noexcept;
+
+    void storeRecord(
+        const NodeUUID &contractorUUID,
+        const string &address,
+        const uint16_t port,
+        const TimePoint &expirationTime)
+        noexcept;
+
+    void flushStoredRecords()
+        noexcept;
+
+    void loadStoredRecords()
+        noexcept;
+
+    void beginNextPrefetches()
+        noexcept;
+
+    LoggerStream warning() const
+        noexcept;
+
+    static chrono::seconds kEndpointTTL()
+        noexcept;
+
+    static chrono::seconds kNotFoundTTL()
+        noexcept;
+
+    static chrono::seconds kStaleEndpointTTL()
+        noexcept;
+
+private:
+    static const size_t kMaxConcurrentPrefetches = 16;
+    static const size_t kMaxBatchSize = 64;
+    static const size_t kConnectionsCount = 4;
+
+    const pair<unsigned int, string> processResponse(
+        tcp::socket &socket);
 
     // ToDo: implement me back
 //    void compressLocalCache();
@@ -72,18 +241,37 @@ private:
 private:
     map<NodeUUID, UDPEndpoint> mCache;
     map<NodeUUID, TimePoint> mLastAccessTime; // todo: specify this on boost::chrono types
+    map<NodeUUID, TimePoint> mExpirationTimes;
+
+    // Nodes, that are unknown to the global cache, and expiration times of these records.
+    map<NodeUUID, TimePoint> mNotFoundNodes;
+    map<NodeUUID, Packet::Size> mPacketsSizes;
+    set<NodeUUID> mCRC32CNodes;
+    set<NodeUUID> mCompactAmountsNodes;
+
+    // Handlers of the nodes, which lookups are in progress.
+    map<NodeUUID, vector<EndpointHandler>> mPendingLookups;
+
+    // Records, that are cached, but are not written into the storage yet.
+    vector<UUID2AddressCacheHandler::Record> mUnstoredRecords;
+
+    deque<NodeUUID> mPrefetchQueue;
+    size_t mPrefetchesInProgress;
+
+    // Is set to "false" after the first batch lookup was rejected by the service.
+    bool mIsBatchLookupSupported;
 
     string mServiceIP;
     uint16_t mServicePort;
 
     boost::asio::io_service &mIOService;
+    CommunicatorStorageHandler *mCommunicatorStorageHandler;
+    Logger &mLog;
 
-    tcp::socket mSocket;
     tcp::resolver mResolver;
     tcp::resolver::query mQuery;
     tcp::resolver::iterator mEndpointIterator;
-    boost::asio::streambuf mRequest;
-    std::ostream mRequestStream;
+    vector<UUID2AddressConnection::Unique> mConnections;
 };
 
 #endif //GEO_NETWORK_CLIENT_UUID2IP_H
@@ -0,0 +1,436 @@
+/**
+ * This file is part of GEO Project.
+ * It is subject to the license terms in the LICENSE.md file found in the top-level directory
+ * of this distribution and at https://github.com/GEO-Project/GEO-Project/blob/master/LICENSE.md
+ *
+ * No part of GEO Project, including this file, may be copied, modified, propagated, or distributed
+ * except according to the terms contained in the LICENSE.md file.
+ */
+
+#include "UUID2AddressConnection.h"
+
+#include <boost/algorithm/string.hpp>
+
+#include <sstream>
+
+
+UUID2AddressConnection::UUID2AddressConnection(
+    as::io_service &IOService,
+    const tcp::resolver::iterator &serviceEndpoints,
+    const string &serviceHost) :
+
+    mIOService(IOService),
+    mServiceEndpoints(serviceEndpoints),
+    mServiceHost(serviceHost),
+    mSocket(IOService),
+    mTimeoutTimer(IOService),
+    mConnectionNumber(0),
+    mIsConnected(false),
+    mIsConnecting(false),
+    mIsWriting(false),
+    mIsReading(false)
+{}
+
+UUID2AddressConnection::~UUID2AddressConnection()
+{
+    closeConnection();
+}
+
+void UUID2AddressConnection::sendRequest(
+    const string &method,
+    const string &url,
+    const string &body,
+    ResponseHandler handler)
+    noexcept
+{
+    try {
+        stringstream request;
+        request << method << " " << url << " HTTP/1.1\r\n";
+        request << "Host: " << mServiceHost << "\r\n";
+        request << "Accept: */*\r\n";
+        if (method != "GET") {
+            request << "Content-Type: application/json\r\n";
+            request << "Content-Length: " << body.length() << "\r\n";
+        }
+        request << "Connection: keep-alive\r\n\r\n";
+        request << body;
+
+        mQueuedRequests.push_back({request.str(), handler, 0, method == "GET"});
+
+    } catch (exception &) {
+        mIOService.post([handler] {
+            handler(as::error::no_memory, 0, string());
+        });
+        return;
+    }
+
+    if (mIsConnected) {
+        writeNextRequests();
+
+    } else if (not mIsConnecting) {
+        connect();
+    }
+}
+
+size_t UUID2AddressConnection::pendingRequestsCount() const
+    noexcept
+{
+    return mQueuedRequests.size() + mSentRequests.size();
+}
+
+void UUID2AddressConnection::connect()
+    noexcept
+{
+    mIsConnecting = true;
+    const auto kConnectionNumber = ++mConnectionNumber;
+
+    mTimeoutTimer.expires_from_now(kResponseTimeout());
+    mTimeoutTimer.async_wait([this, kConnectionNumber] (const boost::system::error_code &error) {
+        if (error != as::error::operation_aborted and kConnectionNumber == mConnectionNumber) {
+            onConnectionFailed(as::error::timed_out);
+        }
+    });
+
+    as::async_connect(
+        mSocket,
+        mServiceEndpoints,
+        [this, kConnectionNumber] (const boost::system::error_code &error, tcp::resolver::iterator) {
+            if (kConnectionNumber != mConnectionNumber) {
+                return;
+            }
+
+            if (error) {
+                onConnectionFailed(error);
+                return;
+            }
+
+            mIsConnecting = false;
+            mIsConnected = true;
+            mTimeoutTimer.cancel();
+            writeNextRequests();
+        });
+}
+
+/**
+ * Writes all queued requests at once (but not more, than pipeline allows).
+ * Next requests are written only after the previous write operation is finished,
+ * so the write buffer is never changed while it is used by the socket.
+ */
+void UUID2AddressConnection::writeNextRequests()
+    noexcept
+{
+    if (not mIsConnected or mIsWriting) {
+        return;
+    }
+
+    try {
+        mWriteBuffer.clear();
+        while (not mQueuedRequests.empty() and mSentRequests.size() < kMaxPipelinedRequests) {
+            mWriteBuffer += mQueuedRequests.front().data;
+            mSentRequests.push_back(move(mQueuedRequests.front()));
+            mQueuedRequests.pop_front();
+        }
+
+    } catch (exception &) {
+        onConnectionFailed(as::error::no_memory);
+        return;
+    }
+
+    if (mWriteBuffer.empty()) {
+        return;
+    }
+
+    mIsWriting = true;
+    const auto kConnectionNumber = mConnectionNumber;
+    as::async_write(
+        mSocket,
+        as::buffer(mWriteBuffer),
+        [this, kConnectionNumber] (const boost::system::error_code &error, size_t) {
+            if (kConnectionNumber != mConnectionNumber) {
+                return;
+            }
+
+            mIsWriting = false;
+            if (error) {
+                onConnectionFailed(error);
+                return;
+            }
+
+            writeNextRequests();
+        });
+
+    readNextResponse();
+}
+
+void UUID2AddressConnection::readNextResponse()
+    noexcept
+{
+    if (not mIsConnected or mIsReading or mSentRequests.empty()) {
+        return;
+    }
+
+    mIsReading = true;
+    const auto kConnectionNumber = mConnectionNumber;
+
+    mTimeoutTimer.expires_from_now(kResponseTimeout());
+    mTimeoutTimer.async_wait([this, kConnectionNumber] (const boost::system::error_code &error) {
+        if (error != as::error::operation_aborted and kConnectionNumber == mConnectionNumber) {
+            onConnectionFailed(as::error::timed_out);
+        }
+    });
+
+    as::async_read_until(
+        mSocket,
+        mResponse,
+        "\r\n\r\n",
+        [this, kConnectionNumber] (const boost::system::error_code &error, size_t headersBytesCount) {
+            if (kConnectionNumber != mConnectionNumber) {
+                return;
+            }
+
+            if (error) {
+                onConnectionFailed(error);
+                return;
+            }
+
+            onResponseHeadersRead(headersBytesCount);
+        });
+}
+
+/**
+ * Body of the response is delimited by the "Content-Length" header,
+ * or (in case if it is absent) - by the closing of the connection.
+ * Chunked responses are not supported (the service never sends them for the lookups).
+ */
+void UUID2AddressConnection::onResponseHeadersRead(
+    const size_t headersBytesCount)
+    noexcept
+{
+    unsigned int statusCode = 0;
+    bool isConnectionClosing = false;
+    bool isContentLengthPresent = false;
+    size_t contentLength = 0;
+
+    try {
+        const string kHeaders(
+            as::buffers_begin(mResponse.data()),
+            as::buffers_begin(mResponse.data()) + headersBytesCount);
+        mResponse.consume(headersBytesCount);
+
+        istringstream headersStream(kHeaders);
+        string httpVersion;
+        headersStream >> httpVersion >> statusCode;
+        if (not headersStream or httpVersion.substr(0, 5) != "HTTP/") {
+            onConnectionFailed(as::error::invalid_argument);
+            return;
+        }
+
+        // HTTP/1.0 server closes the connection after the response, unless keep-alive was confirmed explicitly.
+        isConnectionClosing = httpVersion == "HTTP/1.0";
+
+        string header;
+        getline(headersStream, header);
+        while (getline(headersStream, header) and header != "\r") {
+            const auto kSeparatorPosition = header.find(':');
+            if (kSeparatorPosition == string::npos) {
+                continue;
+            }
+
+            const auto kName = boost::algorithm::to_lower_copy(
+                boost::algorithm::trim_copy(header.substr(0, kSeparatorPosition)));
+            const auto kValue = boost::algorithm::to_lower_copy(
+                boost::algorithm::trim_copy(header.substr(kSeparatorPosition + 1)));
+
+            if (kName == "content-length") {
+                contentLength = stoul(kValue);
+                isContentLengthPresent = true;
+
+            } else if (kName == "connection") {
+                if (kValue == "close") {
+                    isConnectionClosing = true;
+                } else if (kValue == "keep-alive") {
+                    isConnectionClosing = false;
+                }
+
+            } else if (kName == "transfer-encoding" and kValue != "identity") {
+                onConnectionFailed(as::error::operation_not_supported);
+                return;
+            }
+        }
+
+    } catch (exception &) {
+        onConnectionFailed(as::error::invalid_argument);
+        return;
+    }
+
+    if (statusCode == 204 or statusCode == 304) {
+        isContentLengthPresent = true;
+        contentLength = 0;
+    }
+
+    const auto kConnectionNumber = mConnectionNumber;
+    if (not isContentLengthPresent) {
+        as::async_read(
+            mSocket,
+            mResponse,
+            as::transfer_all(),
+            [this, kConnectionNumber, statusCode] (const boost::system::error_code &error, size_t) {
+                if (kConnectionNumber != mConnectionNumber) {
+                    return;
+                }
+
+                if (error and error != as::error::eof) {
+                    onConnectionFailed(error);
+                    return;
+                }
+
+                onResponseRead(statusCode, mResponse.size(), true);
+            });
+        return;
+    }
+
+    if (mResponse.size() >= contentLength) {
+        onResponseRead(statusCode, contentLength, isConnectionClosing);
+        return;
+    }
+
+    as::async_read(
+        mSocket,
+        mResponse,
+        as::transfer_exactly(contentLength - mResponse.size()),
+        [this, kConnectionNumber, statusCode, contentLength, isConnectionClosing]
+        (const boost::system::error_code &error, size_t) {
+            if (kConnectionNumber != mConnectionNumber) {
+                return;
+            }
+
+            if (error) {
+                onConnectionFailed(error);
+                return;
+            }
+
+            onResponseRead(statusCode, contentLength, isConnectionClosing);
+        });
+}
+
+void UUID2AddressConnection::onResponseRead(
+    const unsigned int statusCode,
+    const size_t bodyBytesCount,
+    const bool isConnectionClosing)
+    noexcept
+{
+    string body;
+    try {
+        body.assign(
+            as::buffers_begin(mResponse.data()),
+            as::buffers_begin(mResponse.data()) + bodyBytesCount);
+
+    } catch (exception &) {
+        onConnectionFailed(as::error::no_memory);
+        return;
+    }
+
+    mResponse.consume(bodyBytesCount);
+    auto request = move(mSentRequests.front());
+    mSentRequests.pop_front();
+
+    mIsReading = false;
+    mTimeoutTimer.cancel();
+
+    if (isConnectionClosing) {
+        closeConnection();
+
+        // Requests, that was pipelined after the current one, would not be answered by the service
+        // (and so was not processed by it). They are sent once more via the new connection,
+        // regardless of the method (this is not counted as an attempt).
+        while (not mSentRequests.empty()) {
+            mQueuedRequests.push_front(move(mSentRequests.back()));
+            mSentRequests.pop_back();
+        }
+        if (not mQueuedRequests.empty()) {
+            connect();
+        }
+
+    } else {
+        readNextResponse();
+        writeNextRequests();
+    }
+
+    request.handler(boost::system::error_code(), statusCode, body);
+}
+
+/**
+ * Sent GET requests are retried via the new connection (not more than kMaxAttemptsCount times),
+ * because keep-alive connection could be closed by the service at any moment.
+ * Other sent requests are failed: it is unknown whether the service has processed them.
+ * In case if connection can't be established at all - all the requests are failed.
+ */
+void UUID2AddressConnection::onConnectionFailed(
+    const boost::system::error_code &error)
+    noexcept
+{
+    const auto kWasConnected = mIsConnected;
+    closeConnection();
+
+    deque<Request> failedRequests;
+    if (not kWasConnected) {
+        failedRequests.swap(mQueuedRequests);
+    }
+
+    while (not mSentRequests.empty()) {
+        auto request = move(mSentRequests.back());
+        mSentRequests.pop_back();
+
+        request.attemptsCount += 1;
+        if (request.isRetryable and request.attemptsCount < kMaxAttemptsCount) {
+            mQueuedRequests.push_front(move(request));
+        } else {
+            failedRequests.push_front(move(request));
+        }
+    }
+
+    if (not mQueuedRequests.empty()) {
+        connect();
+    }
+
+    failRequests(failedRequests, error);
+}
+
+void UUID2AddressConnection::closeConnection()
+    noexcept
+{
+    // Handlers of all pending operations of the current connection would be ignored.
+    ++mConnectionNumber;
+
+    boost::system::error_code error;
+    mSocket.close(error);
+    mTimeoutTimer.cancel();
+    mResponse.consume(mResponse.size());
+
+    mIsConnected = false;
+    mIsConnecting = false;
+    mIsWriting = false;
+    mIsReading = false;
+}
+
+/**
+ * Requests are moved out of the connection before calling the handlers,
+ * so the handlers are free to send the new requests.
+ */
+void UUID2AddressConnection::failRequests(
+    deque<Request> &requests,
+    const boost::system::error_code &error)
+    noexcept
+{
+    for (const auto &request : requests) {
+        request.handler(error, 0, string());
+    }
+    requests.clear();
+}
+
+chrono::seconds UUID2AddressConnection::kResponseTimeout()
+    noexcept
+{
+    static const chrono::seconds kTimeout(5);
+    return kTimeout;
+}
@@ -0,0 +1,144 @@
+/**
+ * This file is part of GEO Project.
+ * It is subject to the license terms in the LICENSE.md file found in the top-level directory
+ * of this distribution and at https://github.com/GEO-Project/GEO-Project/blob/master/LICENSE.md
+ *
+ * No part of GEO Project, including this file, may be copied, modified, propagated, or distributed
+ * except according to the terms contained in the LICENSE.md file.
+ */
+
+#ifndef GEO_NETWORK_CLIENT_UUID2ADDRESSCONNECTION_H
+#define GEO_NETWORK_CLIENT_UUID2ADDRESSCONNECTION_H
+
+#include <boost/asio.hpp>
+#include <boost/asio/steady_timer.hpp>
+
+#include <string>
+#include <deque>
+#include <chrono>
+#include <memory>
+#include <functional>
+
+
+namespace as = boost::asio;
+
+using namespace std;
+using as::ip::tcp;
+
+
+/**
+ * Persistent (HTTP/1.1 keep-alive) connection to the UUID2Address service.
+ *
+ * Requests are pipelined: up to kMaxPipelinedRequests are written into the connection
+ * without waiting for the responses, responses are matched to the requests in order of sending.
+ * Connection is established on the first request, and is re-established after it was closed by the service.
+ *
+ * GET requests, that was not answered because of the connection failure, are sent once more via the new connection.
+ * Other requests (for example, POSTed batch lookups) are failed in this case:
+ * service may have already processed them, and the caller decides whether to repeat them.
+ */
+class UUID2AddressConnection {
+public:
+    using Unique = unique_ptr<UUID2AddressConnection>;
+    using ResponseHandler = function<void(const boost::system::error_code&, const unsigned int, const string&)>;
+
+public:
+    UUID2AddressConnection(
+        as::io_service &IOService,
+        const tcp::resolver::iterator &serviceEndpoints,
+        const string &serviceHost);
+
+    ~UUID2AddressConnection();
+
+    /**
+     * Handler receives status code and the body of the response.
+     * Handler is always called from the IO service (never from this method itself).
+     */
+    void sendRequest(
+        const string &method,
+        const string &url,
+        const string &body,
+        ResponseHandler handler)
+        noexcept;
+
+    /**
+     * @returns count of requests, that are sent or queued for sending, but are not answered yet.
+     */
+    size_t pendingRequestsCount() const
+        noexcept;
+
+protected:
+    struct Request {
+        string data;
+        ResponseHandler handler;
+        size_t attemptsCount;
+
+        // Only idempotent (GET) requests are sent once more after the connection failure.
+        bool isRetryable;
+    };
+
+protected:
+    void connect()
+        noexcept;
+
+    void writeNextRequests()
+        noexcept;
+
+    void readNextResponse()
+        noexcept;
+
+    void onResponseHeadersRead(
+        const size_t headersBytesCount)
+        noexcept;
+
+    void onResponseRead(
+        const unsigned int statusCode,
+        const size_t bodyBytesCount,
+        const bool isConnectionClosing)
+        noexcept;
+
+    void onConnectionFailed(
+        const boost::system::error_code &error)
+        noexcept;
+
+    void closeConnection()
+        noexcept;
+
+    void failRequests(
+        deque<Request> &requests,
+        const boost::system::error_code &error)
+        noexcept;
+
+    static chrono::seconds kResponseTimeout()
+        noexcept;
+
+protected:
+    static const size_t kMaxPipelinedRequests = 16;
+    static const size_t kMaxAttemptsCount = 2;
+
+protected:
+    as::io_service &mIOService;
+    tcp::resolver::iterator mServiceEndpoints;
+    string mServiceHost;
+
+    tcp::socket mSocket;
+    as::steady_timer mTimeoutTimer;
+    as::streambuf mResponse;
+    string mWriteBuffer;
+
+    // Each (re)connection gets its own number,
+    // so the handlers of the operations of the closed connection are ignored.
+    size_t mConnectionNumber;
+    bool mIsConnected;
+    bool mIsConnecting;
+    bool mIsWriting;
+    bool mIsReading;
+
+    // Requests, that are not written into the connection yet.
+    deque<Request> mQueuedRequests;
+
+    // Requests, that are written into the connection, in order of sending.
+    deque<Request> mSentRequests;
+};
+
+#endif //GEO_NETWORK_CLIENT_UUID2ADDRESSCONNECTION_H
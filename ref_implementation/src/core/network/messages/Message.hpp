@@ -11,6 +11,7 @@
 #define GEO_NETWORK_CLIENT_MESSAGE_H
 
 #include "../../common/memory/MemoryUtils.h"
+#include "../../common/multiprecision/MultiprecisionUtils.h"
 #include "../communicator/internal/common/Packet.hpp"
 
 #include <limits>
@@ -112,17 +113,24 @@ public:
         Debug = 6666,
     };
 
+public:
+    // Message types never reach 2**15, so the highest bit of the serialized type is used as a flag:
+    // it is set in case if the amounts of the message are in compact encoding.
+    // Compact encoding is used only for the nodes, that reported its support,
+    // so other nodes never receive such messages.
+    static const SerializedType kCompactAmountsFlag = 0x8000;
+    static const SerializedType kTypeMask = 0x7FFF;
+
 public:
     virtual ~Message() = default;
 
     /*
-     * Returns max allowed size of the message in bytes.
+     * Returns max size of the message in bytes, that is guaranteed to be transferred to any remote node.
+     * (remote nodes, that support larger packets, may receive larger messages).
      */
     static size_t maxSize()
     {
-        return
-             numeric_limits<PacketHeader::PacketIndex>::max() * Packet::kMaxSize -
-            (numeric_limits<PacketHeader::PacketIndex>::max() * PacketHeader::kSize);
+        return Packet::maxMessageSize(Packet::kDefaultSize);
     }
 
     /*
@@ -153,25 +161,69 @@ public:
     virtual const MessageType typeID() const = 0;
 
     /**
+     * Serializes the message into one memory block of the exact size
+     * (the block is referenced by the outgoing packets as is, without copying).
+     *
      * @throws bad_alloc;
      */
     virtual pair<BytesShared, size_t> serializeToBytes() const
         noexcept(false)
     {
-        // todo: [hsc] use bytes serializer, if possible in all descendant messages.
-        // todo: [hsc] check if bytes serializer is really faster/safer, than raw pointers usage.
+        const auto kBytesCount = serializedBytesCount();
+        auto buffer = tryMalloc(kBytesCount);
+        serializeToBuffer(buffer.get());
 
-        const SerializedType kMessageType = typeID();
-        auto buffer = tryMalloc(sizeof(kMessageType));
+        return make_pair(
+            buffer,
+            kBytesCount);
+    }
 
+    /**
+     * Serializes the message with the amounts in the "encoding", that is supported by the remote node.
+     *
+     * @throws bad_alloc;
+     */
+    pair<BytesShared, size_t> serializeToBytes(
+        const AmountsEncoding encoding) const
+        noexcept(false)
+    {
+        mAmountsEncoding = encoding;
+        return serializeToBytes();
+    }
+
+protected:
+    /**
+     * Returns exact count of bytes, that would be written by serializeToBuffer().
+     *
+     * Derived classes, that add their own content, must override both methods
+     * and append the content to the content of the parent class.
+     * (Messages, that still override serializeToBytes() itself,
+     * must not be used as parents for the messages, that are serialized via this methods.)
+     */
+    virtual size_t serializedBytesCount() const
+        noexcept
+    {
+        return sizeof(SerializedType);
+    }
+
+    /**
+     * Writes the message into the "buffer" (at least serializedBytesCount() bytes long).
+     * Returns pointer to the first byte after the written content.
+     */
+    virtual byte* serializeToBuffer(
+        byte *buffer) const
+        noexcept
+    {
+        SerializedType kMessageType = typeID();
+        if (mAmountsEncoding == CompactAmountsEncoding) {
+            kMessageType |= kCompactAmountsFlag;
+        }
         memcpy(
-            buffer.get(),
+            buffer,
             &kMessageType,
             sizeof(kMessageType));
 
-        return make_pair(
-            buffer,
-            sizeof(kMessageType));
+        return buffer + sizeof(kMessageType);
     }
 
 protected:
@@ -183,6 +235,26 @@ protected:
     {
         return sizeof(SerializedType);
     }
+
+    /**
+     * @returns encoding of the amounts of the serialized message "buffer".
+     */
+    static AmountsEncoding amountsEncoding(
+        BytesShared buffer)
+    {
+        SerializedType messageType;
+        memcpy(
+            &messageType,
+            buffer.get(),
+            sizeof(messageType));
+
+        return (messageType & kCompactAmountsFlag) != 0 ? CompactAmountsEncoding : FixedAmountsEncoding;
+    }
+
+protected:
+    // Messages, that are received from the network, keep the encoding, that was used by the sender.
+    // Outgoing messages are serialized in the encoding, that is supported by the remote node.
+    mutable AmountsEncoding mAmountsEncoding = FixedAmountsEncoding;
 };
 
 #endif //GEO_NETWORK_CLIENT_MESSAGE_H
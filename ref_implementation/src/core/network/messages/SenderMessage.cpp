@@ -27,17 +27,25 @@ SenderMessage::SenderMessage(
         NodeUUID::kBytesSize);
 }
 
-/**
- * @throws bad_alloc;
- */
-pair<BytesShared, size_t> SenderMessage::serializeToBytes() const
-    noexcept(false)
+size_t SenderMessage::serializedBytesCount() const
+    noexcept
+{
+    return
+        Message::serializedBytesCount()
+        + NodeUUID::kBytesSize;
+}
+
+byte* SenderMessage::serializeToBuffer(
+    byte *buffer) const
+    noexcept
 {
-    BytesSerializer serializer;
+    auto bytesBufferOffset = Message::serializeToBuffer(buffer);
+    memcpy(
+        bytesBufferOffset,
+        senderUUID.data,
+        NodeUUID::kBytesSize);
 
-    serializer.enqueue(Message::serializeToBytes());
-    serializer.enqueue(senderUUID);
-    return serializer.collect();
+    return bytesBufferOffset + NodeUUID::kBytesSize;
 }
 
 const size_t SenderMessage::kOffsetToInheritedBytes() const
@@ -36,9 +36,14 @@ public:
         BytesShared buffer)
         noexcept;
 
-    virtual pair<BytesShared, size_t> serializeToBytes() const;
-
 protected:
+    size_t serializedBytesCount() const
+        noexcept;
+
+    byte* serializeToBuffer(
+        byte *buffer) const
+        noexcept;
+
     virtual const size_t kOffsetToInheritedBytes() const
         noexcept;
 };
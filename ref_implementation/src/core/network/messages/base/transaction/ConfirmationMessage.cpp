@@ -42,31 +42,25 @@ const ConfirmationMessage::OperationState ConfirmationMessage::state() const
     return mState;
 }
 
-pair<BytesShared, size_t> ConfirmationMessage::serializeToBytes() const
-    throw (bad_alloc)
+size_t ConfirmationMessage::serializedBytesCount() const
+    noexcept
 {
-    auto parentBytesAndCount = TransactionMessage::serializeToBytes();
-
-    size_t bytesCount =
-        parentBytesAndCount.second
+    return
+        TransactionMessage::serializedBytesCount()
         + sizeof(SerializedOperationState);
+}
 
-    BytesShared dataBytesShared = tryMalloc(bytesCount);
-    size_t dataBytesOffset = 0;
-    //----------------------------------------------------
-    memcpy(
-        dataBytesShared.get(),
-        parentBytesAndCount.first.get(),
-        parentBytesAndCount.second);
-    dataBytesOffset += parentBytesAndCount.second;
+byte* ConfirmationMessage::serializeToBuffer(
+    byte *buffer) const
+    noexcept
+{
+    auto bytesBufferOffset = TransactionMessage::serializeToBuffer(buffer);
     //----------------------------------------------------
-    SerializedOperationState state(mState);
+    const SerializedOperationState kState(mState);
     memcpy(
-        dataBytesShared.get() + dataBytesOffset,
-        &state,
+        bytesBufferOffset,
+        &kState,
         sizeof(SerializedOperationState));
-    //----------------------------------------------------
-    return make_pair(
-        dataBytesShared,
-        bytesCount);
+
+    return bytesBufferOffset + sizeof(SerializedOperationState);
 }
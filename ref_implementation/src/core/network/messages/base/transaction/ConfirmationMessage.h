@@ -43,8 +43,12 @@ public:
 private:
     typedef byte SerializedOperationState;
 
-    pair<BytesShared, size_t> serializeToBytes() const
-    throw (bad_alloc);
+    size_t serializedBytesCount() const
+        noexcept;
+
+    byte* serializeToBuffer(
+        byte *buffer) const
+        noexcept;
 
 private:
     OperationState mState;
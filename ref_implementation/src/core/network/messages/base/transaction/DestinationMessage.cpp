@@ -40,33 +40,25 @@ noexcept
     return mDestinationUUID;
 }
 
-/*
- * ToDo: rewrite me with bytes deserializer
- */
-pair<BytesShared, size_t> DestinationMessage::serializeToBytes() const
+size_t DestinationMessage::serializedBytesCount() const
+    noexcept
 {
-    auto parentBytesAndCount = TransactionMessage::serializeToBytes();
-
-    size_t bytesCount = parentBytesAndCount.second
-                    + NodeUUID::kBytesSize;
+    return
+        TransactionMessage::serializedBytesCount()
+        + NodeUUID::kBytesSize;
+}
 
-    BytesShared dataBytesShared = tryMalloc(bytesCount);
-    size_t dataBytesOffset = 0;
-    //----------------------------------------------------
-    memcpy(
-        dataBytesShared.get(),
-        parentBytesAndCount.first.get(),
-        parentBytesAndCount.second);
-    dataBytesOffset += parentBytesAndCount.second;
-    //----------------------------------------------------
+byte* DestinationMessage::serializeToBuffer(
+    byte *buffer) const
+    noexcept
+{
+    auto bytesBufferOffset = TransactionMessage::serializeToBuffer(buffer);
     memcpy(
-        dataBytesShared.get() + dataBytesOffset,
+        bytesBufferOffset,
         mDestinationUUID.data,
         NodeUUID::kBytesSize);
-    //----------------------------------------------------
-    return make_pair(
-        dataBytesShared,
-        bytesCount);
+
+    return bytesBufferOffset + NodeUUID::kBytesSize;
 }
 
 const size_t DestinationMessage::kOffsetToInheritedBytes() const
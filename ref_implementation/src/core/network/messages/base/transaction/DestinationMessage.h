@@ -29,12 +29,17 @@ public:
         BytesShared buffer)
     noexcept;
 
-    virtual pair<BytesShared, size_t> serializeToBytes() const;
-
     const NodeUUID &destinationUUID() const
     noexcept;
 
 protected:
+    size_t serializedBytesCount() const
+        noexcept;
+
+    byte* serializeToBuffer(
+        byte *buffer) const
+        noexcept;
+
     const size_t kOffsetToInheritedBytes() const
     noexcept;
 
@@ -48,33 +48,25 @@ const TransactionUUID &TransactionMessage::transactionUUID() const
     return mTransactionUUID;
 }
 
-/*
- * ToDo: rewrite me with bytes deserializer
- */
-pair<BytesShared, size_t> TransactionMessage::serializeToBytes() const
+size_t TransactionMessage::serializedBytesCount() const
+    noexcept
 {
-    auto parentBytesAndCount = SenderMessage::serializeToBytes();
-
-    size_t bytesCount = parentBytesAndCount.second
-                        + TransactionUUID::kBytesSize;
+    return
+        SenderMessage::serializedBytesCount()
+        + TransactionUUID::kBytesSize;
+}
 
-    BytesShared dataBytesShared = tryMalloc(bytesCount);
-    size_t dataBytesOffset = 0;
-    //----------------------------------------------------
-    memcpy(
-        dataBytesShared.get(),
-        parentBytesAndCount.first.get(),
-        parentBytesAndCount.second);
-    dataBytesOffset += parentBytesAndCount.second;
-    //----------------------------------------------------
+byte* TransactionMessage::serializeToBuffer(
+    byte *buffer) const
+    noexcept
+{
+    auto bytesBufferOffset = SenderMessage::serializeToBuffer(buffer);
     memcpy(
-        dataBytesShared.get() + dataBytesOffset,
+        bytesBufferOffset,
         mTransactionUUID.data,
         TransactionUUID::kBytesSize);
-    //----------------------------------------------------
-    return make_pair(
-        dataBytesShared,
-        bytesCount);
+
+    return bytesBufferOffset + TransactionUUID::kBytesSize;
 }
 
 const size_t TransactionMessage::kOffsetToInheritedBytes() const
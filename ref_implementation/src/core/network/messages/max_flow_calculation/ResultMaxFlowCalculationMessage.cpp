@@ -11,8 +11,8 @@
 
 ResultMaxFlowCalculationMessage::ResultMaxFlowCalculationMessage(
     const NodeUUID& senderUUID,
-    vector<pair<NodeUUID, ConstSharedTrustLineAmount>> &outgoingFlows,
-    vector<pair<NodeUUID, ConstSharedTrustLineAmount>> &incomingFlows) :
+    const vector<pair<NodeUUID, TrustLineAmount>> &outgoingFlows,
+    const vector<pair<NodeUUID, TrustLineAmount>> &incomingFlows) :
 
     SenderMessage(senderUUID),
     mOutgoingFlows(outgoingFlows),
@@ -24,47 +24,15 @@ ResultMaxFlowCalculationMessage::ResultMaxFlowCalculationMessage(
 
     SenderMessage(buffer)
 {
-    size_t bytesBufferOffset = SenderMessage::kOffsetToInheritedBytes();
-    //----------------------------------------------------
-    SerializedRecordsCount *trustLinesOutCount = new (buffer.get() + bytesBufferOffset) SerializedRecordsCount;
-    bytesBufferOffset += sizeof(SerializedRecordsCount);
-    //-----------------------------------------------------
-    mOutgoingFlows.reserve(*trustLinesOutCount);
-    for (SerializedRecordNumber idx = 0; idx < *trustLinesOutCount; idx++) {
-        NodeUUID nodeUUID(buffer.get() + bytesBufferOffset);
-        bytesBufferOffset += NodeUUID::kBytesSize;
-        //---------------------------------------------------
-        vector<byte> bufferTrustLineAmount(
-            buffer.get() + bytesBufferOffset,
-            buffer.get() + bytesBufferOffset + kTrustLineAmountBytesCount);
-        bytesBufferOffset += kTrustLineAmountBytesCount;
-        //---------------------------------------------------
-        TrustLineAmount trustLineAmount = bytesToTrustLineAmount(bufferTrustLineAmount);
-        mOutgoingFlows.push_back(make_pair(
-            nodeUUID,
-            make_shared<const TrustLineAmount>(
-                trustLineAmount)));
-    }
-    //----------------------------------------------------
-    SerializedRecordsCount *trustLinesInCount = new (buffer.get() + bytesBufferOffset) SerializedRecordsCount;
-    bytesBufferOffset += sizeof(SerializedRecordsCount);
-    //-----------------------------------------------------
-    mIncomingFlows.reserve(*trustLinesInCount);
-    for (SerializedRecordNumber idx = 0; idx < *trustLinesInCount; idx++) {
-        NodeUUID nodeUUID(buffer.get() + bytesBufferOffset);
-        bytesBufferOffset += NodeUUID::kBytesSize;
-        //---------------------------------------------------
-        vector<byte> bufferTrustLineAmount(
-            buffer.get() + bytesBufferOffset,
-            buffer.get() + bytesBufferOffset + kTrustLineAmountBytesCount);
-        bytesBufferOffset += kTrustLineAmountBytesCount;
-        //---------------------------------------------------
-        TrustLineAmount trustLineAmount = bytesToTrustLineAmount(bufferTrustLineAmount);
-        mIncomingFlows.push_back(make_pair(
-            nodeUUID,
-            make_shared<const TrustLineAmount>(
-                trustLineAmount)));
-    }
+    mAmountsEncoding = amountsEncoding(buffer);
+
+    auto bytesBufferOffset = buffer.get() + SenderMessage::kOffsetToInheritedBytes();
+    bytesBufferOffset = deserializeFlows(
+        bytesBufferOffset,
+        mOutgoingFlows);
+    deserializeFlows(
+        bytesBufferOffset,
+        mIncomingFlows);
 }
 
 const Message::MessageType ResultMaxFlowCalculationMessage::typeID() const
@@ -72,79 +40,96 @@ const Message::MessageType ResultMaxFlowCalculationMessage::typeID() const
     return Message::MessageType::MaxFlow_ResultMaxFlowCalculation;
 }
 
-pair<BytesShared, size_t> ResultMaxFlowCalculationMessage::serializeToBytes() const
-    throw(bad_alloc)
+size_t ResultMaxFlowCalculationMessage::serializedBytesCount() const
+    noexcept
 {
-    auto parentBytesAndCount = SenderMessage::serializeToBytes();
-    size_t bytesCount = parentBytesAndCount.second
-                        + sizeof(SerializedRecordsCount) + mOutgoingFlows.size()
-                                                           * (NodeUUID::kBytesSize + kTrustLineAmountBytesCount)
-                        + sizeof(SerializedRecordsCount) + mIncomingFlows.size()
-                                                           * (NodeUUID::kBytesSize + kTrustLineAmountBytesCount);
-    BytesShared dataBytesShared = tryCalloc(bytesCount);
-    size_t dataBytesOffset = 0;
-    //----------------------------------------------------
-    memcpy(
-        dataBytesShared.get(),
-        parentBytesAndCount.first.get(),
-        parentBytesAndCount.second);
-    dataBytesOffset += parentBytesAndCount.second;
-    //----------------------------------------------------
-    SerializedRecordsCount trustLinesOutCount = (SerializedRecordsCount)mOutgoingFlows.size();
-    memcpy(
-        dataBytesShared.get() + dataBytesOffset,
-        &trustLinesOutCount,
-        sizeof(SerializedRecordsCount));
-    dataBytesOffset += sizeof(SerializedRecordsCount);
-    //----------------------------------------------------
-    for (auto const &it : mOutgoingFlows) {
-        memcpy(
-            dataBytesShared.get() + dataBytesOffset,
-            it.first.data,
-            NodeUUID::kBytesSize);
-        dataBytesOffset += NodeUUID::kBytesSize;
-        //------------------------------------------------
-        vector<byte> buffer = trustLineAmountToBytes(*it.second.get());
-        memcpy(
-            dataBytesShared.get() + dataBytesOffset,
-            buffer.data(),
-            buffer.size());
-        dataBytesOffset += kTrustLineAmountBytesCount;
+    return
+        SenderMessage::serializedBytesCount()
+        + flowsBytesCount(mOutgoingFlows)
+        + flowsBytesCount(mIncomingFlows);
+}
+
+byte* ResultMaxFlowCalculationMessage::serializeToBuffer(
+    byte *buffer) const
+    noexcept
+{
+    auto bytesBufferOffset = SenderMessage::serializeToBuffer(buffer);
+    bytesBufferOffset = serializeFlows(
+        mOutgoingFlows,
+        bytesBufferOffset);
+    return serializeFlows(
+        mIncomingFlows,
+        bytesBufferOffset);
+}
+
+size_t ResultMaxFlowCalculationMessage::flowsBytesCount(
+    const vector<pair<NodeUUID, TrustLineAmount>> &flows) const
+    noexcept
+{
+    size_t bytesCount = sizeof(SerializedRecordsCount);
+    for (auto const &it : flows) {
+        bytesCount +=
+            NodeUUID::kBytesSize
+            + trustLineAmountBytesCount(it.second, mAmountsEncoding);
     }
-    //----------------------------------------------------
-    SerializedRecordsCount trustLinesInCount = (SerializedRecordsCount)mIncomingFlows.size();
+    return bytesCount;
+}
+
+byte* ResultMaxFlowCalculationMessage::serializeFlows(
+    const vector<pair<NodeUUID, TrustLineAmount>> &flows,
+    byte *buffer) const
+    noexcept
+{
+    const auto kFlowsCount = (SerializedRecordsCount)flows.size();
     memcpy(
-        dataBytesShared.get() + dataBytesOffset,
-        &trustLinesInCount,
+        buffer,
+        &kFlowsCount,
         sizeof(SerializedRecordsCount));
-    dataBytesOffset += sizeof(SerializedRecordsCount);
+    buffer += sizeof(SerializedRecordsCount);
     //----------------------------------------------------
-    for (auto const &it : mIncomingFlows) {
+    for (auto const &it : flows) {
         memcpy(
-            dataBytesShared.get() + dataBytesOffset,
+            buffer,
             it.first.data,
             NodeUUID::kBytesSize);
-        dataBytesOffset += NodeUUID::kBytesSize;
+        buffer += NodeUUID::kBytesSize;
         //------------------------------------------------
-        vector<byte> buffer = trustLineAmountToBytes(*it.second.get());
-        memcpy(
-            dataBytesShared.get() + dataBytesOffset,
-            buffer.data(),
-            buffer.size());
-        dataBytesOffset += kTrustLineAmountBytesCount;
+        buffer = trustLineAmountToBytes(
+            it.second,
+            buffer,
+            mAmountsEncoding);
     }
-    //----------------------------------------------------
-    return make_pair(
-        dataBytesShared,
-        bytesCount);
+
+    return buffer;
+}
+
+byte* ResultMaxFlowCalculationMessage::deserializeFlows(
+    byte *buffer,
+    vector<pair<NodeUUID, TrustLineAmount>> &flows)
+{
+    SerializedRecordsCount *flowsCount = new (buffer) SerializedRecordsCount;
+    buffer += sizeof(SerializedRecordsCount);
+    //-----------------------------------------------------
+    flows.reserve(*flowsCount);
+    for (SerializedRecordNumber idx = 0; idx < *flowsCount; idx++) {
+        NodeUUID nodeUUID(buffer);
+        buffer += NodeUUID::kBytesSize;
+        //---------------------------------------------------
+        flows.push_back(make_pair(
+            nodeUUID,
+            bytesToTrustLineAmount(buffer, mAmountsEncoding)));
+        buffer += encodedTrustLineAmountBytesCount(buffer, mAmountsEncoding);
+    }
+
+    return buffer;
 }
 
-const vector<pair<NodeUUID, ConstSharedTrustLineAmount>> ResultMaxFlowCalculationMessage::outgoingFlows() const
+const vector<pair<NodeUUID, TrustLineAmount>>& ResultMaxFlowCalculationMessage::outgoingFlows() const
 {
     return mOutgoingFlows;
 }
 
-const vector<pair<NodeUUID, ConstSharedTrustLineAmount>> ResultMaxFlowCalculationMessage::incomingFlows() const
+const vector<pair<NodeUUID, TrustLineAmount>>& ResultMaxFlowCalculationMessage::incomingFlows() const
 {
     return mIncomingFlows;
 }
@@ -24,24 +24,42 @@ public:
 public:
     ResultMaxFlowCalculationMessage(
         const NodeUUID& senderUUID,
-        vector<pair<NodeUUID, ConstSharedTrustLineAmount>> &outgoingFlows,
-        vector<pair<NodeUUID, ConstSharedTrustLineAmount>> &incomingFlows);
+        const vector<pair<NodeUUID, TrustLineAmount>> &outgoingFlows,
+        const vector<pair<NodeUUID, TrustLineAmount>> &incomingFlows);
 
     ResultMaxFlowCalculationMessage(
         BytesShared buffer);
 
     const MessageType typeID() const;
 
-    virtual pair<BytesShared, size_t> serializeToBytes() const
-        throw(bad_alloc);
+    const vector<pair<NodeUUID, TrustLineAmount>>& outgoingFlows() const;
 
-    const vector<pair<NodeUUID, ConstSharedTrustLineAmount>> outgoingFlows() const;
+    const vector<pair<NodeUUID, TrustLineAmount>>& incomingFlows() const;
 
-    const vector<pair<NodeUUID, ConstSharedTrustLineAmount>> incomingFlows() const;
+protected:
+    size_t serializedBytesCount() const
+        noexcept;
+
+    byte* serializeToBuffer(
+        byte *buffer) const
+        noexcept;
+
+    size_t flowsBytesCount(
+        const vector<pair<NodeUUID, TrustLineAmount>> &flows) const
+        noexcept;
+
+    byte* serializeFlows(
+        const vector<pair<NodeUUID, TrustLineAmount>> &flows,
+        byte *buffer) const
+        noexcept;
+
+    byte* deserializeFlows(
+        byte *buffer,
+        vector<pair<NodeUUID, TrustLineAmount>> &flows);
 
 private:
-    vector<pair<NodeUUID, ConstSharedTrustLineAmount>> mOutgoingFlows;
-    vector<pair<NodeUUID, ConstSharedTrustLineAmount>> mIncomingFlows;
+    vector<pair<NodeUUID, TrustLineAmount>> mOutgoingFlows;
+    vector<pair<NodeUUID, TrustLineAmount>> mIncomingFlows;
 };
 
 
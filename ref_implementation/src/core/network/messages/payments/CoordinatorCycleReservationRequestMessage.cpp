@@ -46,33 +46,23 @@ const Message::MessageType CoordinatorCycleReservationRequestMessage::typeID() c
     return Message::Payments_CoordinatorCycleReservationRequest;
 }
 
-/**
- * @throws bad_alloc;
- */
-pair<BytesShared, size_t> CoordinatorCycleReservationRequestMessage::serializeToBytes() const
-    throw(bad_alloc)
+size_t CoordinatorCycleReservationRequestMessage::serializedBytesCount() const
+    noexcept
 {
-    auto parentBytesAndCount = RequestCycleMessage::serializeToBytes();
-    size_t totalBytesCount =
-        + parentBytesAndCount.second
-        + mNextPathNode.kBytesSize;
-
-    BytesShared buffer = tryMalloc(totalBytesCount);
-    auto initialOffset = buffer.get();
-    memcpy(
-        initialOffset,
-        parentBytesAndCount.first.get(),
-        parentBytesAndCount.second);
-
-    auto nextPathNodeOffset =
-        initialOffset + parentBytesAndCount.second;
+    return
+        RequestCycleMessage::serializedBytesCount()
+        + NodeUUID::kBytesSize;
+}
 
+byte* CoordinatorCycleReservationRequestMessage::serializeToBuffer(
+    byte *buffer) const
+    noexcept
+{
+    auto bytesBufferOffset = RequestCycleMessage::serializeToBuffer(buffer);
     memcpy(
-        nextPathNodeOffset,
+        bytesBufferOffset,
         mNextPathNode.data,
-        mNextPathNode.kBytesSize);
+        NodeUUID::kBytesSize);
 
-    return make_pair(
-        buffer,
-        totalBytesCount);
+    return bytesBufferOffset + NodeUUID::kBytesSize;
 }
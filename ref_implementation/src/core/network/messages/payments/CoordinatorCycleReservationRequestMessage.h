@@ -33,10 +33,14 @@ public:
 
     const Message::MessageType typeID() const;
 
-    virtual pair<BytesShared, size_t> serializeToBytes() const
-    throw(bad_alloc);
-
 protected:
+    size_t serializedBytesCount() const
+        noexcept;
+
+    byte* serializeToBuffer(
+        byte *buffer) const
+        noexcept;
+
     NodeUUID mNextPathNode;
 };
 
@@ -29,13 +29,10 @@ CoordinatorCycleReservationResponseMessage::CoordinatorCycleReservationResponseM
         buffer)
 {
     auto parentMessageOffset = ResponseCycleMessage::kOffsetToInheritedBytes();
-    auto amountOffset = buffer.get() + parentMessageOffset;
-    auto amountEndOffset = amountOffset + kTrustLineAmountBytesCount; // TODO: deserialize only non-zero
-    vector<byte> amountBytes(
-        amountOffset,
-        amountEndOffset);
-
-    mAmountReserved = bytesToTrustLineAmount(amountBytes);
+    mAmountsEncoding = amountsEncoding(buffer);
+    mAmountReserved = bytesToTrustLineAmount(
+        buffer.get() + parentMessageOffset,
+        mAmountsEncoding);
 }
 
 const TrustLineAmount& CoordinatorCycleReservationResponseMessage::amountReserved() const
@@ -43,33 +40,23 @@ const TrustLineAmount& CoordinatorCycleReservationResponseMessage::amountReserve
     return mAmountReserved;
 }
 
-pair<BytesShared, size_t> CoordinatorCycleReservationResponseMessage::serializeToBytes() const
-    throw(bad_alloc)
+size_t CoordinatorCycleReservationResponseMessage::serializedBytesCount() const
+    noexcept
 {
-    auto parentBytesAndCount = ResponseCycleMessage::serializeToBytes();
-    auto serializedAmount = trustLineAmountToBytes(mAmountReserved);
-
-    size_t bytesCount =
-        parentBytesAndCount.second
-        + serializedAmount.size();
+    return
+        ResponseCycleMessage::serializedBytesCount()
+        + trustLineAmountBytesCount(mAmountReserved, mAmountsEncoding);
+}
 
-    BytesShared dataBytesShared = tryMalloc(bytesCount);
-    size_t dataBytesOffset = 0;
-    //----------------------------------------------------
-    memcpy(
-        dataBytesShared.get(),
-        parentBytesAndCount.first.get(),
-        parentBytesAndCount.second);
-    dataBytesOffset += parentBytesAndCount.second;
-    //----------------------------------------------------
-    memcpy(
-        dataBytesShared.get() + dataBytesOffset,
-        serializedAmount.data(),
-        serializedAmount.size());
-    //----------------------------------------------------
-    return make_pair(
-        dataBytesShared,
-        bytesCount);
+byte* CoordinatorCycleReservationResponseMessage::serializeToBuffer(
+    byte *buffer) const
+    noexcept
+{
+    auto bytesBufferOffset = ResponseCycleMessage::serializeToBuffer(buffer);
+    return trustLineAmountToBytes(
+        mAmountReserved,
+        bytesBufferOffset,
+        mAmountsEncoding);
 }
 
 const Message::MessageType CoordinatorCycleReservationResponseMessage::typeID() const
@@ -47,29 +47,23 @@ const Message::MessageType CoordinatorReservationRequestMessage::typeID() const
     return Message::Payments_CoordinatorReservationRequest;
 }
 
-/**
- * @throws bad_alloc;
- */
-pair<BytesShared, size_t> CoordinatorReservationRequestMessage::serializeToBytes() const
-    throw(bad_alloc)
-{    
-    auto parentBytesAndCount = RequestMessageWithReservations::serializeToBytes();
-    size_t totalBytesCount =
-        + parentBytesAndCount.second
+size_t CoordinatorReservationRequestMessage::serializedBytesCount() const
+    noexcept
+{
+    return
+        RequestMessageWithReservations::serializedBytesCount()
         + NodeUUID::kBytesSize;
+}
 
-    BytesShared buffer = tryMalloc(totalBytesCount);
-    memcpy(
-        buffer.get(),
-        parentBytesAndCount.first.get(),
-        parentBytesAndCount.second);
-
+byte* CoordinatorReservationRequestMessage::serializeToBuffer(
+    byte *buffer) const
+    noexcept
+{
+    auto bytesBufferOffset = RequestMessageWithReservations::serializeToBuffer(buffer);
     memcpy(
-        buffer.get() + parentBytesAndCount.second,
+        bytesBufferOffset,
         mNextPathNode.data,
         NodeUUID::kBytesSize);
 
-    return make_pair(
-        buffer,
-        totalBytesCount);
+    return bytesBufferOffset + NodeUUID::kBytesSize;
 }
@@ -32,13 +32,10 @@ CoordinatorReservationResponseMessage::CoordinatorReservationResponseMessage(
         buffer)
 {
     auto parentMessageOffset = ResponseMessage::kOffsetToInheritedBytes();
-    auto amountOffset = buffer.get() + parentMessageOffset;
-    auto amountEndOffset = amountOffset + kTrustLineAmountBytesCount; // TODO: deserialize only non-zero
-    vector<byte> amountBytes(
-        amountOffset,
-        amountEndOffset);
-
-    mAmountReserved = bytesToTrustLineAmount(amountBytes);
+    mAmountsEncoding = amountsEncoding(buffer);
+    mAmountReserved = bytesToTrustLineAmount(
+        buffer.get() + parentMessageOffset,
+        mAmountsEncoding);
 }
 
 const TrustLineAmount&CoordinatorReservationResponseMessage::amountReserved() const
@@ -46,33 +43,23 @@ const TrustLineAmount&CoordinatorReservationResponseMessage::amountReserved() co
     return mAmountReserved;
 }
 
-pair<BytesShared, size_t> CoordinatorReservationResponseMessage::serializeToBytes() const
-    throw(bad_alloc)
+size_t CoordinatorReservationResponseMessage::serializedBytesCount() const
+    noexcept
 {
-    auto parentBytesAndCount = ResponseMessage::serializeToBytes();
-    auto serializedAmount = trustLineAmountToBytes(mAmountReserved);
-
-    size_t bytesCount =
-        parentBytesAndCount.second
-        + serializedAmount.size();
+    return
+        ResponseMessage::serializedBytesCount()
+        + trustLineAmountBytesCount(mAmountReserved, mAmountsEncoding);
+}
 
-    BytesShared dataBytesShared = tryMalloc(bytesCount);
-    size_t dataBytesOffset = 0;
-    //----------------------------------------------------
-    memcpy(
-        dataBytesShared.get(),
-        parentBytesAndCount.first.get(),
-        parentBytesAndCount.second);
-    dataBytesOffset += parentBytesAndCount.second;
-    //----------------------------------------------------
-    memcpy(
-        dataBytesShared.get() + dataBytesOffset,
-        serializedAmount.data(),
-        serializedAmount.size());
-    //----------------------------------------------------
-    return make_pair(
-        dataBytesShared,
-        bytesCount);
+byte* CoordinatorReservationResponseMessage::serializeToBuffer(
+    byte *buffer) const
+    noexcept
+{
+    auto bytesBufferOffset = ResponseMessage::serializeToBuffer(buffer);
+    return trustLineAmountToBytes(
+        mAmountReserved,
+        bytesBufferOffset,
+        mAmountsEncoding);
 }
 
 const Message::MessageType CoordinatorReservationResponseMessage::typeID() const
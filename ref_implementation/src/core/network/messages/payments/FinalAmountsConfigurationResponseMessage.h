@@ -39,8 +39,12 @@ public:
 protected:
     typedef byte SerializedOperationState;
 
-    pair<BytesShared, size_t> serializeToBytes() const
-    throw (bad_alloc);
+    size_t serializedBytesCount() const
+        noexcept;
+
+    byte* serializeToBuffer(
+        byte *buffer) const
+        noexcept;
 
 private:
     OperationState mState;
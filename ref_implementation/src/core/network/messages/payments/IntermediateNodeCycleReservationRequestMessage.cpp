@@ -55,38 +55,30 @@ const NodeUUID& IntermediateNodeCycleReservationRequestMessage::coordinatorUUID(
     return mCoordinatorUUID;
 }
 
-/**
- * @throws bad_alloc;
- */
-pair<BytesShared, size_t> IntermediateNodeCycleReservationRequestMessage::serializeToBytes() const
-    throw(bad_alloc)
+size_t IntermediateNodeCycleReservationRequestMessage::serializedBytesCount() const
+    noexcept
 {
-    auto parentBytesAndCount = RequestCycleMessage::serializeToBytes();
-    size_t totalBytesCount =
-        + parentBytesAndCount.second
+    return
+        RequestCycleMessage::serializedBytesCount()
         + NodeUUID::kBytesSize
         + sizeof(SerializedPathLengthSize);
+}
 
-    BytesShared buffer = tryMalloc(totalBytesCount);
-    auto initialOffset = buffer.get();
-    memcpy(
-        initialOffset,
-        parentBytesAndCount.first.get(),
-        parentBytesAndCount.second);
-
-    auto coordinatorUUIDOffset = initialOffset + parentBytesAndCount.second;
+byte* IntermediateNodeCycleReservationRequestMessage::serializeToBuffer(
+    byte *buffer) const
+    noexcept
+{
+    auto bytesBufferOffset = RequestCycleMessage::serializeToBuffer(buffer);
     memcpy(
-        coordinatorUUIDOffset,
+        bytesBufferOffset,
         mCoordinatorUUID.data,
         NodeUUID::kBytesSize);
+    bytesBufferOffset += NodeUUID::kBytesSize;
 
-    auto cycleLengthOffset = coordinatorUUIDOffset + NodeUUID::kBytesSize;
     memcpy(
-        cycleLengthOffset,
+        bytesBufferOffset,
         &mCycleLength,
         sizeof(SerializedPathLengthSize));
 
-    return make_pair(
-        buffer,
-        totalBytesCount);
+    return bytesBufferOffset + sizeof(SerializedPathLengthSize);
 }
\ No newline at end of file
@@ -37,8 +37,12 @@ public:
 protected:
     const MessageType typeID() const;
 
-    virtual pair<BytesShared, size_t> serializeToBytes() const
-    throw(bad_alloc);
+    size_t serializedBytesCount() const
+        noexcept;
+
+    byte* serializeToBuffer(
+        byte *buffer) const
+        noexcept;
 
 protected:
     SerializedPathLengthSize mCycleLength;
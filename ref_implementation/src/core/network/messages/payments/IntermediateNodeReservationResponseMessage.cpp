@@ -31,13 +31,10 @@ IntermediateNodeReservationResponseMessage::IntermediateNodeReservationResponseM
         buffer)
 {
     auto parentMessageOffset = ResponseMessage::kOffsetToInheritedBytes();
-    auto amountOffset = buffer.get() + parentMessageOffset;
-    auto amountEndOffset = amountOffset + kTrustLineAmountBytesCount; // TODO: deserialize only non-zero
-    vector<byte> amountBytes(
-        amountOffset,
-        amountEndOffset);
-
-    mAmountReserved = bytesToTrustLineAmount(amountBytes);
+    mAmountsEncoding = amountsEncoding(buffer);
+    mAmountReserved = bytesToTrustLineAmount(
+        buffer.get() + parentMessageOffset,
+        mAmountsEncoding);
 }
 
 const TrustLineAmount& IntermediateNodeReservationResponseMessage::amountReserved() const
@@ -45,33 +42,23 @@ const TrustLineAmount& IntermediateNodeReservationResponseMessage::amountReserve
     return mAmountReserved;
 }
 
-pair<BytesShared, size_t> IntermediateNodeReservationResponseMessage::serializeToBytes() const
-throw(bad_alloc)
+size_t IntermediateNodeReservationResponseMessage::serializedBytesCount() const
+    noexcept
 {
-    auto parentBytesAndCount = ResponseMessage::serializeToBytes();
-    auto serializedAmount = trustLineAmountToBytes(mAmountReserved);
-
-    size_t bytesCount =
-        parentBytesAndCount.second
-        + serializedAmount.size();
+    return
+        ResponseMessage::serializedBytesCount()
+        + trustLineAmountBytesCount(mAmountReserved, mAmountsEncoding);
+}
 
-    BytesShared dataBytesShared = tryMalloc(bytesCount);
-    size_t dataBytesOffset = 0;
-    //----------------------------------------------------
-    memcpy(
-        dataBytesShared.get(),
-        parentBytesAndCount.first.get(),
-        parentBytesAndCount.second);
-    dataBytesOffset += parentBytesAndCount.second;
-    //----------------------------------------------------
-    memcpy(
-        dataBytesShared.get() + dataBytesOffset,
-        serializedAmount.data(),
-        serializedAmount.size());
-    //----------------------------------------------------
-    return make_pair(
-        dataBytesShared,
-        bytesCount);
+byte* IntermediateNodeReservationResponseMessage::serializeToBuffer(
+    byte *buffer) const
+    noexcept
+{
+    auto bytesBufferOffset = ResponseMessage::serializeToBuffer(buffer);
+    return trustLineAmountToBytes(
+        mAmountReserved,
+        bytesBufferOffset,
+        mAmountsEncoding);
 }
 
 const Message::MessageType IntermediateNodeReservationResponseMessage::typeID() const
@@ -37,10 +37,14 @@ public:
 
     const TrustLineAmount& amountReserved() const;
 
-    virtual pair<BytesShared, size_t> serializeToBytes() const
-    throw(bad_alloc);
-
 protected:
+    size_t serializedBytesCount() const
+        noexcept;
+
+    byte* serializeToBuffer(
+        byte *buffer) const
+        noexcept;
+
     const MessageType typeID() const;
 
 protected:
@@ -142,8 +142,18 @@ const Message::MessageType ParticipantsVotesMessage::typeID() const
     return Message::Payments_ParticipantsVotes;
 }
 
+size_t ParticipantsVotesMessage::serializedBytesCount() const
+    noexcept
+{
+    return
+        TransactionMessage::serializedBytesCount()
+        + NodeUUID::kBytesSize
+        + sizeof(SerializedRecordsCount)
+        + mVotes.size() * (NodeUUID::kBytesSize + sizeof(SerializedVote));
+}
+
 /**
- * Serializes the message into shared bytes sequence.
+ * Serializes the message into the "buffer".
  *
  * Message format:
  *  16B - Transaction UUID,
@@ -161,72 +171,45 @@ const Message::MessageType ParticipantsVotesMessage::typeID() const
  *      16B - Participant N UUID
  *      1B  - Participant N vote (true/false)
  *  }
- *
- *
- *  @throws bad_alloc in case of insufficient memory.
  */
-pair<BytesShared, size_t> ParticipantsVotesMessage::serializeToBytes() const
-    throw(bad_alloc)
+byte* ParticipantsVotesMessage::serializeToBuffer(
+    byte *buffer) const
+    noexcept
 {
-    const auto parentBytesAndCount = TransactionMessage::serializeToBytes();
-
-    const auto kTotalParticipantsCount = mVotes.size();
-    const auto kCoordinatorUUIDSize = NodeUUID::kBytesSize;
-    const auto kParticipantRecordSize =
-        NodeUUID::kBytesSize
-        + sizeof(SerializedVote);
-
-    const auto kBufferSize =
-        parentBytesAndCount.second
-        + NodeUUID::kBytesSize
-        + sizeof(SerializedRecordsCount)
-        + kTotalParticipantsCount * kParticipantRecordSize;
-
-    BytesShared buffer = tryMalloc(kBufferSize);
-
-    size_t dataBytesOffset = 0;
-    // Parent message content
-    memcpy(
-        buffer.get(),
-        parentBytesAndCount.first.get(),
-        parentBytesAndCount.second);
-    dataBytesOffset += parentBytesAndCount.second;
+    auto bytesBufferOffset = TransactionMessage::serializeToBuffer(buffer);
 
     // Coordinator UUID
     memcpy(
-        buffer.get() + dataBytesOffset,
+        bytesBufferOffset,
         mCoordinatorUUID.data,
-        kCoordinatorUUIDSize);
-    dataBytesOffset += NodeUUID::kBytesSize;
+        NodeUUID::kBytesSize);
+    bytesBufferOffset += NodeUUID::kBytesSize;
 
     // Records count
+    const auto kTotalParticipantsCount = (SerializedRecordsCount)mVotes.size();
     memcpy(
-        buffer.get() + dataBytesOffset,
+        bytesBufferOffset,
         &kTotalParticipantsCount,
         sizeof(SerializedRecordsCount));
-    dataBytesOffset += sizeof(SerializedRecordsCount);
+    bytesBufferOffset += sizeof(SerializedRecordsCount);
 
     // Nodes UUIDs and votes
     for (const auto &NodeUUIDAndVote : mVotes) {
-
-        const auto kParticipantUUID = NodeUUIDAndVote.first;
         memcpy(
-            buffer.get() + dataBytesOffset,
-            kParticipantUUID.data,
+            bytesBufferOffset,
+            NodeUUIDAndVote.first.data,
             NodeUUID::kBytesSize);
-        dataBytesOffset += NodeUUID::kBytesSize;
+        bytesBufferOffset += NodeUUID::kBytesSize;
 
         const SerializedVote kVoteSerialized = NodeUUIDAndVote.second;
         memcpy(
-            buffer.get() + dataBytesOffset,
+            bytesBufferOffset,
             &kVoteSerialized,
             sizeof(kVoteSerialized));
-        dataBytesOffset += sizeof(kVoteSerialized);
+        bytesBufferOffset += sizeof(kVoteSerialized);
     }
 
-    return make_pair(
-        buffer,
-        kBufferSize);
+    return bytesBufferOffset;
 }
 
 /**
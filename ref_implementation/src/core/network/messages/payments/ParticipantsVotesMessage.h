@@ -77,9 +77,6 @@ public:
 
     const MessageType typeID() const;
 
-    virtual pair<BytesShared, size_t> serializeToBytes() const
-        throw(bad_alloc);
-
     const boost::container::flat_map<NodeUUID, ParticipantsVotesMessage::Vote>& votes() const;
 
     bool containsParticipant(
@@ -88,6 +85,13 @@ public:
 protected:
     typedef byte SerializedVote;
 
+    size_t serializedBytesCount() const
+        noexcept;
+
+    byte* serializeToBuffer(
+        byte *buffer) const
+        noexcept;
+
 protected:
     /* It is necessary to use flat map here:
      * this container predicts order in which
@@ -25,6 +25,7 @@ ReservationsInRelationToNodeMessage::ReservationsInRelationToNodeMessage(
     BytesShared buffer):
     TransactionMessage(buffer)
 {
+    mAmountsEncoding = amountsEncoding(buffer);
     auto parentMessageOffset = TransactionMessage::kOffsetToInheritedBytes();
     auto bytesBufferOffset = buffer.get() + parentMessageOffset;
     //----------------------------------------------------
@@ -39,11 +40,8 @@ ReservationsInRelationToNodeMessage::ReservationsInRelationToNodeMessage(
         bytesBufferOffset += sizeof(PathID);
 
         // Amount
-        vector<byte> bufferTrustLineAmount(
-            bytesBufferOffset,
-            bytesBufferOffset + kTrustLineAmountBytesCount);
-        bytesBufferOffset += kTrustLineAmountBytesCount;
-        TrustLineAmount reservationAmount = bytesToTrustLineAmount(bufferTrustLineAmount);
+        TrustLineAmount reservationAmount = bytesToTrustLineAmount(bytesBufferOffset, mAmountsEncoding);
+        bytesBufferOffset += encodedTrustLineAmountBytesCount(bytesBufferOffset, mAmountsEncoding);
 
         // Direction
         AmountReservation::SerializedReservationDirectionSize *direction =
@@ -67,29 +65,32 @@ const vector<pair<PathID, AmountReservation::ConstShared>>& ReservationsInRelati
     return mReservations;
 }
 
-pair<BytesShared, size_t> ReservationsInRelationToNodeMessage::serializeToBytes() const
-    throw (bad_alloc)
+size_t ReservationsInRelationToNodeMessage::serializedBytesCount() const
+    noexcept
 {
-    auto parentBytesAndCount = TransactionMessage::serializeToBytes();
     size_t bytesCount =
-        + parentBytesAndCount.second
-        + sizeof(SerializedRecordsCount)
-        + mReservations.size() *
-          (sizeof(PathID) + kTrustLineAmountBytesCount + sizeof(AmountReservation::SerializedReservationDirectionSize));
+        TransactionMessage::serializedBytesCount()
+        + sizeof(SerializedRecordsCount);
 
-    BytesShared buffer = tryMalloc(bytesCount);
+    for (auto const &it : mReservations) {
+        bytesCount +=
+            sizeof(PathID)
+            + trustLineAmountBytesCount(it.second->amount(), mAmountsEncoding)
+            + sizeof(AmountReservation::SerializedReservationDirectionSize);
+    }
+    return bytesCount;
+}
 
-    auto initialOffset = buffer.get();
-    memcpy(
-        initialOffset,
-        parentBytesAndCount.first.get(),
-        parentBytesAndCount.second);
-    auto bytesBufferOffset = initialOffset + parentBytesAndCount.second;
+byte* ReservationsInRelationToNodeMessage::serializeToBuffer(
+    byte *buffer) const
+    noexcept
+{
+    auto bytesBufferOffset = TransactionMessage::serializeToBuffer(buffer);
     //----------------------------------------------------
-    SerializedRecordsCount reservationsCount = (SerializedRecordsCount)mReservations.size();
+    const auto kReservationsCount = (SerializedRecordsCount)mReservations.size();
     memcpy(
         bytesBufferOffset,
-        &reservationsCount,
+        &kReservationsCount,
         sizeof(SerializedRecordsCount));
     bytesBufferOffset += sizeof(SerializedRecordsCount);
     //----------------------------------------------------
@@ -100,12 +101,10 @@ pair<BytesShared, size_t> ReservationsInRelationToNodeMessage::serializeToBytes(
             sizeof(PathID));
         bytesBufferOffset += sizeof(PathID);
 
-        vector<byte> serializedAmount = trustLineAmountToBytes(it.second->amount());
-        memcpy(
+        bytesBufferOffset = trustLineAmountToBytes(
+            it.second->amount(),
             bytesBufferOffset,
-            serializedAmount.data(),
-            kTrustLineAmountBytesCount);
-        bytesBufferOffset += kTrustLineAmountBytesCount;
+            mAmountsEncoding);
 
         const auto kDirection = it.second->direction();
         memcpy(
@@ -114,10 +113,8 @@ pair<BytesShared, size_t> ReservationsInRelationToNodeMessage::serializeToBytes(
             sizeof(AmountReservation::SerializedReservationDirectionSize));
         bytesBufferOffset += sizeof(AmountReservation::SerializedReservationDirectionSize);
     }
-    //----------------------------------------------------
-    return make_pair(
-        buffer,
-        bytesCount);
+
+    return bytesBufferOffset;
 }
 
 const Message::MessageType ReservationsInRelationToNodeMessage::typeID() const
@@ -34,8 +34,12 @@ public:
 protected:
     const MessageType typeID() const;
 
-    pair<BytesShared, size_t> serializeToBytes() const
-    throw (bad_alloc);
+    size_t serializedBytesCount() const
+        noexcept;
+
+    byte* serializeToBuffer(
+        byte *buffer) const
+        noexcept;
 
 private:
     vector<pair<PathID, AmountReservation::ConstShared>> mReservations;
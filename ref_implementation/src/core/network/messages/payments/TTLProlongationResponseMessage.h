@@ -40,8 +40,12 @@ public:
 protected:
     typedef byte SerializedOperationState;
 
-    virtual pair<BytesShared, size_t> serializeToBytes() const
-    throw(bad_alloc);
+    size_t serializedBytesCount() const
+        noexcept;
+
+    byte* serializeToBuffer(
+        byte *buffer) const
+        noexcept;
 
 protected:
     OperationState mState;
@@ -27,12 +27,8 @@ RequestCycleMessage::RequestCycleMessage(
 {
     auto parentMessageOffset = TransactionMessage::kOffsetToInheritedBytes();
     auto bytesBufferOffset = buffer.get() + parentMessageOffset;
-    auto amountEndOffset = bytesBufferOffset + kTrustLineBalanceBytesCount; // TODO: deserialize only non-zero
-    vector<byte> amountBytes(
-        bytesBufferOffset,
-        amountEndOffset);
-
-    mAmount = bytesToTrustLineAmount(amountBytes);
+    mAmountsEncoding = amountsEncoding(buffer);
+    mAmount = bytesToTrustLineAmount(bytesBufferOffset, mAmountsEncoding);
 }
 
 const TrustLineAmount &RequestCycleMessage::amount() const
@@ -40,44 +36,30 @@ const TrustLineAmount &RequestCycleMessage::amount() const
     return mAmount;
 }
 
-/*!
- *
- * Throws bad_alloc;
- */
-pair<BytesShared, size_t> RequestCycleMessage::serializeToBytes() const
-    throw(bad_alloc)
+size_t RequestCycleMessage::serializedBytesCount() const
+    noexcept
 {
-    auto serializedAmount = trustLineAmountToBytes(mAmount); // TODO: serialize only non-zero
-    auto parentBytesAndCount = TransactionMessage::serializeToBytes();
-    size_t bytesCount =
-        + parentBytesAndCount.second
-        + kTrustLineAmountBytesCount;
-
-    BytesShared buffer = tryMalloc(bytesCount);
-    auto initialOffset = buffer.get();
-    memcpy(
-        initialOffset,
-        parentBytesAndCount.first.get(),
-        parentBytesAndCount.second);
-
-    auto bytesBufferOffset = initialOffset + parentBytesAndCount.second;
+    return
+        TransactionMessage::serializedBytesCount()
+        + trustLineAmountBytesCount(mAmount, mAmountsEncoding);
+}
 
-    memcpy(
+byte* RequestCycleMessage::serializeToBuffer(
+    byte *buffer) const
+    noexcept
+{
+    auto bytesBufferOffset = TransactionMessage::serializeToBuffer(buffer);
+    return trustLineAmountToBytes(
+        mAmount,
         bytesBufferOffset,
-        serializedAmount.data(),
-        kTrustLineAmountBytesCount);
-
-    return make_pair(
-        buffer,
-        bytesCount);
+        mAmountsEncoding);
 }
 
 const size_t RequestCycleMessage::kOffsetToInheritedBytes() const
     noexcept
 {
-    static const size_t offset =
+    // Amount is of variable length, so the offset depends on the deserialized amount.
+    return
         TransactionMessage::kOffsetToInheritedBytes()
-        + kTrustLineAmountBytesCount;
-
-    return offset;
+        + trustLineAmountBytesCount(mAmount, mAmountsEncoding);
 }
@@ -28,8 +28,12 @@ public:
     const TrustLineAmount& amount() const;
 
 protected:
-    virtual pair<BytesShared, size_t> serializeToBytes() const
-    throw(bad_alloc);
+    size_t serializedBytesCount() const
+        noexcept;
+
+    byte* serializeToBuffer(
+        byte *buffer) const
+        noexcept;
 
     const size_t kOffsetToInheritedBytes() const
     noexcept;
@@ -33,12 +33,8 @@ RequestMessage::RequestMessage(
     PathID *pathID = new (bytesBufferOffset) PathID;
     mPathID = *pathID;
     bytesBufferOffset += sizeof(PathID);
-    auto amountEndOffset = bytesBufferOffset + kTrustLineBalanceBytesCount; // TODO: deserialize only non-zero
-    vector<byte> amountBytes(
-        bytesBufferOffset,
-        amountEndOffset);
-
-    mAmount = bytesToTrustLineAmount(amountBytes);
+    mAmountsEncoding = amountsEncoding(buffer);
+    mAmount = bytesToTrustLineAmount(bytesBufferOffset, mAmountsEncoding);
 }
 
 const TrustLineAmount &RequestMessage::amount() const
@@ -51,54 +47,39 @@ const PathID &RequestMessage::pathID() const
     return mPathID;
 }
 
-/*!
- *
- * Throws bad_alloc;
- */
-pair<BytesShared, size_t> RequestMessage::serializeToBytes() const
-    throw(bad_alloc)
+size_t RequestMessage::serializedBytesCount() const
+    noexcept
 {
-
-    auto serializedAmount = trustLineAmountToBytes(mAmount); // TODO: serialize only non-zero
-    auto parentBytesAndCount = TransactionMessage::serializeToBytes();
-    size_t bytesCount =
-        + parentBytesAndCount.second
+    return
+        TransactionMessage::serializedBytesCount()
         + sizeof(PathID)
-        + kTrustLineAmountBytesCount;
-
-    BytesShared buffer = tryMalloc(bytesCount);
-    auto initialOffset = buffer.get();
-    memcpy(
-        initialOffset,
-        parentBytesAndCount.first.get(),
-        parentBytesAndCount.second);
-
-    auto bytesBufferOffset = initialOffset + parentBytesAndCount.second;
+        + trustLineAmountBytesCount(mAmount, mAmountsEncoding);
+}
 
+byte* RequestMessage::serializeToBuffer(
+    byte *buffer) const
+    noexcept
+{
+    auto bytesBufferOffset = TransactionMessage::serializeToBuffer(buffer);
     memcpy(
         bytesBufferOffset,
         &mPathID,
         sizeof(PathID));
     bytesBufferOffset += sizeof(PathID);
 
-    memcpy(
+    return trustLineAmountToBytes(
+        mAmount,
         bytesBufferOffset,
-        serializedAmount.data(),
-        kTrustLineAmountBytesCount);
-
-    return make_pair(
-        buffer,
-        bytesCount);
+        mAmountsEncoding);
 }
 
 const size_t RequestMessage::kOffsetToInheritedBytes() const
     noexcept
 {
-    static const size_t offset =
+    // Amount is of variable length, so the offset depends on the deserialized amount.
+    return
         TransactionMessage::kOffsetToInheritedBytes()
         + sizeof(PathID)
-        + kTrustLineAmountBytesCount;
-
-    return offset;
+        + trustLineAmountBytesCount(mAmount, mAmountsEncoding);
 }
 
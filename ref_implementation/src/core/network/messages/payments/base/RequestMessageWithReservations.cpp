@@ -26,6 +26,7 @@ RequestMessageWithReservations::RequestMessageWithReservations(
 
     TransactionMessage(buffer)
 {
+    mAmountsEncoding = amountsEncoding(buffer);
     auto parentMessageOffset = TransactionMessage::kOffsetToInheritedBytes();
     auto bytesBufferOffset = buffer.get() + parentMessageOffset;
     //----------------------------------------------------
@@ -37,12 +38,9 @@ RequestMessageWithReservations::RequestMessageWithReservations(
         PathID *pathID = new (bytesBufferOffset) PathID;
         bytesBufferOffset += sizeof(PathID);
         //---------------------------------------------------
-        vector<byte> bufferTrustLineAmount(
-            bytesBufferOffset,
-            bytesBufferOffset + kTrustLineAmountBytesCount);
-        bytesBufferOffset += kTrustLineAmountBytesCount;
+        TrustLineAmount trustLineAmount = bytesToTrustLineAmount(bytesBufferOffset, mAmountsEncoding);
+        bytesBufferOffset += encodedTrustLineAmountBytesCount(bytesBufferOffset, mAmountsEncoding);
         //---------------------------------------------------
-        TrustLineAmount trustLineAmount = bytesToTrustLineAmount(bufferTrustLineAmount);
         mFinalAmountsConfiguration.push_back(
             make_pair(
                 *pathID,
@@ -56,34 +54,24 @@ const vector<pair<PathID, ConstSharedTrustLineAmount>>& RequestMessageWithReserv
     return mFinalAmountsConfiguration;
 }
 
-/*!
- *
- * Throws bad_alloc;
- */
-pair<BytesShared, size_t> RequestMessageWithReservations::serializeToBytes() const
-    throw (bad_alloc)
+size_t RequestMessageWithReservations::serializedBytesCount() const
+    noexcept
 {
-    auto parentBytesAndCount = TransactionMessage::serializeToBytes();
-    size_t bytesCount =
-            + parentBytesAndCount.second
-            + sizeof(SerializedRecordsCount)
-            + mFinalAmountsConfiguration.size() *
-              (sizeof(PathID) + kTrustLineAmountBytesCount);
-
-    BytesShared buffer = tryMalloc(bytesCount);
-
-    auto initialOffset = buffer.get();
-    memcpy(
-        initialOffset,
-        parentBytesAndCount.first.get(),
-        parentBytesAndCount.second);
-    auto bytesBufferOffset = initialOffset + parentBytesAndCount.second;
+    return
+        TransactionMessage::serializedBytesCount()
+        + finalAmountsConfigurationBytesCount();
+}
 
+byte* RequestMessageWithReservations::serializeToBuffer(
+    byte *buffer) const
+    noexcept
+{
+    auto bytesBufferOffset = TransactionMessage::serializeToBuffer(buffer);
     //----------------------------------------------------
-    SerializedRecordsCount finalAmountsConfigurationCount = (SerializedRecordsCount)mFinalAmountsConfiguration.size();
+    const auto kFinalAmountsConfigurationCount = (SerializedRecordsCount)mFinalAmountsConfiguration.size();
     memcpy(
         bytesBufferOffset,
-        &finalAmountsConfigurationCount,
+        &kFinalAmountsConfigurationCount,
         sizeof(SerializedRecordsCount));
     bytesBufferOffset += sizeof(SerializedRecordsCount);
     //----------------------------------------------------
@@ -94,27 +82,31 @@ pair<BytesShared, size_t> RequestMessageWithReservations::serializeToBytes() con
             sizeof(PathID));
         bytesBufferOffset += sizeof(PathID);
 
-        vector<byte> serializedAmount = trustLineAmountToBytes(*it.second.get());
-        memcpy(
+        bytesBufferOffset = trustLineAmountToBytes(
+            *it.second,
             bytesBufferOffset,
-            serializedAmount.data(),
-            kTrustLineAmountBytesCount);
-        bytesBufferOffset += kTrustLineAmountBytesCount;
+            mAmountsEncoding);
     }
-    //----------------------------------------------------
-    return make_pair(
-        buffer,
-        bytesCount);
+
+    return bytesBufferOffset;
 }
 
 const size_t RequestMessageWithReservations::kOffsetToInheritedBytes() const
     noexcept
 {
-    auto kOffset =
-            TransactionMessage::kOffsetToInheritedBytes()
-            + sizeof(SerializedRecordsCount)
-            + finalAmountsConfiguration().size() *
-              (sizeof(PathID) + kTrustLineAmountBytesCount);
+    return
+        TransactionMessage::kOffsetToInheritedBytes()
+        + finalAmountsConfigurationBytesCount();
+}
 
-    return kOffset;
+size_t RequestMessageWithReservations::finalAmountsConfigurationBytesCount() const
+    noexcept
+{
+    size_t bytesCount = sizeof(SerializedRecordsCount);
+    for (auto const &it : mFinalAmountsConfiguration) {
+        bytesCount +=
+            sizeof(PathID)
+            + trustLineAmountBytesCount(*it.second, mAmountsEncoding);
+    }
+    return bytesCount;
 }
@@ -32,12 +32,19 @@ public:
     const vector<pair<PathID, ConstSharedTrustLineAmount>> &finalAmountsConfiguration() const;
 
 protected:
-    virtual pair<BytesShared, size_t> serializeToBytes() const
-    throw (bad_alloc);
+    size_t serializedBytesCount() const
+        noexcept;
+
+    byte* serializeToBuffer(
+        byte *buffer) const
+        noexcept;
 
     const size_t kOffsetToInheritedBytes() const
     noexcept;
 
+    size_t finalAmountsConfigurationBytesCount() const
+        noexcept;
+
 private:
     vector<pair<PathID, ConstSharedTrustLineAmount>> mFinalAmountsConfiguration;
 };
@@ -56,43 +56,32 @@ const size_t ResponseMessage::kOffsetToInheritedBytes() const
            + sizeof(SerializedOperationState);
 }
 
-/**
- *
- * @throws bad_alloc;
- */
-pair<BytesShared, size_t> ResponseMessage::serializeToBytes() const
-    throw (bad_alloc)
+size_t ResponseMessage::serializedBytesCount() const
+    noexcept
 {
-    auto parentBytesAndCount = TransactionMessage::serializeToBytes();
-
-    size_t bytesCount =
-        parentBytesAndCount.second
+    return
+        TransactionMessage::serializedBytesCount()
         + sizeof(PathID)
         + sizeof(SerializedOperationState);
+}
 
-    BytesShared dataBytesShared = tryMalloc(bytesCount);
-    size_t dataBytesOffset = 0;
-    //----------------------------------------------------
-    memcpy(
-        dataBytesShared.get(),
-        parentBytesAndCount.first.get(),
-        parentBytesAndCount.second);
-    dataBytesOffset += parentBytesAndCount.second;
-    //----------------------------------------------------
+byte* ResponseMessage::serializeToBuffer(
+    byte *buffer) const
+    noexcept
+{
+    auto bytesBufferOffset = TransactionMessage::serializeToBuffer(buffer);
     memcpy(
-        dataBytesShared.get() + dataBytesOffset,
+        bytesBufferOffset,
         &mPathID,
         sizeof(PathID));
-    dataBytesOffset += sizeof(PathID);
+    bytesBufferOffset += sizeof(PathID);
     //----------------------------------------------------
-    SerializedOperationState state(mState);
+    const SerializedOperationState kState(mState);
     memcpy(
-        dataBytesShared.get() + dataBytesOffset,
-        &state,
+        bytesBufferOffset,
+        &kState,
         sizeof(SerializedOperationState));
-    //----------------------------------------------------
-    return make_pair(
-        dataBytesShared,
-        bytesCount);
+
+    return bytesBufferOffset + sizeof(SerializedOperationState);
 }
 
@@ -45,8 +45,12 @@ protected:
     const size_t kOffsetToInheritedBytes() const
         noexcept;
 
-    pair<BytesShared, size_t> serializeToBytes() const
-        throw (bad_alloc);
+    size_t serializedBytesCount() const
+        noexcept;
+
+    byte* serializeToBuffer(
+        byte *buffer) const
+        noexcept;
 
 private:
     OperationState mState;
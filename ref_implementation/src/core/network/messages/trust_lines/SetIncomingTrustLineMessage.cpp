@@ -34,10 +34,10 @@ SetIncomingTrustLineMessage::SetIncomingTrustLineMessage(
 
     size_t bytesBufferOffset = DestinationMessage::kOffsetToInheritedBytes();
     //----------------------------------------------------
-    vector<byte> amountBytes(
+    mAmountsEncoding = amountsEncoding(buffer);
+    mAmount = bytesToTrustLineAmount(
         buffer.get() + bytesBufferOffset,
-        buffer.get() + bytesBufferOffset + kTrustLineAmountBytesCount);
-    mAmount = bytesToTrustLineAmount(amountBytes);
+        mAmountsEncoding);
 }
 
 
@@ -53,31 +53,21 @@ const TrustLineAmount &SetIncomingTrustLineMessage::amount() const
     return mAmount;
 }
 
-pair<BytesShared, size_t> SetIncomingTrustLineMessage::serializeToBytes() const
+size_t SetIncomingTrustLineMessage::serializedBytesCount() const
+    noexcept
 {
-    // todo: use serializer
-
-    auto parentBytesAndCount = DestinationMessage::serializeToBytes();
-
-    size_t bytesCount = parentBytesAndCount.second
-                        + kTrustLineAmountBytesCount;
+    return
+        DestinationMessage::serializedBytesCount()
+        + trustLineAmountBytesCount(mAmount, mAmountsEncoding);
+}
 
-    BytesShared dataBytesShared = tryCalloc(bytesCount);
-    size_t dataBytesOffset = 0;
-    //----------------------------------------------------
-    memcpy(
-        dataBytesShared.get(),
-        parentBytesAndCount.first.get(),
-        parentBytesAndCount.second);
-    dataBytesOffset += parentBytesAndCount.second;
-    //----------------------------------------------------
-    vector<byte> buffer = trustLineAmountToBytes(mAmount);
-    memcpy(
-        dataBytesShared.get() + dataBytesOffset,
-        buffer.data(),
-        buffer.size());
-    //----------------------------
-    return make_pair(
-        dataBytesShared,
-        bytesCount);
+byte* SetIncomingTrustLineMessage::serializeToBuffer(
+    byte *buffer) const
+    noexcept
+{
+    auto bytesBufferOffset = DestinationMessage::serializeToBuffer(buffer);
+    return trustLineAmountToBytes(
+        mAmount,
+        bytesBufferOffset,
+        mAmountsEncoding);
 }
@@ -38,9 +38,14 @@ public:
     const TrustLineAmount& amount() const
         noexcept;
 
-    virtual pair<BytesShared, size_t> serializeToBytes() const;
-
 protected:
+    size_t serializedBytesCount() const
+        noexcept;
+
+    byte* serializeToBuffer(
+        byte *buffer) const
+        noexcept;
+
     TrustLineAmount mAmount;
 };
 
@@ -79,18 +79,17 @@ void PathsManager::buildPathsOnOneLevel()
     auto itTrustLinePtr = trustLinePtrsSet.begin();
     while (itTrustLinePtr != trustLinePtrsSet.end()) {
         auto trustLine = (*itTrustLinePtr)->maxFlowCalculationtrustLine();
-        auto trustLineFreeAmountShared = trustLine->freeAmount();
-        auto trustLineAmountPtr = trustLineFreeAmountShared.get();
-        if (*trustLineAmountPtr == TrustLine::kZeroAmount()) {
+        const auto kFreeAmount = trustLine->freeFixedAmount();
+        if (kFreeAmount.isZero()) {
             itTrustLinePtr++;
             continue;
         }
         mPassedNodeUUIDs.clear();
-        TrustLineAmount flow = calculateOneNode(
+        FixedTrustLineAmount flow = calculateOneNode(
             trustLine->targetUUID(),
-            *trustLineAmountPtr,
+            kFreeAmount,
             1);
-        if (flow > TrustLine::kZeroAmount()) {
+        if (not flow.isZero()) {
             trustLine->addUsedAmount(flow);
         } else {
             itTrustLinePtr++;
@@ -110,14 +109,13 @@ void PathsManager::buildPathsOnSecondLevel()
             auto trustLine = (*itTrustLinePtr)->maxFlowCalculationtrustLine();
             bool isContinue = true;
             if (trustLine->targetUUID() == *itGateway) {
-                auto trustLineFreeAmountShared = trustLine->freeAmount();
-                auto trustLineAmountPtr = trustLineFreeAmountShared.get();
+                const auto kFreeAmount = trustLine->freeFixedAmount();
                 mPassedNodeUUIDs.clear();
-                TrustLineAmount flow = calculateOneNode(
+                FixedTrustLineAmount flow = calculateOneNode(
                     trustLine->targetUUID(),
-                    *trustLineAmountPtr,
+                    kFreeAmount,
                     1);
-                if (flow > TrustLine::kZeroAmount()) {
+                if (not flow.isZero()) {
                     trustLine->addUsedAmount(flow);
                 }
                 isContinue = false;
@@ -133,14 +131,13 @@ void PathsManager::buildPathsOnSecondLevel()
     auto itTrustLinePtr = trustLinePtrsSet.begin();
     while (itTrustLinePtr != trustLinePtrsSet.end()) {
         auto trustLine = (*itTrustLinePtr)->maxFlowCalculationtrustLine();
-        auto trustLineFreeAmountShared = trustLine->freeAmount();
-        auto trustLineAmountPtr = trustLineFreeAmountShared.get();
+        const auto kFreeAmount = trustLine->freeFixedAmount();
         mPassedNodeUUIDs.clear();
-        TrustLineAmount flow = calculateOneNode(
+        FixedTrustLineAmount flow = calculateOneNode(
             trustLine->targetUUID(),
-            *trustLineAmountPtr,
+            kFreeAmount,
             1);
-        if (flow > TrustLine::kZeroAmount()) {
+        if (not flow.isZero()) {
             trustLine->addUsedAmount(flow);
         } else {
             itTrustLinePtr++;
@@ -151,13 +148,13 @@ void PathsManager::buildPathsOnSecondLevel()
 // it used the same logic as PathsManager::calculateOneNodeForRebuildingPaths
 // and InitiateMaxFlowCalculationTransaction::calculateOneNode
 // if you change this method, you should change others
-TrustLineAmount PathsManager::calculateOneNode(
+FixedTrustLineAmount PathsManager::calculateOneNode(
     const NodeUUID& nodeUUID,
-    const TrustLineAmount& currentFlow,
+    const FixedTrustLineAmount& currentFlow,
     byte level)
 {
     if (nodeUUID == mContractorUUID) {
-        if (currentFlow > TrustLine::kZeroAmount()) {
+        if (not currentFlow.isZero()) {
             Path path(
                 mNodeUUID,
                 mContractorUUID,
@@ -187,22 +184,21 @@ TrustLineAmount PathsManager::calculateOneNode(
                 trustLine->targetUUID()) != mPassedNodeUUIDs.end()) {
             continue;
         }
-        TrustLineAmount nextFlow = currentFlow;
-        auto trustLineFreeAmountShared = trustLine.get()->freeAmount();
-        auto trustLineFreeAmountPtr = trustLineFreeAmountShared.get();
-        if (*trustLineFreeAmountPtr < currentFlow) {
-            nextFlow = *trustLineFreeAmountPtr;
+        FixedTrustLineAmount nextFlow = currentFlow;
+        const auto kFreeAmount = trustLine->freeFixedAmount();
+        if (kFreeAmount < currentFlow) {
+            nextFlow = kFreeAmount;
         }
-        if (nextFlow == TrustLine::kZeroAmount()) {
+        if (nextFlow.isZero()) {
             continue;
         }
         mPassedNodeUUIDs.push_back(nodeUUID);
-        TrustLineAmount calcFlow = calculateOneNode(
+        FixedTrustLineAmount calcFlow = calculateOneNode(
             trustLine->targetUUID(),
             nextFlow,
             level + (byte)1);
         mPassedNodeUUIDs.pop_back();
-        if (calcFlow > TrustLine::kZeroAmount()) {
+        if (not calcFlow.isZero()) {
             trustLine->addUsedAmount(calcFlow);
             return calcFlow;
         }
@@ -246,33 +242,32 @@ void PathsManager::reBuildPaths(
 // this method used for rebuild paths in case of insufficient founds
 // it used the same logic as PathsManager::reBuildPathsOnOneLevel
 // and InitiateMaxFlowCalculationTransaction::calculateMaxFlowOnOneLevel
-TrustLineAmount PathsManager::reBuildPathsOnOneLevel()
+FixedTrustLineAmount PathsManager::reBuildPathsOnOneLevel()
 {
-    TrustLineAmount result = 0;
+    FixedTrustLineAmount result = 0;
     auto trustLinePtrsSet =
             mMaxFlowCalculationTrustLineManager->trustLinePtrsSet(mNodeUUID);
     while(true) {
-        TrustLineAmount currentFlow = 0;
+        FixedTrustLineAmount currentFlow = 0;
         for (auto &trustLinePtr : trustLinePtrsSet) {
             auto trustLine = trustLinePtr->maxFlowCalculationtrustLine();
-            auto trustLineFreeAmountShared = trustLine->freeAmount();
-            auto trustLineAmountPtr = trustLineFreeAmountShared.get();
+            const auto kFreeAmount = trustLine->freeFixedAmount();
             mPassedNodeUUIDs.clear();
             if (mInaccessibleNodes.find(trustLine->targetUUID()) != mInaccessibleNodes.end()) {
                 continue;
             }
-            TrustLineAmount flow = calculateOneNodeForRebuildingPaths(
+            FixedTrustLineAmount flow = calculateOneNodeForRebuildingPaths(
                 trustLine->targetUUID(),
-                *trustLineAmountPtr,
+                kFreeAmount,
                 1);
-            if (flow > TrustLine::kZeroAmount()) {
+            if (not flow.isZero()) {
                 currentFlow += flow;
                 trustLine->addUsedAmount(flow);
                 break;
             }
         }
         result += currentFlow;
-        if (currentFlow == 0) {
+        if (currentFlow.isZero()) {
             break;
         }
     }
@@ -283,13 +278,13 @@ TrustLineAmount PathsManager::reBuildPathsOnOneLevel()
 // it used the same logic as PathsManager::calculateOneNode
 // and InitiateMaxFlowCalculationTransaction::calculateOneNode
 // if you change this method, you should change others
-TrustLineAmount PathsManager::calculateOneNodeForRebuildingPaths(
+FixedTrustLineAmount PathsManager::calculateOneNodeForRebuildingPaths(
     const NodeUUID& nodeUUID,
-    const TrustLineAmount& currentFlow,
+    const FixedTrustLineAmount& currentFlow,
     byte level)
 {
     if (nodeUUID == mContractorUUID) {
-        if (currentFlow > TrustLine::kZeroAmount()) {
+        if (not currentFlow.isZero()) {
             Path path(
                 mNodeUUID,
                 mContractorUUID,
@@ -324,22 +319,21 @@ TrustLineAmount PathsManager::calculateOneNodeForRebuildingPaths(
                 trustLine->targetUUID()) != mPassedNodeUUIDs.end()) {
             continue;
         }
-        TrustLineAmount nextFlow = currentFlow;
-        auto trustLineFreeAmountShared = trustLine.get()->freeAmount();
-        auto trustLineFreeAmountPtr = trustLineFreeAmountShared.get();
-        if (*trustLineFreeAmountPtr < currentFlow) {
-            nextFlow = *trustLineFreeAmountPtr;
+        FixedTrustLineAmount nextFlow = currentFlow;
+        const auto kFreeAmount = trustLine->freeFixedAmount();
+        if (kFreeAmount < currentFlow) {
+            nextFlow = kFreeAmount;
         }
-        if (nextFlow == TrustLine::kZeroAmount()) {
+        if (nextFlow.isZero()) {
             continue;
         }
         mPassedNodeUUIDs.push_back(nodeUUID);
-        TrustLineAmount calcFlow = calculateOneNodeForRebuildingPaths(
+        FixedTrustLineAmount calcFlow = calculateOneNodeForRebuildingPaths(
             trustLine->targetUUID(),
             nextFlow,
             level + (byte)1);
         mPassedNodeUUIDs.pop_back();
-        if (calcFlow > TrustLine::kZeroAmount()) {
+        if (not calcFlow.isZero()) {
             trustLine->addUsedAmount(calcFlow);
             return calcFlow;
         }
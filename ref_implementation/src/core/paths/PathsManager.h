@@ -55,16 +55,16 @@ private:
 
     void buildPathsOnSecondLevel();
 
-    TrustLineAmount calculateOneNode(
+    FixedTrustLineAmount calculateOneNode(
         const NodeUUID& nodeUUID,
-        const TrustLineAmount& currentFlow,
+        const FixedTrustLineAmount& currentFlow,
         byte level);
 
-    TrustLineAmount reBuildPathsOnOneLevel();
+    FixedTrustLineAmount reBuildPathsOnOneLevel();
 
-    TrustLineAmount calculateOneNodeForRebuildingPaths(
+    FixedTrustLineAmount calculateOneNodeForRebuildingPaths(
         const NodeUUID& nodeUUID,
-        const TrustLineAmount& currentFlow,
+        const FixedTrustLineAmount& currentFlow,
         byte level);
 
     LoggerStream info() const;
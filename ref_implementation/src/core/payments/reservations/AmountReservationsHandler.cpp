@@ -145,18 +145,29 @@ void AmountReservationsHandler::free(
  * Returns total amount, that was reserved on the trust line with the contractor == "trustLineContractor".
  * Optionally, filters locks by transactionUUID (see reservations(...) for details).
  * In case if no amount was reserved - returns 0;
+ *
+ * Reservations are summed right in the container (without copying it),
+ * because this method is called on each available amount query.
  */
-ConstSharedTrustLineAmount AmountReservationsHandler::totalReserved(
+TrustLineAmount AmountReservationsHandler::totalReserved(
     const NodeUUID &trustLineContractor,
     const AmountReservation::ReservationDirection direction,
     const TransactionUUID *transactionUUID) const {
 
-    SharedTrustLineAmount amount(new TrustLineAmount(0));
+    TrustLineAmount amount(0);
 
-    auto reservationsVector = reservations(trustLineContractor, transactionUUID);
-    for (auto lock : reservationsVector){
-        if (lock->direction() == direction)
-            (*amount) += (*lock).amount();
+    auto iterator = mReservations.find(trustLineContractor);
+    if (iterator == mReservations.end()) {
+        return amount;
+    }
+
+    for (const auto &lock : *(iterator->second)) {
+        if (lock->direction() != direction) {
+            continue;
+        }
+        if (transactionUUID == nullptr or lock->transactionUUID() == *transactionUUID) {
+            amount += lock->amount();
+        }
     }
 
     return amount;
@@ -166,14 +177,18 @@ ConstSharedTrustLineAmount AmountReservationsHandler::totalReserved(
  * Returns total amount, that was reserved on the trust line with the contractor == "trustLineContractor".
  * In case if no amount was reserved - returns 0;
  */
-ConstSharedTrustLineAmount AmountReservationsHandler::totalReservedOnTrustLine(
+TrustLineAmount AmountReservationsHandler::totalReservedOnTrustLine(
     const NodeUUID &trustLineContractor) const
 {
-    SharedTrustLineAmount amount(new TrustLineAmount(0));
+    TrustLineAmount amount(0);
 
-    auto reservationsVector = reservations(trustLineContractor);
-    for (auto lock : reservationsVector){
-        (*amount) += (*lock).amount();
+    auto iterator = mReservations.find(trustLineContractor);
+    if (iterator == mReservations.end()) {
+        return amount;
+    }
+
+    for (const auto &lock : *(iterator->second)) {
+        amount += lock->amount();
     }
 
     return amount;
@@ -38,12 +38,12 @@ public:
         const NodeUUID &trustLineContractor,
         const AmountReservation::ConstShared reservation);
 
-    ConstSharedTrustLineAmount totalReserved(
+    TrustLineAmount totalReserved(
         const NodeUUID &trustLineContractor,
         const AmountReservation::ReservationDirection direction,
         const TransactionUUID *transactionUUID = nullptr) const;
 
-    ConstSharedTrustLineAmount totalReservedOnTrustLine(
+    TrustLineAmount totalReservedOnTrustLine(
         const NodeUUID &trustLineContractor) const;
 
     bool isReservationPresent(
@@ -169,4 +169,20 @@ bool Settings::iAmGateway(const json *conf) const {
         // todo : throw RuntimeError
         return false;
     }
-}
\ No newline at end of file
+}
+
+/*
+ * Returns count of the additional threads, that receive and parse incoming messages;
+ * In case if option is not present - no additional threads are used.
+ */
+const size_t Settings::networkWorkersCount(const json *conf) const {
+    if (conf == nullptr) {
+        auto j = loadParsedJSON();
+        conf = &j;
+    }
+    try {
+        return (*conf).at("network").at("workers");
+    } catch (...) {
+        return 0;
+    }
+}
@@ -54,6 +54,9 @@ public:
     bool iAmGateway(
         const json *conf = nullptr) const;
 
+    const size_t networkWorkersCount(
+        const json *conf = nullptr) const;
+
     json loadParsedJSON() const;
 };
 
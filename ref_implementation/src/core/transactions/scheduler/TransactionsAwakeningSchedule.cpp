@@ -0,0 +1,94 @@
+/**
+ * This file is part of GEO Project.
+ * It is subject to the license terms in the LICENSE.md file found in the top-level directory
+ * of this distribution and at https://github.com/GEO-Project/GEO-Project/blob/master/LICENSE.md
+ *
+ * No part of GEO Project, including this file, may be copied, modified, propagated, or distributed
+ * except according to the terms contained in the LICENSE.md file.
+ */
+
+#include "TransactionsAwakeningSchedule.h"
+
+
+void TransactionsAwakeningSchedule::schedule(
+    BaseTransaction::Shared transaction,
+    const GEOEpochTimestamp awakeningTimestamp)
+{
+    if (isScheduled(transaction)) {
+        const auto kPosition = transaction->mAwakeningSchedulePosition;
+        mHeap[kPosition].awakeningTimestamp = awakeningTimestamp;
+        mHeap.update(kPosition);
+        return;
+    }
+
+    mHeap.push({transaction, awakeningTimestamp});
+}
+
+void TransactionsAwakeningSchedule::remove(
+    BaseTransaction::Shared transaction)
+    noexcept
+{
+    if (not isScheduled(transaction)) {
+        return;
+    }
+
+    mHeap.remove(transaction->mAwakeningSchedulePosition);
+    transaction->mAwakeningSchedulePosition = BaseTransaction::kNotScheduled;
+}
+
+GEOEpochTimestamp TransactionsAwakeningSchedule::earliestAwakeningTimestamp() const
+    noexcept
+{
+    return mHeap.front().awakeningTimestamp;
+}
+
+/**
+ * Subtrees of the heap, which root is scheduled later than "timestamp", are skipped entirely,
+ * so only the returned transactions (and their direct children) are visited.
+ */
+vector<BaseTransaction::Shared> TransactionsAwakeningSchedule::transactionsToAwake(
+    const GEOEpochTimestamp timestamp) const
+{
+    vector<BaseTransaction::Shared> transactions;
+    if (mHeap.empty() or mHeap.front().awakeningTimestamp > timestamp) {
+        return transactions;
+    }
+
+    vector<size_t> positionsToVisit;
+    positionsToVisit.push_back(0);
+    while (not positionsToVisit.empty()) {
+        const auto kPosition = positionsToVisit.back();
+        positionsToVisit.pop_back();
+        transactions.push_back(mHeap[kPosition].transaction);
+
+        for (auto childPosition = kPosition * 2 + 1; childPosition <= kPosition * 2 + 2; ++childPosition) {
+            if (childPosition < mHeap.size() and mHeap[childPosition].awakeningTimestamp <= timestamp) {
+                positionsToVisit.push_back(childPosition);
+            }
+        }
+    }
+    return transactions;
+}
+
+bool TransactionsAwakeningSchedule::mustBeAwakened(
+    BaseTransaction::Shared transaction,
+    const GEOEpochTimestamp timestamp) const
+    noexcept
+{
+    return isScheduled(transaction)
+        and mHeap[transaction->mAwakeningSchedulePosition].awakeningTimestamp <= timestamp;
+}
+
+bool TransactionsAwakeningSchedule::empty() const
+    noexcept
+{
+    return mHeap.empty();
+}
+
+bool TransactionsAwakeningSchedule::isScheduled(
+    const BaseTransaction::Shared &transaction) const
+    noexcept
+{
+    const auto kPosition = transaction->mAwakeningSchedulePosition;
+    return kPosition < mHeap.size() and mHeap[kPosition].transaction == transaction;
+}
@@ -0,0 +1,107 @@
+/**
+ * This file is part of GEO Project.
+ * It is subject to the license terms in the LICENSE.md file found in the top-level directory
+ * of this distribution and at https://github.com/GEO-Project/GEO-Project/blob/master/LICENSE.md
+ *
+ * No part of GEO Project, including this file, may be copied, modified, propagated, or distributed
+ * except according to the terms contained in the LICENSE.md file.
+ */
+
+#ifndef GEO_NETWORK_CLIENT_TRANSACTIONSAWAKENINGSCHEDULE_H
+#define GEO_NETWORK_CLIENT_TRANSACTIONSAWAKENINGSCHEDULE_H
+
+#include "../transactions/base/BaseTransaction.h"
+
+#include "../../common/time/TimeUtils.h"
+#include "../../common/heap/IndexedMinHeap.hpp"
+
+#include <vector>
+
+
+/**
+ * Orders delayed transactions by the timestamp of their awakening.
+ *
+ * Implemented as indexed binary min-heap. Position of each transaction in the heap is stored in the transaction itself,
+ * so the awakening of the transaction could be moved (in both directions) or cancelled without searching it.
+ *
+ * Earliest awakening - O(1), schedule / remove - O(log n),
+ * transactions to awake - O(k), where k is the count of the transactions to awake.
+ */
+class TransactionsAwakeningSchedule {
+public:
+    /**
+     * Adds the transaction to the schedule,
+     * or moves it's awakening in case if transaction is already scheduled.
+     */
+    void schedule(
+        BaseTransaction::Shared transaction,
+        const GEOEpochTimestamp awakeningTimestamp);
+
+    void remove(
+        BaseTransaction::Shared transaction)
+        noexcept;
+
+    /**
+     * @returns timestamp of the closest awakening.
+     * Schedule must not be empty.
+     */
+    GEOEpochTimestamp earliestAwakeningTimestamp() const
+        noexcept;
+
+    /**
+     * @returns all transactions, that must be awakened not later than "timestamp".
+     * Returned transactions are NOT removed from the schedule.
+     */
+    vector<BaseTransaction::Shared> transactionsToAwake(
+        const GEOEpochTimestamp timestamp) const;
+
+    /**
+     * @returns true in case if transaction is (still) scheduled
+     * for the awakening not later than "timestamp".
+     */
+    bool mustBeAwakened(
+        BaseTransaction::Shared transaction,
+        const GEOEpochTimestamp timestamp) const
+        noexcept;
+
+    bool empty() const
+        noexcept;
+
+protected:
+    struct ScheduledTransaction {
+        BaseTransaction::Shared transaction;
+        GEOEpochTimestamp awakeningTimestamp;
+    };
+
+    struct EarlierAwakening {
+        bool operator()(
+            const ScheduledTransaction &first,
+            const ScheduledTransaction &second) const
+            noexcept
+        {
+            return first.awakeningTimestamp < second.awakeningTimestamp;
+        }
+    };
+
+    struct SchedulePosition {
+        size_t &operator()(
+            const ScheduledTransaction &scheduledTransaction) const
+            noexcept
+        {
+            return scheduledTransaction.transaction->mAwakeningSchedulePosition;
+        }
+    };
+
+protected:
+    bool isScheduled(
+        const BaseTransaction::Shared &transaction) const
+        noexcept;
+
+protected:
+    IndexedMinHeap<
+        ScheduledTransaction,
+        EarlierAwakening,
+        SchedulePosition> mHeap;
+};
+
+#endif //GEO_NETWORK_CLIENT_TRANSACTIONSAWAKENINGSCHEDULE_H
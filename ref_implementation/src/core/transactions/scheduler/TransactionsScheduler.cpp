@@ -17,7 +17,7 @@ TransactionsScheduler::TransactionsScheduler(
     mIOService(IOService),
     mLog(logger),
 
-    mTransactions(new map<BaseTransaction::Shared, TransactionState::SharedConst>()),
+    mTransactions(new map<BaseTransaction::Shared, TransactionState>()),
     mProcessingTimer(new as::steady_timer(mIOService))
 {}
 
@@ -48,15 +48,16 @@ void TransactionsScheduler::run()
 void TransactionsScheduler::scheduleTransaction(
     BaseTransaction::Shared transaction)
 {
-    for ( auto it = mTransactions->begin(); it != mTransactions->end(); it++ ){
-        if (transaction->currentTransactionUUID() == it->first->currentTransactionUUID()) {
-            warning() << "scheduleTransaction: Duplicate TransactionUUID. Already exists. "
-                      << "Current TA type: " << transaction->transactionType()
-                      << ". Conflicted TA type:" << it->first->transactionType();
-            throw ConflictError("Duplicate Transaction UUID");
-        }
+    const auto kConflictedTransaction = mTransactionsByUUID.find(transaction->currentTransactionUUID());
+    if (kConflictedTransaction != mTransactionsByUUID.end()) {
+        warning() << "scheduleTransaction: Duplicate TransactionUUID. Already exists. "
+                  << "Current TA type: " << transaction->transactionType()
+                  << ". Conflicted TA type:" << kConflictedTransaction->second->transactionType();
+        throw ConflictError("Duplicate Transaction UUID");
     }
-    (*mTransactions)[transaction] = TransactionState::awakeAsFastAsPossible();
+    setTransactionState(
+        transaction,
+        TransactionState::awakeAsFastAsPossible());
 
     adjustAwakeningToNextTransaction();
 }
@@ -65,7 +66,9 @@ void TransactionsScheduler::postponeTransaction(
     BaseTransaction::Shared transaction,
     uint32_t millisecondsDelay)
 {
-    (*mTransactions)[transaction] = TransactionState::awakeAfterMilliseconds(millisecondsDelay);
+    setTransactionState(
+        transaction,
+        TransactionState::awakeAfterMilliseconds(millisecondsDelay));
 
     adjustAwakeningToNextTransaction();
 }
@@ -73,102 +76,147 @@ void TransactionsScheduler::postponeTransaction(
 void TransactionsScheduler::killTransaction(
     const TransactionUUID &transactionUUID)
 {
-    for (const auto &transactionAndState : *mTransactions) {
-        if (transactionAndState.first->currentTransactionUUID() == transactionUUID) {
-            forgetTransaction(transactionAndState.first);
-        }
+    const auto kTransaction = mTransactionsByUUID.find(transactionUUID);
+    if (kTransaction != mTransactionsByUUID.end()) {
+        // Note: copy of shared ptr is required (index record is removed by the forgetTransaction()).
+        const auto kTransactionToForget = kTransaction->second;
+        forgetTransaction(kTransactionToForget);
     }
 }
 
 void TransactionsScheduler::tryAttachMessageToTransaction(
     Message::Shared message)
 {
-    // TODO: check the message type before the loop
-    for (auto const &transactionAndState : *mTransactions) {
-
-        if (message->isTransactionMessage()) {
-            if (static_pointer_cast<TransactionMessage>(message)->transactionUUID() != transactionAndState.first->currentTransactionUUID()) {
-                continue;
+    if (message->isTransactionMessage()) {
+        const auto kTransaction = mTransactionsByUUID.find(
+            static_pointer_cast<TransactionMessage>(message)->transactionUUID());
+
+        if (kTransaction != mTransactionsByUUID.end()) {
+            // Note: copy of shared ptr is required (transaction may be forgotten on launch).
+            const auto kTransactionToAttach = kTransaction->second;
+            if (tryAttachMessage(kTransactionToAttach, mTransactions->at(kTransactionToAttach), message)) {
+                return;
             }
         }
 
-        // Six and five nodes cycles should be discovered only once per day,
-        // so, theoretically, only one discovering transaction may exist at once,
-        // and message may be attached to first found transaction.
-        if (transactionAndState.first->transactionType() == BaseTransaction::TransactionType::Cycles_SixNodesInitTransaction and
-            message->typeID() == Message::MessageType::Cycles_SixNodesBoundary) {
-            transactionAndState.first->pushContext(message);
-            return;
-        }
-        if (transactionAndState.first->transactionType() == BaseTransaction::TransactionType::Cycles_FiveNodesInitTransaction and
-            message->typeID() == Message::MessageType::Cycles_FiveNodesBoundary) {
-            transactionAndState.first->pushContext(message);
-            return;
-        }
-        if (transactionAndState.first->transactionType() == BaseTransaction::TransactionType::RoutingTableInitTransactionType and
-            message->typeID() == Message::MessageType::RoutingTableResponse) {
-            transactionAndState.first->pushContext(message);
-            return;
-        }
-
-
-        for (auto const &messageType : transactionAndState.second->acceptedMessagesTypes()) {
-            if (message->typeID() != messageType) {
-                continue;
+    } else {
+        BaseTransaction::TransactionType transactionType;
+        if (isMessageAcceptedByTransactionType(message->typeID(), transactionType)) {
+            const auto kTransactions = mTransactionsByType.find(transactionType);
+            if (kTransactions != mTransactionsByType.end() and not kTransactions->second.empty()) {
+                (*kTransactions->second.begin())->pushContext(message);
+                return;
             }
+        }
 
-            // filtering TTL response messages for payment TAs
-            // this messages can send only transaction coordinator
-            // in future if such cases will be more this code should make separate method
-            if (message->typeID() == Message::Payments_TTLProlongationResponse or
-                    message->typeID() == Message::Payments_FinalAmountsConfiguration or
-                    message->typeID() == Message::Payments_FinalPathConfiguration) {
-                auto paymentTransaction = static_pointer_cast<BasePaymentTransaction>(
-                    transactionAndState.first);
-                auto senderMessage = static_pointer_cast<SenderMessage>(message);
-                if (paymentTransaction->coordinatorUUID() != senderMessage->senderUUID) {
-                    continue;
+        const auto kTransactions = mTransactionsByAwaitedMessageType.find(message->typeID());
+        if (kTransactions != mTransactionsByAwaitedMessageType.end()) {
+            for (const auto &transaction : kTransactions->second) {
+                // Note: copy of shared ptr is required (transaction may be forgotten on launch).
+                const auto kTransactionToAttach = transaction;
+                if (tryAttachMessage(kTransactionToAttach, mTransactions->at(kTransactionToAttach), message)) {
+                    return;
                 }
             }
-
-            transactionAndState.first->pushContext(message);
-            if (transactionAndState.second->mustBeAwakenedOnMessage()) {
-                launchTransaction(transactionAndState.first);
-            }
-            return;
         }
     }
+
     throw NotFoundError(
         "TransactionsScheduler::handleMessage: "
             "invalid/unexpected message/response received " + to_string(message->typeID()));
-
 }
 
-void TransactionsScheduler::tryAttachResourceToTransaction(
-    BaseResource::Shared resource)
+/*!
+ * Attaches the message to the transaction in case if the transaction accepts it.
+ * Returns true if message was attached.
+ */
+bool TransactionsScheduler::tryAttachMessage(
+    BaseTransaction::Shared transaction,
+    const TransactionState &state,
+    Message::Shared message)
 {
-    for (const auto& transactionAndState : *mTransactions) {
+    BaseTransaction::TransactionType transactionType;
+    if (isMessageAcceptedByTransactionType(message->typeID(), transactionType)
+        and transaction->transactionType() == transactionType) {
+        transaction->pushContext(message);
+        return true;
+    }
 
-        if (resource->transactionUUID() != transactionAndState.first->currentTransactionUUID()) {
+    for (auto const &messageType : state.acceptedMessagesTypes()) {
+        if (message->typeID() != messageType) {
             continue;
         }
 
-        for (const auto &resType : transactionAndState.second->acceptedResourcesTypes()) {
-            if (resource->type() != resType) {
+        // filtering TTL response messages for payment TAs
+        // this messages can send only transaction coordinator
+        // in future if such cases will be more this code should make separate method
+        if (message->typeID() == Message::Payments_TTLProlongationResponse or
+                message->typeID() == Message::Payments_FinalAmountsConfiguration or
+                message->typeID() == Message::Payments_FinalPathConfiguration) {
+            auto paymentTransaction = static_pointer_cast<BasePaymentTransaction>(
+                transaction);
+            auto senderMessage = static_pointer_cast<SenderMessage>(message);
+            if (paymentTransaction->coordinatorUUID() != senderMessage->senderUUID) {
                 continue;
             }
+        }
 
-            transactionAndState.first->pushResource(resource);
+        transaction->pushContext(message);
+        if (state.mustBeAwakenedOnMessage()) {
+            launchTransaction(transaction);
         }
+        return true;
+    }
+    return false;
+}
 
-        launchTransaction(transactionAndState.first);
-        return;
+/*!
+ * Six and five nodes cycles should be discovered only once per day,
+ * so, theoretically, only one discovering transaction may exist at once,
+ * and boundary message may be attached to first found transaction of this type
+ * (regardless of it's state). The same is true for the routing table responses.
+ *
+ * Returns true and sets "transactionType" in case if "messageType" is one of such messages.
+ */
+bool TransactionsScheduler::isMessageAcceptedByTransactionType(
+    const Message::MessageType messageType,
+    BaseTransaction::TransactionType &transactionType)
+{
+    switch (messageType) {
+        case Message::MessageType::Cycles_SixNodesBoundary:
+            transactionType = BaseTransaction::TransactionType::Cycles_SixNodesInitTransaction;
+            return true;
+
+        case Message::MessageType::Cycles_FiveNodesBoundary:
+            transactionType = BaseTransaction::TransactionType::Cycles_FiveNodesInitTransaction;
+            return true;
+
+        case Message::MessageType::RoutingTableResponse:
+            transactionType = BaseTransaction::TransactionType::RoutingTableInitTransactionType;
+            return true;
 
+        default:
+            return false;
     }
+}
 
-    throw NotFoundError(
-        "TransactionsScheduler::tryAttachResourceToTransaction: "
-            "Can't find transaction that requires given resource.");
+void TransactionsScheduler::tryAttachResourceToTransaction(
+    BaseResource::Shared resource)
+{
+    const auto kTransaction = mTransactionsByUUID.find(resource->transactionUUID());
+    if (kTransaction == mTransactionsByUUID.end()) {
+        throw NotFoundError(
+            "TransactionsScheduler::tryAttachResourceToTransaction: "
+                "Can't find transaction that requires given resource.");
+    }
+
+    // Note: copy of shared ptr is required (transaction may be forgotten on launch).
+    const auto kTransactionToAttach = kTransaction->second;
+    if (mTransactions->at(kTransactionToAttach).acceptsResourceType(resource->type())) {
+        kTransactionToAttach->pushResource(resource);
+    }
+
+    launchTransaction(kTransactionToAttach);
 }
 
 void TransactionsScheduler::launchTransaction(
@@ -189,16 +237,9 @@ void TransactionsScheduler::launchTransaction(
         // Even if transaction will raise an exception -
         // it must not be thrown up,
         // to not to break transactions processing flow.
-        auto result = transaction->run();
-        if (result.get() == nullptr) {
-            throw ValueError(
-                "TransactionsScheduler::launchTransaction: "
-                "transaction->run() returned nullptr result.");
-        }
-
         handleTransactionResult(
             transaction,
-            result);
+            transaction->run());
 
     } catch (exception &e) {
         error() << "TA error occurred:"
@@ -215,20 +256,20 @@ void TransactionsScheduler::launchTransaction(
 
 void TransactionsScheduler::handleTransactionResult(
     BaseTransaction::Shared transaction,
-    TransactionResult::SharedConst result)
+    const TransactionResult &result)
 {
-    switch (result->resultType()) {
+    switch (result.resultType()) {
         case TransactionResult::ResultType::CommandResultType: {
             processCommandResult(
                 transaction,
-                result->commandResult());
+                result.commandResult());
             break;
         }
 
         case TransactionResult::ResultType::TransactionStateType: {
             processTransactionState(
                 transaction,
-                result->state());
+                result.state());
             break;
         }
     }
@@ -245,13 +286,13 @@ void TransactionsScheduler::processCommandResult(
 
 void TransactionsScheduler::processTransactionState(
     BaseTransaction::Shared transaction,
-    TransactionState::SharedConst state)
+    const TransactionState &state)
 {
-    if (state->mustSavePreviousStateState()) {
+    if (state.mustSavePreviousStateState()) {
         return;
     }
-    if (state->mustBeRescheduled()){
-        if (state->needSerialize())
+    if (state.mustBeRescheduled()){
+        if (state.needSerialize())
             serializeTransactionSignal(transaction);
 
         // From the C++ reference:
@@ -263,7 +304,9 @@ void TransactionsScheduler::processTransactionState(
         // the element is NOT INSERTED, ...
         //
         // So the [] operator must be used
-        (*mTransactions)[transaction] = state;
+        setTransactionState(
+            transaction,
+            state);
 
     } else {
         forgetTransaction(transaction);
@@ -286,54 +329,147 @@ void TransactionsScheduler::forgetTransaction(
     if (transaction->transactionType() == BaseTransaction::Payments_CycleCloserInitiatorTransaction) {
         cycleCloserTransactionWasFinishedSignal();
     }
-    mTransactions->erase(transaction);
+
+    const auto kTransactionAndState = mTransactions->find(transaction);
+    if (kTransactionAndState == mTransactions->end()) {
+        return;
+    }
+    removeTransactionFromIndexes(
+        transaction,
+        kTransactionAndState->second);
+    mAwakeningSchedule.remove(transaction);
+    mTransactions->erase(kTransactionAndState);
 }
 
-void TransactionsScheduler::adjustAwakeningToNextTransaction() {
+/*!
+ * Sets new state of the transaction (transaction is added in case if it is absent)
+ * and keeps the indexes in sync with the transactions map.
+ */
+void TransactionsScheduler::setTransactionState(
+    BaseTransaction::Shared transaction,
+    const TransactionState &state)
+{
+    const auto kTransactionAndState = mTransactions->find(transaction);
+    if (kTransactionAndState == mTransactions->end()) {
+        mTransactions->insert(
+            make_pair(
+                transaction,
+                state));
+        addTransactionToIndexes(transaction);
 
-    try {
-        asyncWaitUntil(
-            transactionWithMinimalAwakeningTimestamp().second);
+    } else {
+        removeAwaitedMessagesTypesFromIndex(
+            transaction,
+            kTransactionAndState->second);
+        kTransactionAndState->second = state;
+    }
 
-    } catch (NotFoundError &e) {}
+    addAwaitedMessagesTypesToIndex(
+        transaction,
+        state);
+
+    // Transactions, that are waiting only for the messages, are not awakened by the timer.
+    if (state.awakeningTimestamp() != numeric_limits<GEOEpochTimestamp>::max()) {
+        mAwakeningSchedule.schedule(
+            transaction,
+            state.awakeningTimestamp());
+    } else {
+        mAwakeningSchedule.remove(transaction);
+    }
 }
 
-/*!
- *
- * Throws NotFoundError in case if no transactions are delayed.
- */
-pair<BaseTransaction::Shared, GEOEpochTimestamp> TransactionsScheduler::transactionWithMinimalAwakeningTimestamp() const
+void TransactionsScheduler::addTransactionToIndexes(
+    BaseTransaction::Shared transaction)
 {
-    if (mTransactions->empty()) {
-        throw NotFoundError(
-            "TransactionsScheduler::transactionWithMinimalAwakeningTimestamp: "
-                "There are no any delayed transactions.");
+    mTransactionsByUUID.insert(
+        make_pair(
+            transaction->currentTransactionUUID(),
+            transaction));
+
+    mTransactionsByType[transaction->transactionType()].insert(transaction);
+
+    if (transaction->transactionType() == BaseTransaction::CoordinatorPaymentTransaction) {
+        mPaymentTransactionsByCommandUUID.insert(
+            make_pair(
+                static_pointer_cast<CoordinatorPaymentTransaction>(transaction)->commandUUID(),
+                transaction));
     }
+}
 
-    auto nextTransactionAndState = mTransactions->cbegin();
-    if (mTransactions->size() > 1) {
-        for (auto it=(mTransactions->cbegin()++); it != mTransactions->cend(); ++it){
-            if (it->second == nullptr) {
-                // Transaction has no state, and, as a result, doesn't have timeout set.
-                // Therefore, it can't be considered for awakening by the timeout.
-                continue;
-            }
+void TransactionsScheduler::removeTransactionFromIndexes(
+    BaseTransaction::Shared transaction,
+    const TransactionState &state)
+{
+    removeAwaitedMessagesTypesFromIndex(
+        transaction,
+        state);
+
+    // Index record is removed only if it points to this transaction:
+    // transactions with the same UUID may be added via addTransactionAndState().
+    const auto kTransactionByUUID = mTransactionsByUUID.find(transaction->currentTransactionUUID());
+    if (kTransactionByUUID != mTransactionsByUUID.end() and kTransactionByUUID->second == transaction) {
+        mTransactionsByUUID.erase(kTransactionByUUID);
+    }
 
-            if (it->second->awakeningTimestamp() < nextTransactionAndState->second->awakeningTimestamp()){
-                nextTransactionAndState = it;
-            }
+    const auto kTransactionsByType = mTransactionsByType.find(transaction->transactionType());
+    if (kTransactionsByType != mTransactionsByType.end()) {
+        kTransactionsByType->second.erase(transaction);
+        if (kTransactionsByType->second.empty()) {
+            mTransactionsByType.erase(kTransactionsByType);
         }
     }
 
-    if (nextTransactionAndState->second->mustBeRescheduled()){
-        return make_pair(
-            nextTransactionAndState->first,
-            nextTransactionAndState->second->awakeningTimestamp());
+    if (transaction->transactionType() == BaseTransaction::CoordinatorPaymentTransaction) {
+        const auto kTransactionByCommandUUID = mPaymentTransactionsByCommandUUID.find(
+            static_pointer_cast<CoordinatorPaymentTransaction>(transaction)->commandUUID());
+        if (kTransactionByCommandUUID != mPaymentTransactionsByCommandUUID.end()
+            and kTransactionByCommandUUID->second == transaction) {
+            mPaymentTransactionsByCommandUUID.erase(kTransactionByCommandUUID);
+        }
     }
+}
 
-    throw NotFoundError(
-        "TransactionsScheduler::transactionWithMinimalAwakeningTimestamp: "
-            "there are no any delayed transactions.");
+void TransactionsScheduler::addAwaitedMessagesTypesToIndex(
+    BaseTransaction::Shared transaction,
+    const TransactionState &state)
+{
+    for (const auto &messageType : state.acceptedMessagesTypes()) {
+        mTransactionsByAwaitedMessageType[messageType].insert(transaction);
+    }
+}
+
+void TransactionsScheduler::removeAwaitedMessagesTypesFromIndex(
+    BaseTransaction::Shared transaction,
+    const TransactionState &state)
+{
+    for (const auto &messageType : state.acceptedMessagesTypes()) {
+        const auto kTransactions = mTransactionsByAwaitedMessageType.find(messageType);
+        if (kTransactions == mTransactionsByAwaitedMessageType.end()) {
+            continue;
+        }
+
+        kTransactions->second.erase(transaction);
+        if (kTransactions->second.empty()) {
+            mTransactionsByAwaitedMessageType.erase(kTransactions);
+        }
+    }
+}
+
+/*!
+ * Plans the timer to the closest awakening.
+ * Timer is not re-planned in case if it would fire earlier anyway:
+ * awakening, that turned out to be premature, only re-plans the timer.
+ */
+void TransactionsScheduler::adjustAwakeningToNextTransaction()
+{
+    if (mAwakeningSchedule.empty()) {
+        return;
+    }
+
+    const auto kNextAwakeningTimestamp = mAwakeningSchedule.earliestAwakeningTimestamp();
+    if (kNextAwakeningTimestamp < mPlannedAwakeningTimestamp) {
+        asyncWaitUntil(kNextAwakeningTimestamp);
+    }
 }
 
 void TransactionsScheduler::asyncWaitUntil(
@@ -350,6 +486,7 @@ void TransactionsScheduler::asyncWaitUntil(
         microsecondsDelay = nextAwakeningTimestamp - now;
     }
 
+    mPlannedAwakeningTimestamp = nextAwakeningTimestamp;
     mProcessingTimer->expires_from_now(
         chrono::microseconds(microsecondsDelay));
 
@@ -369,6 +506,8 @@ void TransactionsScheduler::handleAwakening(
         return;
     }
 
+    mPlannedAwakeningTimestamp = kNotPlanned;
+
     if (errorMessage && errorMessage != as::error::operation_aborted) {
 
         if (errorsCount < 10) {
@@ -393,70 +532,74 @@ void TransactionsScheduler::handleAwakening(
         }
     }
 
-    try {
-        auto transactionAndDelay = transactionWithMinimalAwakeningTimestamp();
-        if (microsecondsSinceGEOEpoch(utc_now()) >= transactionAndDelay.second) {
-            launchTransaction(transactionAndDelay.first);
+    // All the transactions, that are due, are launched on one awakening.
+    // Each one is checked once more right before the launch:
+    // previously launched transactions may forget or reschedule it.
+    // Transactions, that are rescheduled to the past, would be launched on the next awakening.
+    const auto kNow = microsecondsSinceGEOEpoch(utc_now());
+    for (const auto &transaction : mAwakeningSchedule.transactionsToAwake(kNow)) {
+        if (mAwakeningSchedule.mustBeAwakened(transaction, kNow)) {
+            launchTransaction(transaction);
             errorsCount = 0;
         }
-
-        adjustAwakeningToNextTransaction();
-
-    } catch (NotFoundError &) {
-        // There are no transactions left.
-        // Awakenings cycle reached the end.
-        return;
     }
+
+    adjustAwakeningToNextTransaction();
 }
 
-const map<BaseTransaction::Shared, TransactionState::SharedConst>* transactions(
+const map<BaseTransaction::Shared, TransactionState>* transactions(
     TransactionsScheduler *scheduler)
 {
     return scheduler->mTransactions.get();
 }
 
-void TransactionsScheduler::addTransactionAndState(BaseTransaction::Shared transaction, TransactionState::SharedConst state)
+void TransactionsScheduler::addTransactionAndState(BaseTransaction::Shared transaction, const TransactionState &state)
 {
-    mTransactions->insert(make_pair(transaction, state));
+    if (mTransactions->count(transaction) != 0) {
+        return;
+    }
+    setTransactionState(
+        transaction,
+        state);
 }
 
 const BaseTransaction::Shared TransactionsScheduler::cycleClosingTransactionByUUID(
     const TransactionUUID &transactionUUID) const
 {
-    for (const auto &transactionAndState : *mTransactions.get()) {
-        if (transactionAndState.first->currentTransactionUUID() == transactionUUID) {
-            if (transactionAndState.first->transactionType() != BaseTransaction::Payments_CycleCloserInitiatorTransaction &&
-                transactionAndState.first->transactionType() != BaseTransaction::Payments_CycleCloserIntermediateNodeTransaction) {
-                throw ValueError("TransactionsScheduler::cycleClosingTransactionByUUID: "
-                                     "requested transaction doesn't belong to CycleClosing transactions");
-            }
-            return transactionAndState.first;
-        }
+    const auto kTransaction = mTransactionsByUUID.find(transactionUUID);
+    if (kTransaction == mTransactionsByUUID.end()) {
+        throw NotFoundError("TransactionsScheduler::cycleClosingTransactionByUUID: "
+                             "there is no transaction with requested UUID");
+    }
+
+    if (kTransaction->second->transactionType() != BaseTransaction::Payments_CycleCloserInitiatorTransaction &&
+        kTransaction->second->transactionType() != BaseTransaction::Payments_CycleCloserIntermediateNodeTransaction) {
+        throw ValueError("TransactionsScheduler::cycleClosingTransactionByUUID: "
+                             "requested transaction doesn't belong to CycleClosing transactions");
     }
-    throw NotFoundError("TransactionsScheduler::cycleClosingTransactionByUUID: "
-                         "there is no transaction with requested UUID");
+    return kTransaction->second;
 }
 
 bool TransactionsScheduler::isTransactionInProcess(
     const TransactionUUID &transactionUUID) const
 {
-    for (const auto &transactionAndState : *mTransactions.get()) {
-        if (transactionAndState.first->currentTransactionUUID() == transactionUUID) {
-            return true;
-        }
-    }
-    return false;
+    return mTransactionsByUUID.count(transactionUUID) > 0;
 }
 
 void TransactionsScheduler::tryAttachMessageToCollectTopologyTransaction(
     Message::Shared message)
 {
-    for (auto const &transactionAndState : *mTransactions) {
-        if (transactionAndState.first->transactionType() == BaseTransaction::InitiateMaxFlowCalculationTransactionType
-            or transactionAndState.first->transactionType() == BaseTransaction::MaxFlowCalculationStepTwoTransactionType
-            or transactionAndState.first->transactionType() == BaseTransaction::FindPathByMaxFlowTransactionType
-            or transactionAndState.first->transactionType() == BaseTransaction::MaxFlowCalculationFullyTransactionType) {
-            transactionAndState.first->pushContext(message);
+    static const BaseTransaction::TransactionType kCollectingTopologyTransactionsTypes[] = {
+        BaseTransaction::InitiateMaxFlowCalculationTransactionType,
+        BaseTransaction::MaxFlowCalculationStepTwoTransactionType,
+        BaseTransaction::FindPathByMaxFlowTransactionType,
+        BaseTransaction::MaxFlowCalculationFullyTransactionType,
+    };
+
+    for (const auto &transactionType : kCollectingTopologyTransactionsTypes) {
+        const auto kTransactions = mTransactionsByType.find(transactionType);
+        if (kTransactions != mTransactionsByType.end() and not kTransactions->second.empty()) {
+            (*kTransactions->second.begin())->pushContext(message);
             return;
         }
     }
@@ -469,16 +612,11 @@ void TransactionsScheduler::tryAttachMessageToCollectTopologyTransaction(
 const BaseTransaction::Shared TransactionsScheduler::paymentTransactionByCommandUUID(
     const CommandUUID &commandUUID) const
 {
-    for (const auto &transactionAndState : *mTransactions.get()) {
-        if (transactionAndState.first->transactionType() != BaseTransaction::CoordinatorPaymentTransaction) {
-            continue;
-        }
-        auto paymentTransaction = static_pointer_cast<CoordinatorPaymentTransaction>(transactionAndState.first);
-        if (paymentTransaction->commandUUID() == commandUUID) {
-            return transactionAndState.first;
-        }
+    const auto kTransaction = mPaymentTransactionsByCommandUUID.find(commandUUID);
+    if (kTransaction == mPaymentTransactionsByCommandUUID.end()) {
+        return nullptr;
     }
-    return nullptr;
+    return kTransaction->second;
 }
 
 string TransactionsScheduler::logHeader()
@@ -12,6 +12,8 @@
 
 #include "../../common/time/TimeUtils.h"
 
+#include "TransactionsAwakeningSchedule.h"
+
 #include "../../network/messages/Message.hpp"
 #include "../../network/messages/base/transaction/TransactionMessage.h"
 
@@ -33,9 +35,12 @@
 #include <boost/asio/steady_timer.hpp>
 #include <boost/bind.hpp>
 #include <boost/signals2.hpp>
+#include <boost/functional/hash.hpp>
 
 #include <chrono>
 #include <map>
+#include <set>
+#include <unordered_map>
 #include <memory>
 #include <stdint.h>
 
@@ -80,10 +85,10 @@ public:
     void tryAttachResourceToTransaction(
         BaseResource::Shared resource);
 
-    friend const map<BaseTransaction::Shared, TransactionState::SharedConst>* transactions(
+    friend const map<BaseTransaction::Shared, TransactionState>* transactions(
         TransactionsScheduler *scheduler);
 
-    void addTransactionAndState(BaseTransaction::Shared transaction, TransactionState::SharedConst state);
+    void addTransactionAndState(BaseTransaction::Shared transaction, const TransactionState &state);
 
     const BaseTransaction::Shared cycleClosingTransactionByUUID(
         const TransactionUUID &transactionUUID) const;
@@ -119,7 +124,7 @@ private:
 
     void handleTransactionResult(
         BaseTransaction::Shared transaction,
-        TransactionResult::SharedConst result);
+        const TransactionResult &result);
 
     void processCommandResult(
         BaseTransaction::Shared transaction,
@@ -127,14 +132,40 @@ private:
 
     void processTransactionState(
         BaseTransaction::Shared transaction,
-        TransactionState::SharedConst state);
+        const TransactionState &state);
 
     void forgetTransaction(
         BaseTransaction::Shared transaction);
 
-    void adjustAwakeningToNextTransaction();
+    void setTransactionState(
+        BaseTransaction::Shared transaction,
+        const TransactionState &state);
+
+    void addTransactionToIndexes(
+        BaseTransaction::Shared transaction);
+
+    void removeTransactionFromIndexes(
+        BaseTransaction::Shared transaction,
+        const TransactionState &state);
+
+    void addAwaitedMessagesTypesToIndex(
+        BaseTransaction::Shared transaction,
+        const TransactionState &state);
+
+    void removeAwaitedMessagesTypesFromIndex(
+        BaseTransaction::Shared transaction,
+        const TransactionState &state);
+
+    bool tryAttachMessage(
+        BaseTransaction::Shared transaction,
+        const TransactionState &state,
+        Message::Shared message);
 
-    pair<BaseTransaction::Shared, GEOEpochTimestamp> transactionWithMinimalAwakeningTimestamp() const;
+    static bool isMessageAcceptedByTransactionType(
+        const Message::MessageType messageType,
+        BaseTransaction::TransactionType &transactionType);
+
+    void adjustAwakeningToNextTransaction();
 
     void asyncWaitUntil(
         GEOEpochTimestamp nextAwakeningTimestamp);
@@ -154,7 +185,25 @@ private:
     Logger &mLog;
 
     unique_ptr<as::steady_timer> mProcessingTimer;
-    unique_ptr<map<BaseTransaction::Shared, TransactionState::SharedConst>> mTransactions;
+    unique_ptr<map<BaseTransaction::Shared, TransactionState>> mTransactions;
+
+    // Secondary indexes of the mTransactions.
+    // Messages, resources and requests are routed through them,
+    // so there is no need to scan all the transactions each time.
+    //
+    // Sets are ordered in the same way as mTransactions,
+    // so in case if several transactions are suitable - the same one is selected.
+    unordered_map<TransactionUUID, BaseTransaction::Shared, boost::hash<boost::uuids::uuid>> mTransactionsByUUID;
+    unordered_map<CommandUUID, BaseTransaction::Shared, boost::hash<boost::uuids::uuid>> mPaymentTransactionsByCommandUUID;
+    unordered_map<int, set<BaseTransaction::Shared>> mTransactionsByType;
+    unordered_map<int, set<BaseTransaction::Shared>> mTransactionsByAwaitedMessageType;
+
+    // Transactions, that are waiting for the awakening by the timer, ordered by the awakening timestamp.
+    TransactionsAwakeningSchedule mAwakeningSchedule;
+
+    // Timestamp, for which mProcessingTimer is planned (kNotPlanned if it is not planned).
+    static const GEOEpochTimestamp kNotPlanned = numeric_limits<GEOEpochTimestamp>::max();
+    GEOEpochTimestamp mPlannedAwakeningTimestamp = kNotPlanned;
 };
 
 #endif //GEO_NETWORK_CLIENT_TRANSACTIONSSCHEDULER_H
@@ -49,7 +49,7 @@ BaseCollectTopologyTransaction::BaseCollectTopologyTransaction(
     mMaxFlowCalculationNodeCacheManager(maxFlowCalculationNodeCacheManager)
 {}
 
-TransactionResult::SharedConst BaseCollectTopologyTransaction::run()
+TransactionResult BaseCollectTopologyTransaction::run()
 {
     switch (mStep) {
         case Stages::SendRequestForCollectingTopology: {
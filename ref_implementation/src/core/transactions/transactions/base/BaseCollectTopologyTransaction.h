@@ -45,7 +45,7 @@ public:
         MaxFlowCalculationNodeCacheManager *maxFlowCalculationNodeCacheManager,
         Logger &logger);
 
-    TransactionResult::SharedConst run();
+    TransactionResult run();
 
 protected:
     enum Stages {
@@ -54,9 +54,9 @@ protected:
     };
 
 protected:
-    virtual TransactionResult::SharedConst sendRequestForCollectingTopology() = 0;
+    virtual TransactionResult sendRequestForCollectingTopology() = 0;
 
-    virtual TransactionResult::SharedConst processCollectingTopology() = 0;
+    virtual TransactionResult processCollectingTopology() = 0;
 
     void fillTopology();
 
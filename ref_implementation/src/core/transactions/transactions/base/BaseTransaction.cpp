@@ -75,60 +75,59 @@ void BaseTransaction::launchSubsidiaryTransaction(
         transaction);
 }
 
-TransactionResult::Shared BaseTransaction::resultDone () const
+TransactionResult BaseTransaction::resultDone () const
 {
-    return make_shared<TransactionResult>(
+    return TransactionResult(
         TransactionState::exit());
 }
 
-TransactionResult::Shared BaseTransaction::resultFlushAndContinue() const
+TransactionResult BaseTransaction::resultFlushAndContinue() const
 {
-    return make_shared<TransactionResult>(
+    return TransactionResult(
         TransactionState::flushAndContinue());
 }
 
-// todo Change resultWaitForMessageTypes type to sharedConst
-TransactionResult::Shared BaseTransaction::resultWaitForMessageTypes(
-    vector<Message::MessageType> &&requiredMessagesTypes,
+TransactionResult BaseTransaction::resultWaitForMessageTypes(
+    initializer_list<Message::MessageType> requiredMessagesTypes,
     uint32_t noLongerThanMilliseconds) const
 {
-    return make_shared<TransactionResult>(
+    return TransactionResult(
         TransactionState::waitForMessageTypes(
-            move(requiredMessagesTypes),
+            requiredMessagesTypes,
             noLongerThanMilliseconds));
 }
 
-TransactionResult::Shared BaseTransaction::resultWaitForResourceTypes(
-    vector<BaseResource::ResourceType> &&requiredResourcesType,
+TransactionResult BaseTransaction::resultWaitForResourceTypes(
+    initializer_list<BaseResource::ResourceType> requiredResourcesType,
     uint32_t noLongerThanMilliseconds) const
 {
-    return make_shared<TransactionResult>(
+    return TransactionResult(
         TransactionState::waitForResourcesTypes(
-            move(requiredResourcesType),
+            requiredResourcesType,
             noLongerThanMilliseconds));
 }
 
-TransactionResult::Shared BaseTransaction::resultAwakeAfterMilliseconds(
+TransactionResult BaseTransaction::resultAwakeAfterMilliseconds(
     uint32_t responseWaitTime) const
 {
-    return make_shared<TransactionResult>(
+    return TransactionResult(
         TransactionState::awakeAfterMilliseconds(
             responseWaitTime));
 }
 
-TransactionResult::Shared BaseTransaction::resultContinuePreviousState() const
+TransactionResult BaseTransaction::resultContinuePreviousState() const
 {
-    return make_shared<TransactionResult>(
+    return TransactionResult(
         TransactionState::continueWithPreviousState());
 }
 
-TransactionResult::Shared BaseTransaction::resultWaitForMessageTypesAndAwakeAfterMilliseconds(
-    vector<Message::MessageType> &&requiredMessagesTypes,
+TransactionResult BaseTransaction::resultWaitForMessageTypesAndAwakeAfterMilliseconds(
+    initializer_list<Message::MessageType> requiredMessagesTypes,
     uint32_t noLongerThanMilliseconds) const
 {
-    return make_shared<TransactionResult>(
+    return TransactionResult(
         TransactionState::waitForMessageTypesAndAwakeAfterMilliseconds(
-            move(requiredMessagesTypes),
+            requiredMessagesTypes,
             noLongerThanMilliseconds));
 }
 
@@ -222,13 +221,12 @@ const size_t BaseTransaction::kOffsetToInheritedBytes()
     return offset;
 }
 
-TransactionResult::SharedConst BaseTransaction::transactionResultFromCommand(
+TransactionResult BaseTransaction::transactionResultFromCommand(
     CommandResult::SharedConst result) const
 {
-    // todo: refactor me
-    TransactionResult *transactionResult = new TransactionResult();
-    transactionResult->setCommandResult(result);
-    return TransactionResult::SharedConst(transactionResult);
+    TransactionResult transactionResult;
+    transactionResult.setCommandResult(result);
+    return transactionResult;
 }
 
 LoggerStream BaseTransaction::info() const
@@ -34,12 +34,15 @@
 #include <utility>
 #include <cstdint>
 #include <sstream>
+#include <limits>
 
 
 namespace signals = boost::signals2;
 
 // todo: [hsc] consider separating network logic from the base TA logic, for example in separate class.
 class BaseTransaction {
+    friend class TransactionsAwakeningSchedule;
+
 public:
     typedef shared_ptr<BaseTransaction> Shared;
     typedef uint16_t SerializedTransactionType;
@@ -51,25 +54,25 @@ public:
 
 public:
     // TODO: add other states shortcuts here
-    TransactionResult::Shared resultDone () const;
+    TransactionResult resultDone () const;
 
-    TransactionResult::Shared resultFlushAndContinue() const;
+    TransactionResult resultFlushAndContinue() const;
 
-    TransactionResult::Shared resultWaitForMessageTypes(
-        vector<Message::MessageType> &&requiredMessagesTypes,
+    TransactionResult resultWaitForMessageTypes(
+        initializer_list<Message::MessageType> requiredMessagesTypes,
         uint32_t noLongerThanMilliseconds) const;
 
-    TransactionResult::Shared resultWaitForResourceTypes(
-        vector<BaseResource::ResourceType> &&requiredResourcesType,
+    TransactionResult resultWaitForResourceTypes(
+        initializer_list<BaseResource::ResourceType> requiredResourcesType,
         uint32_t noLongerThanMilliseconds) const;
 
-    TransactionResult::Shared resultAwakeAfterMilliseconds(
+    TransactionResult resultAwakeAfterMilliseconds(
         uint32_t responseWaitTime) const ;
 
-    TransactionResult::Shared resultContinuePreviousState() const;
+    TransactionResult resultContinuePreviousState() const;
 
-    TransactionResult::Shared resultWaitForMessageTypesAndAwakeAfterMilliseconds(
-        vector<Message::MessageType> &&requiredMessagesTypes,
+    TransactionResult resultWaitForMessageTypesAndAwakeAfterMilliseconds(
+        initializer_list<Message::MessageType> requiredMessagesTypes,
         uint32_t noLongerThanMilliseconds) const;
 
 public:
@@ -168,7 +171,7 @@ public:
 
     virtual pair<BytesShared, size_t> serializeToBytes() const;
 
-    virtual TransactionResult::SharedConst run() = 0;
+    virtual TransactionResult run() = 0;
 
 protected:
     BaseTransaction(
@@ -254,7 +257,7 @@ protected:
 
     static const size_t kOffsetToInheritedBytes();
 
-    TransactionResult::SharedConst transactionResultFromCommand(
+    TransactionResult transactionResultFromCommand(
         CommandResult::SharedConst result) const;
 
     virtual const string logHeader() const = 0;
@@ -282,6 +285,11 @@ protected:
     uint8_t mVotesRecoveryStep = 0;
 
     Logger &mLog;
+
+private:
+    // Position of the transaction in the awakening schedule of the transactions scheduler.
+    static const size_t kNotScheduled = numeric_limits<size_t>::max();
+    size_t mAwakeningSchedulePosition = kNotScheduled;
 };
 
 
@@ -31,7 +31,7 @@ AddNodeToBlackListCommand::Shared AddNodeToBlackListTransaction::command() const
     return AddNodeToBlackListCommand::Shared();
 }
 
-TransactionResult::SharedConst AddNodeToBlackListTransaction::run()
+TransactionResult AddNodeToBlackListTransaction::run()
 {
     auto ioTransaction = mStorageHandler->beginTransaction();
     const auto contractorNode = mCommand->contractorUUID();
@@ -106,19 +106,19 @@ void AddNodeToBlackListTransaction::populateHistory(
 #endif
 }
 
-TransactionResult::SharedConst AddNodeToBlackListTransaction::resultOK()
+TransactionResult AddNodeToBlackListTransaction::resultOK()
 {
     return transactionResultFromCommand(
         mCommand->responseOK());
 }
 
-TransactionResult::SharedConst AddNodeToBlackListTransaction::resultForbiddenRun()
+TransactionResult AddNodeToBlackListTransaction::resultForbiddenRun()
 {
     return transactionResultFromCommand(
         mCommand->responseForbiddenRunTransaction());
 }
 
-TransactionResult::SharedConst AddNodeToBlackListTransaction::resultProtocolError()
+TransactionResult AddNodeToBlackListTransaction::resultProtocolError()
 {
     return transactionResultFromCommand(
         mCommand->responseProtocolError());
@@ -35,14 +35,14 @@ public:
 
     AddNodeToBlackListCommand::Shared command() const;
 
-    TransactionResult::SharedConst run();
+    TransactionResult run();
 
 protected:
-    TransactionResult::SharedConst resultOK();
+    TransactionResult resultOK();
 
-    TransactionResult::SharedConst resultForbiddenRun();
+    TransactionResult resultForbiddenRun();
 
-    TransactionResult::SharedConst resultProtocolError();
+    TransactionResult resultProtocolError();
 
 protected:
     void populateHistory(
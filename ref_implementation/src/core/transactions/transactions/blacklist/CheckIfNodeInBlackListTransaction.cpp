@@ -28,7 +28,7 @@ CheckIfNodeInBlackListCommand::Shared CheckIfNodeInBlackListTransaction::command
     return mCommand;
 }
 
-TransactionResult::SharedConst CheckIfNodeInBlackListTransaction::run() {
+TransactionResult CheckIfNodeInBlackListTransaction::run() {
     auto ioTransaction = mStorageHandler->beginTransaction();
     const auto contractorNode = mCommand->contractorUUID();
     const auto kContractorNodesBanned = ioTransaction->blackListHandler()->checkIfNodeExists(contractorNode);
@@ -30,7 +30,7 @@ public:
 
     CheckIfNodeInBlackListCommand::Shared command() const;
 
-    TransactionResult::SharedConst run();
+    TransactionResult run();
 
 protected:
     const string logHeader() const;
@@ -27,7 +27,7 @@ GetBlackListCommand::Shared GetBlackListTransaction::command() const {
     return mCommand;
 }
 
-TransactionResult::SharedConst GetBlackListTransaction::run() {
+TransactionResult GetBlackListTransaction::run() {
     auto ioTransaction = mStorageHandler->beginTransaction();
     const auto kBannedUsers = ioTransaction->blackListHandler()->allNodesUUIDS();
     stringstream ss;
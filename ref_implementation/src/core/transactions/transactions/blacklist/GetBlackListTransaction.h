@@ -32,7 +32,7 @@ public:
 
     GetBlackListCommand::Shared command() const;
 
-    TransactionResult::SharedConst run();
+    TransactionResult run();
 
 protected:
     const string logHeader() const;
@@ -28,7 +28,7 @@ RemoveNodeFromBlackListCommand::Shared RemoveNodeFromBlackListTransaction::comma
     return mCommand;
 }
 
-TransactionResult::SharedConst RemoveNodeFromBlackListTransaction::run() {
+TransactionResult RemoveNodeFromBlackListTransaction::run() {
     auto ioTransaction = mStorageHandler->beginTransaction();
     const auto contractorNode = mCommand->contractorUUID();
     const auto kContractorNodesBanned = ioTransaction->blackListHandler()->checkIfNodeExists(contractorNode);
@@ -29,7 +29,7 @@ public:
 
     RemoveNodeFromBlackListCommand::Shared command() const;
 
-    TransactionResult::SharedConst run();
+    TransactionResult run();
 
 protected:
     const string logHeader() const;
@@ -14,7 +14,7 @@ const BaseTransaction::TransactionType CyclesFiveNodesInitTransaction::transacti
     return BaseTransaction::TransactionType::Cycles_FiveNodesInitTransaction;
 }
 
-TransactionResult::SharedConst CyclesFiveNodesInitTransaction::runCollectDataAndSendMessagesStage()
+TransactionResult CyclesFiveNodesInitTransaction::runCollectDataAndSendMessagesStage()
 {
     debug() << "runCollectDataAndSendMessagesStage";
     vector<NodeUUID> firstLevelNodesNegativeBalance = mTrustLinesManager->firstLevelNeighborsWithNegativeBalance();
@@ -53,7 +53,7 @@ CyclesFiveNodesInitTransaction::CyclesFiveNodesInitTransaction(
 
 #pragma clang diagnostic push
 #pragma clang diagnostic ignored "-Wconversion"
-TransactionResult::SharedConst CyclesFiveNodesInitTransaction::runParseMessageAndCreateCyclesStage()
+TransactionResult CyclesFiveNodesInitTransaction::runParseMessageAndCreateCyclesStage()
 {
     debug() << "runParseMessageAndCreateCyclesStage";
     if (mContext.size() == 0) {
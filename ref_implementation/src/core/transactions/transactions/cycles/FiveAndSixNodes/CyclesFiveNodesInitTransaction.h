@@ -32,7 +32,7 @@ protected:
     const string logHeader() const;
 
 protected:
-    TransactionResult::SharedConst runCollectDataAndSendMessagesStage();
-    TransactionResult::SharedConst runParseMessageAndCreateCyclesStage();
+    TransactionResult runCollectDataAndSendMessagesStage();
+    TransactionResult runParseMessageAndCreateCyclesStage();
 };
 #endif //GEO_NETWORK_CLIENT_CYCLESFIVENODESINITTRANSACTION_H
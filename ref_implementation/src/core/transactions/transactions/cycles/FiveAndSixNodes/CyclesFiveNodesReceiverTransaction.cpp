@@ -24,7 +24,7 @@ CyclesFiveNodesReceiverTransaction::CyclesFiveNodesReceiverTransaction(
 
 #pragma clang diagnostic push
 #pragma clang diagnostic ignored "-Wconversion"
-TransactionResult::SharedConst CyclesFiveNodesReceiverTransaction::run()
+TransactionResult CyclesFiveNodesReceiverTransaction::run()
 {
     vector<NodeUUID> path = mInBetweenNodeTopologyMessage->Path();
     SerializedPathLengthSize currentDepth = path.size();
@@ -14,7 +14,7 @@ const BaseTransaction::TransactionType CyclesSixNodesInitTransaction::transactio
     return BaseTransaction::TransactionType::Cycles_SixNodesInitTransaction;
 }
 
-TransactionResult::SharedConst CyclesSixNodesInitTransaction::runCollectDataAndSendMessagesStage()
+TransactionResult CyclesSixNodesInitTransaction::runCollectDataAndSendMessagesStage()
 {
     debug() << "runCollectDataAndSendMessagesStage";
     const auto firstLevelNodes = mTrustLinesManager->firstLevelNeighborsWithNoneZeroBalance();
@@ -48,7 +48,7 @@ CyclesSixNodesInitTransaction::CyclesSixNodesInitTransaction(
 
 #pragma clang diagnostic push
 #pragma clang diagnostic ignored "-Wconversion"
-TransactionResult::SharedConst CyclesSixNodesInitTransaction::runParseMessageAndCreateCyclesStage()
+TransactionResult CyclesSixNodesInitTransaction::runParseMessageAndCreateCyclesStage()
 {
     debug() << "runParseMessageAndCreateCyclesStage";
     if (mContext.empty()) {
@@ -32,8 +32,8 @@ protected:
     const string logHeader() const;
 
 protected:
-    TransactionResult::SharedConst runCollectDataAndSendMessagesStage();
-    TransactionResult::SharedConst runParseMessageAndCreateCyclesStage();
+    TransactionResult runCollectDataAndSendMessagesStage();
+    TransactionResult runParseMessageAndCreateCyclesStage();
 
 };
 #endif //GEO_NETWORK_CLIENT_CYCLESSIXNODESINITTRANSACTION_H
@@ -22,7 +22,7 @@ CyclesSixNodesReceiverTransaction::CyclesSixNodesReceiverTransaction(
     mInBetweenNodeTopologyMessage(message)
 {}
 
-TransactionResult::SharedConst CyclesSixNodesReceiverTransaction::run()
+TransactionResult CyclesSixNodesReceiverTransaction::run()
 {
     vector<NodeUUID> path = mInBetweenNodeTopologyMessage->Path();
 #pragma clang diagnostic push
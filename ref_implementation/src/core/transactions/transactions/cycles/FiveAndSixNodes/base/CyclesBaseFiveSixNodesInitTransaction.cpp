@@ -25,7 +25,7 @@ CyclesBaseFiveSixNodesInitTransaction::CyclesBaseFiveSixNodesInitTransaction(
     mStorageHandler(storageHandler)
 {};
 
-TransactionResult::SharedConst CyclesBaseFiveSixNodesInitTransaction::run() {
+TransactionResult CyclesBaseFiveSixNodesInitTransaction::run() {
     switch (mStep) {
         case Stages::CollectDataAndSendMessage:
             return runCollectDataAndSendMessagesStage();
@@ -30,7 +30,7 @@ public:
         StorageHandler *storageHandler,
         Logger &logger);
 
-    TransactionResult::SharedConst run();
+    TransactionResult run();
 
 protected:
     enum Stages {
@@ -38,8 +38,8 @@ protected:
         ParseMessageAndCreateCycles
     };
 
-    virtual TransactionResult::SharedConst runCollectDataAndSendMessagesStage() = 0;
-    virtual TransactionResult::SharedConst runParseMessageAndCreateCyclesStage() = 0;
+    virtual TransactionResult runCollectDataAndSendMessagesStage() = 0;
+    virtual TransactionResult runParseMessageAndCreateCyclesStage() = 0;
     virtual const string logHeader() const = 0;
 
 protected:
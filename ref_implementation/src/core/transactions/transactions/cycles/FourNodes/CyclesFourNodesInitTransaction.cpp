@@ -29,7 +29,7 @@ CyclesFourNodesInitTransaction::CyclesFourNodesInitTransaction(
     mCreditorContractorUUID(creditorContractorUUID)
 {}
 
-TransactionResult::SharedConst CyclesFourNodesInitTransaction::run()
+TransactionResult CyclesFourNodesInitTransaction::run()
 {
     switch (mStep) {
         case Stages::CollectDataAndSendMessage:
@@ -45,7 +45,7 @@ TransactionResult::SharedConst CyclesFourNodesInitTransaction::run()
     }
 }
 
-TransactionResult::SharedConst CyclesFourNodesInitTransaction::runCollectDataAndSendMessageStage()
+TransactionResult CyclesFourNodesInitTransaction::runCollectDataAndSendMessageStage()
 {
     debug() << "runCollectDataAndSendMessageStage; Receiver is " << mCreditorContractorUUID;
 
@@ -71,7 +71,7 @@ TransactionResult::SharedConst CyclesFourNodesInitTransaction::runCollectDataAnd
         mkWaitingForResponseTime);
 }
 
-TransactionResult::SharedConst CyclesFourNodesInitTransaction::runParseMessageAndCreateCyclesStage()
+TransactionResult CyclesFourNodesInitTransaction::runParseMessageAndCreateCyclesStage()
 {
     debug() << "runParseMessageAndCreateCyclesStage";
     if (mContext.size() == 0) {
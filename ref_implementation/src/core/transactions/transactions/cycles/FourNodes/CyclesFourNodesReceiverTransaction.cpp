@@ -23,7 +23,7 @@ CyclesFourNodesReceiverTransaction::CyclesFourNodesReceiverTransaction(
     mRequestMessage(message)
 {}
 
-TransactionResult::SharedConst CyclesFourNodesReceiverTransaction::run()
+TransactionResult CyclesFourNodesReceiverTransaction::run()
 {
     const auto kDebtorNeighbor = mRequestMessage->debtor();
     const auto kCreditorNeighbor = mRequestMessage->creditor();
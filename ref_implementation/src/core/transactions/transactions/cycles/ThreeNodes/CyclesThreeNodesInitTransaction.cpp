@@ -29,7 +29,7 @@ CyclesThreeNodesInitTransaction::CyclesThreeNodesInitTransaction(
     mRoughtingTable(roughtingTable)
 {}
 
-TransactionResult::SharedConst CyclesThreeNodesInitTransaction::run()
+TransactionResult CyclesThreeNodesInitTransaction::run()
 {
     switch (mStep){
         case Stages::CollectDataAndSendMessage:
@@ -77,7 +77,7 @@ set<NodeUUID> CyclesThreeNodesInitTransaction::getNeighborsWithContractor()
     return commonNeighbors;
 }
 
-TransactionResult::SharedConst CyclesThreeNodesInitTransaction::runCollectDataAndSendMessageStage()
+TransactionResult CyclesThreeNodesInitTransaction::runCollectDataAndSendMessageStage()
 {
     debug() << "runCollectDataAndSendMessageStage to " << mContractorUUID;
     set<NodeUUID> neighbors = getNeighborsWithContractor();
@@ -96,7 +96,7 @@ TransactionResult::SharedConst CyclesThreeNodesInitTransaction::runCollectDataAn
         mkStandardConnectionTimeout);
 }
 
-TransactionResult::SharedConst CyclesThreeNodesInitTransaction::runParseMessageAndCreateCyclesStage()
+TransactionResult CyclesThreeNodesInitTransaction::runParseMessageAndCreateCyclesStage()
 {
     debug() << "runParseMessageAndCreateCyclesStage";
     if (mContext.size() != 1){
@@ -35,7 +35,7 @@ public:
         StorageHandler *storageHandler,
         Logger &logger);
 
-    TransactionResult::SharedConst run();
+    TransactionResult run();
 
 protected:
     enum Stages {
@@ -43,8 +43,8 @@ protected:
         ParseMessageAndCreateCycles
     };
 
-    TransactionResult::SharedConst runCollectDataAndSendMessageStage();
-    TransactionResult::SharedConst runParseMessageAndCreateCyclesStage();
+    TransactionResult runCollectDataAndSendMessageStage();
+    TransactionResult runParseMessageAndCreateCyclesStage();
 
 protected:
     const string logHeader() const;
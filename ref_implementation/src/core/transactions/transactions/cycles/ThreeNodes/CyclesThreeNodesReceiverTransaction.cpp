@@ -24,7 +24,7 @@ CyclesThreeNodesReceiverTransaction::CyclesThreeNodesReceiverTransaction(
     mRequestMessage(message)
 {}
 
-TransactionResult::SharedConst CyclesThreeNodesReceiverTransaction::run() {
+TransactionResult CyclesThreeNodesReceiverTransaction::run() {
     const auto kNeighbors = mRequestMessage->Neighbors();
     stringstream ss;
     // Create message and reserve memory for neighbors
@@ -29,7 +29,7 @@ public:
         TrustLinesManager *manager,
         Logger &logger);
 
-    TransactionResult::SharedConst run();
+    TransactionResult run();
 
 protected:
     const string logHeader() const;
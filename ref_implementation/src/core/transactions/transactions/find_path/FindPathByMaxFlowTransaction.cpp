@@ -36,7 +36,7 @@ FindPathByMaxFlowTransaction::FindPathByMaxFlowTransaction(
     mResourcesManager(resourcesManager)
 {}
 
-TransactionResult::SharedConst FindPathByMaxFlowTransaction::sendRequestForCollectingTopology() {
+TransactionResult FindPathByMaxFlowTransaction::sendRequestForCollectingTopology() {
     if (mContractorUUID == currentNodeUUID()) {
         warning() << "Attempt to initialise operation against itself was prevented. Canceled.";
         return resultDone();
@@ -64,7 +64,7 @@ TransactionResult::SharedConst FindPathByMaxFlowTransaction::sendRequestForColle
         kTopologyCollectingMillisecondsTimeout);
 }
 
-TransactionResult::SharedConst FindPathByMaxFlowTransaction::processCollectingTopology()
+TransactionResult FindPathByMaxFlowTransaction::processCollectingTopology()
 {
     fillTopology();
     mPathsManager->buildPaths(
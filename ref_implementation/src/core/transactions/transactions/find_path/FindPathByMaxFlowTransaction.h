@@ -39,11 +39,11 @@ protected:
     const string logHeader() const;
 
 private:
-    TransactionResult::SharedConst sendRequestForCollectingTopology();
+    TransactionResult sendRequestForCollectingTopology();
 
-    TransactionResult::SharedConst processCollectingTopologyShortly(){}
+    TransactionResult processCollectingTopologyShortly(){}
 
-    TransactionResult::SharedConst processCollectingTopology();
+    TransactionResult processCollectingTopology();
 
 private:
     // ToDo: move to separate config file
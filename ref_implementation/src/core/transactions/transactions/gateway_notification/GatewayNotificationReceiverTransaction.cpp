@@ -26,7 +26,7 @@ GatewayNotificationReceiverTransaction::GatewayNotificationReceiverTransaction(
     mStorageHandler(storageHandler)
 {}
 
-TransactionResult::SharedConst GatewayNotificationReceiverTransaction::run()
+TransactionResult GatewayNotificationReceiverTransaction::run()
 {
     if (!mTrustLineManager->isNeighbor(mMessage->senderUUID)) {
         warning() << "Sender " << mMessage->senderUUID << " is not neighbor of current node";
@@ -26,7 +26,7 @@ GatewayNotificationSenderTransaction::GatewayNotificationSenderTransaction(
     mIAmGateway(iAmGateway)
 {}
 
-TransactionResult::SharedConst GatewayNotificationSenderTransaction::run()
+TransactionResult GatewayNotificationSenderTransaction::run()
 {
     bool wasGatewayOnPreviousSession = false;
     auto ioTransaction = mStorageHandler->beginTransaction();
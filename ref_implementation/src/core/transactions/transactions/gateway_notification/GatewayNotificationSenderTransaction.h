@@ -28,7 +28,7 @@ public:
         bool iAmGateway,
         Logger &logger);
 
-    TransactionResult::SharedConst run();
+    TransactionResult run();
 
 protected:
     const string logHeader() const;
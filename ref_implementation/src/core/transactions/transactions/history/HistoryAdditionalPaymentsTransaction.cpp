@@ -28,7 +28,7 @@ HistoryAdditionalPaymentsCommand::Shared HistoryAdditionalPaymentsTransaction::c
     return mCommand;
 }
 
-TransactionResult::SharedConst HistoryAdditionalPaymentsTransaction::run()
+TransactionResult HistoryAdditionalPaymentsTransaction::run()
 {
     auto ioTransaction = mStorageHandler->beginTransaction();
 
@@ -46,7 +46,7 @@ TransactionResult::SharedConst HistoryAdditionalPaymentsTransaction::run()
     return resultOk(paymentRecords);
 }
 
-TransactionResult::SharedConst HistoryAdditionalPaymentsTransaction::resultOk(
+TransactionResult HistoryAdditionalPaymentsTransaction::resultOk(
     const vector<PaymentRecord::Shared> &records)
 {
     const auto kUnixEpoch = DateTime(boost::gregorian::date(1970,1,1));
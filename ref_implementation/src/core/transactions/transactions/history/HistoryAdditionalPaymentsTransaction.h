@@ -31,13 +31,13 @@ public:
 
     HistoryAdditionalPaymentsCommand::Shared command() const;
 
-    TransactionResult::SharedConst run();
+    TransactionResult run();
 
 protected:
     const string logHeader() const;
 
 private:
-    TransactionResult::SharedConst resultOk(
+    TransactionResult resultOk(
         const vector<PaymentRecord::Shared> &records);
 
 private:
@@ -28,7 +28,7 @@ HistoryPaymentsCommand::Shared HistoryPaymentsTransaction::command() const
     return mCommand;
 }
 
-TransactionResult::SharedConst HistoryPaymentsTransaction::run()
+TransactionResult HistoryPaymentsTransaction::run()
 {
     auto ioTransaction = mStorageHandler->beginTransaction();
 
@@ -55,7 +55,7 @@ TransactionResult::SharedConst HistoryPaymentsTransaction::run()
     return resultOk(paymentRecords);
 }
 
-TransactionResult::SharedConst HistoryPaymentsTransaction::resultOk(
+TransactionResult HistoryPaymentsTransaction::resultOk(
     const vector<PaymentRecord::Shared> &records)
 {
     const auto kUnixEpoch = DateTime(boost::gregorian::date(1970,1,1));
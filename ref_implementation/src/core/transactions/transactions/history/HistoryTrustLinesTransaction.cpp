@@ -28,7 +28,7 @@ HistoryTrustLinesCommand::Shared HistoryTrustLinesTransaction::command() const
     return mCommand;
 }
 
-TransactionResult::SharedConst HistoryTrustLinesTransaction::run()
+TransactionResult HistoryTrustLinesTransaction::run()
 {
     auto ioTransaction = mStorageHandler->beginTransaction();
     auto const trustLineRecords = ioTransaction->historyStorage()->allTrustLineRecords(
@@ -41,7 +41,7 @@ TransactionResult::SharedConst HistoryTrustLinesTransaction::run()
     return resultOk(trustLineRecords);
 }
 
-TransactionResult::SharedConst HistoryTrustLinesTransaction::resultOk(
+TransactionResult HistoryTrustLinesTransaction::resultOk(
     const vector<TrustLineRecord::Shared> &records)
 {
     const auto kUnixEpoch = DateTime(boost::gregorian::date(1970,1,1));
@@ -28,7 +28,7 @@ HistoryWithContractorCommand::Shared HistoryWithContractorTransaction::command()
     return mCommand;
 }
 
-TransactionResult::SharedConst HistoryWithContractorTransaction::run()
+TransactionResult HistoryWithContractorTransaction::run()
 {
     auto ioTransaction = mStorageHandler->beginTransaction();
     auto const resultRecords = ioTransaction->historyStorage()->recordsWithContractor(
@@ -38,7 +38,7 @@ TransactionResult::SharedConst HistoryWithContractorTransaction::run()
     return resultOk(resultRecords);
 }
 
-TransactionResult::SharedConst HistoryWithContractorTransaction::resultOk(
+TransactionResult HistoryWithContractorTransaction::resultOk(
     const vector<Record::Shared> &records)
 {
     const auto kUnixEpoch = DateTime(boost::gregorian::date(1970,1,1));
@@ -32,13 +32,13 @@ public:
 
     HistoryWithContractorCommand::Shared command() const;
 
-    TransactionResult::SharedConst run();
+    TransactionResult run();
 
 protected:
     const string logHeader() const;
 
 private:
-    TransactionResult::SharedConst resultOk(
+    TransactionResult resultOk(
         const vector<Record::Shared> &records);
 
 private:
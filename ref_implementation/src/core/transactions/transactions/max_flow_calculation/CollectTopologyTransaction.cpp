@@ -29,7 +29,7 @@ CollectTopologyTransaction::CollectTopologyTransaction(
     mMaxFlowCalculationNodeCacheManager(maxFlowCalculationNodeCacheManager)
 {}
 
-TransactionResult::SharedConst CollectTopologyTransaction::run()
+TransactionResult CollectTopologyTransaction::run()
 {
     debug() << "Collect topology to " << mContractors.size() << " contractors";
     // Check if Node does not have outgoing FlowAmount;
@@ -39,12 +39,11 @@ TransactionResult::SharedConst CollectTopologyTransaction::run()
     sendMessagesToContractors();
     if (!mMaxFlowCalculationCacheManager->isInitiatorCached()) {
         for (auto const &nodeUUIDAndOutgoingFlow : mTrustLinesManager->outgoingFlows()) {
-            auto trustLineAmountShared = nodeUUIDAndOutgoingFlow.second;
             mMaxFlowCalculationTrustLineManager->addTrustLine(
                 make_shared<MaxFlowCalculationTrustLine>(
                     mNodeUUID,
                     nodeUUIDAndOutgoingFlow.first,
-                    trustLineAmountShared));
+                    nodeUUIDAndOutgoingFlow.second));
         }
         sendMessagesOnFirstLevel();
         mMaxFlowCalculationCacheManager->setInitiatorCache();
@@ -36,7 +36,7 @@ InitiateMaxFlowCalculationCommand::Shared InitiateMaxFlowCalculationTransaction:
     return mCommand;
 }
 
-TransactionResult::SharedConst InitiateMaxFlowCalculationTransaction::sendRequestForCollectingTopology()
+TransactionResult InitiateMaxFlowCalculationTransaction::sendRequestForCollectingTopology()
 {
 #ifdef DEBUG_LOG_MAX_FLOW_CALCULATION
     info() << "run\t" << "initiator: " << mNodeUUID;
@@ -102,7 +102,7 @@ TransactionResult::SharedConst InitiateMaxFlowCalculationTransaction::sendReques
         kWaitMillisecondsForCalculatingMaxFlow);
 }
 
-TransactionResult::SharedConst InitiateMaxFlowCalculationTransaction::processCollectingTopology()
+TransactionResult InitiateMaxFlowCalculationTransaction::processCollectingTopology()
 {
 #ifdef DEBUG_LOG_MAX_FLOW_CALCULATION
     info() << "CalculateMaxTransactionFlow";
@@ -167,7 +167,7 @@ TrustLineAmount InitiateMaxFlowCalculationTransaction::calculateMaxFlow(
         return TrustLine::kZeroAmount();
     }
 
-    mCurrentMaxFlow = TrustLine::kZeroAmount();
+    mCurrentMaxFlow = 0;
     for (mCurrentPathLength = 1; mCurrentPathLength <= kMaxPathLength; mCurrentPathLength++) {
         calculateMaxFlowOnOneLevel();
     }
@@ -177,8 +177,8 @@ TrustLineAmount InitiateMaxFlowCalculationTransaction::calculateMaxFlow(
     mMaxFlowCalculationNodeCacheManager->addCache(
         mCurrentContractor,
         make_shared<MaxFlowCalculationNodeCache>(
-            mCurrentMaxFlow));
-    return mCurrentMaxFlow;
+            mCurrentMaxFlow.toTrustLineAmount()));
+    return mCurrentMaxFlow.toTrustLineAmount();
 }
 
 TrustLineAmount InitiateMaxFlowCalculationTransaction::calculateMaxFlowUpdated(
@@ -203,14 +203,14 @@ TrustLineAmount InitiateMaxFlowCalculationTransaction::calculateMaxFlowUpdated(
         return TrustLine::kZeroAmount();
     }
 
-    mCurrentMaxFlow = TrustLine::kZeroAmount();
+    mCurrentMaxFlow = 0;
     for (mCurrentPathLength = 1; mCurrentPathLength <= kMaxPathLength; mCurrentPathLength++) {
         calculateMaxFlowOnOneLevelUpdated();
     }
 
     mMaxFlowCalculationTrustLineManager->resetAllUsedAmounts();
     info() << "max flow updated calculating time: " << utc_now() - startTime;
-    return mCurrentMaxFlow;
+    return mCurrentMaxFlow.toTrustLineAmount();
 }
 
 // this method used the same logic as PathsManager::reBuildPathsOnOneLevel
@@ -218,22 +218,21 @@ TrustLineAmount InitiateMaxFlowCalculationTransaction::calculateMaxFlowUpdated(
 void InitiateMaxFlowCalculationTransaction::calculateMaxFlowOnOneLevel()
 {
     while(true) {
-        TrustLineAmount currentFlow = 0;
+        FixedTrustLineAmount currentFlow = 0;
         for (auto &trustLinePtr : mFirstLevelTopology) {
             auto trustLine = trustLinePtr->maxFlowCalculationtrustLine();
-            auto trustLineFreeAmountShared = trustLine->freeAmount();
-            auto trustLineAmountPtr = trustLineFreeAmountShared.get();
+            const auto kFreeAmount = trustLine->freeFixedAmount();
             mForbiddenNodeUUIDs.clear();
-            TrustLineAmount flow = calculateOneNode(
+            FixedTrustLineAmount flow = calculateOneNode(
                 trustLine->targetUUID(),
-                *trustLineAmountPtr,
+                kFreeAmount,
                 1);
-            if (flow > TrustLine::kZeroAmount()) {
+            if (not flow.isZero()) {
                 currentFlow += flow;
                 trustLine->addUsedAmount(flow);
             }
         }
-        if (currentFlow == 0) {
+        if (currentFlow.isZero()) {
             break;
         }
     }
@@ -246,18 +245,17 @@ void InitiateMaxFlowCalculationTransaction::calculateMaxFlowOnOneLevelUpdated()
     auto itTrustLinePtr = trustLinePtrsSet.begin();
     while (itTrustLinePtr != trustLinePtrsSet.end()) {
         auto trustLine = (*itTrustLinePtr)->maxFlowCalculationtrustLine();
-        auto trustLineFreeAmountShared = trustLine->freeAmount();
-        auto trustLineAmountPtr = trustLineFreeAmountShared.get();
-        if (*trustLineAmountPtr == TrustLine::kZeroAmount()) {
+        const auto kFreeAmount = trustLine->freeFixedAmount();
+        if (kFreeAmount.isZero()) {
             itTrustLinePtr++;
             continue;
         }
         mForbiddenNodeUUIDs.clear();
-        TrustLineAmount flow = calculateOneNode(
+        FixedTrustLineAmount flow = calculateOneNode(
             trustLine->targetUUID(),
-            *trustLineAmountPtr,
+            kFreeAmount,
             1);
-        if (flow > TrustLine::kZeroAmount()) {
+        if (not flow.isZero()) {
             trustLine->addUsedAmount(flow);
         } else {
             itTrustLinePtr++;
@@ -268,13 +266,13 @@ void InitiateMaxFlowCalculationTransaction::calculateMaxFlowOnOneLevelUpdated()
 // it used the same logic as PathsManager::calculateOneNodeForRebuildingPaths
 // and PathsManager::calculateOneNode
 // if you change this method, you should change others
-TrustLineAmount InitiateMaxFlowCalculationTransaction::calculateOneNode(
+FixedTrustLineAmount InitiateMaxFlowCalculationTransaction::calculateOneNode(
     const NodeUUID& nodeUUID,
-    const TrustLineAmount& currentFlow,
+    const FixedTrustLineAmount& currentFlow,
     byte level)
 {
     if (nodeUUID == mCurrentContractor) {
-        if (currentFlow > TrustLine::kZeroAmount()) {
+        if (not currentFlow.isZero()) {
             mCurrentMaxFlow += currentFlow;
         }
         return currentFlow;
@@ -299,22 +297,21 @@ TrustLineAmount InitiateMaxFlowCalculationTransaction::calculateOneNode(
                 trustLine->targetUUID()) != mForbiddenNodeUUIDs.end()) {
             continue;
         }
-        TrustLineAmount nextFlow = currentFlow;
-        auto trustLineFreeAmountShared = trustLine.get()->freeAmount();
-        auto trustLineFreeAmountPtr = trustLineFreeAmountShared.get();
-        if (*trustLineFreeAmountPtr < currentFlow) {
-            nextFlow = *trustLineFreeAmountPtr;
+        FixedTrustLineAmount nextFlow = currentFlow;
+        const auto kFreeAmount = trustLine->freeFixedAmount();
+        if (kFreeAmount < currentFlow) {
+            nextFlow = kFreeAmount;
         }
-        if (nextFlow == TrustLine::kZeroAmount()) {
+        if (nextFlow.isZero()) {
             continue;
         }
         mForbiddenNodeUUIDs.push_back(nodeUUID);
-        TrustLineAmount calcFlow = calculateOneNode(
+        FixedTrustLineAmount calcFlow = calculateOneNode(
             trustLine->targetUUID(),
             nextFlow,
             level + (byte)1);
         mForbiddenNodeUUIDs.pop_back();
-        if (calcFlow > TrustLine::kZeroAmount()) {
+        if (not calcFlow.isZero()) {
             trustLine->addUsedAmount(calcFlow);
             return calcFlow;
         }
@@ -322,7 +319,7 @@ TrustLineAmount InitiateMaxFlowCalculationTransaction::calculateOneNode(
     return 0;
 }
 
-TransactionResult::SharedConst InitiateMaxFlowCalculationTransaction::resultOk(
+TransactionResult InitiateMaxFlowCalculationTransaction::resultOk(
     bool finalMaxFlows,
     vector<pair<NodeUUID, TrustLineAmount>> &maxFlows)
 {
@@ -342,7 +339,7 @@ TransactionResult::SharedConst InitiateMaxFlowCalculationTransaction::resultOk(
             kMaxFlowAmountsStr));
 }
 
-TransactionResult::SharedConst InitiateMaxFlowCalculationTransaction::resultProtocolError()
+TransactionResult InitiateMaxFlowCalculationTransaction::resultProtocolError()
 {
     return transactionResultFromCommand(
         mCommand->responseProtocolError());
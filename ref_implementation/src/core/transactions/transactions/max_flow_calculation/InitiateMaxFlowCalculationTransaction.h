@@ -50,9 +50,9 @@ protected:
     const string logHeader() const;
 
 private:
-    TransactionResult::SharedConst sendRequestForCollectingTopology();
+    TransactionResult sendRequestForCollectingTopology();
 
-    TransactionResult::SharedConst processCollectingTopology();
+    TransactionResult processCollectingTopology();
 
     TrustLineAmount calculateMaxFlow(
         const NodeUUID &contractorUUID);
@@ -64,16 +64,16 @@ private:
 
     void calculateMaxFlowOnOneLevelUpdated();
 
-    TrustLineAmount calculateOneNode(
+    FixedTrustLineAmount calculateOneNode(
         const NodeUUID& nodeUUID,
-        const TrustLineAmount& currentFlow,
+        const FixedTrustLineAmount& currentFlow,
         byte level);
 
-    TransactionResult::SharedConst resultOk(
+    TransactionResult resultOk(
         bool finalMaxFlows,
         vector<pair<NodeUUID, TrustLineAmount>> &maxFlows);
 
-    TransactionResult::SharedConst resultProtocolError();
+    TransactionResult resultProtocolError();
 
 private:
     static const byte kMaxPathLength = 5;
@@ -83,7 +83,7 @@ private:
     InitiateMaxFlowCalculationCommand::Shared mCommand;
     vector<NodeUUID> mForbiddenNodeUUIDs;
     byte mCurrentPathLength;
-    TrustLineAmount mCurrentMaxFlow;
+    FixedTrustLineAmount mCurrentMaxFlow;
     NodeUUID mCurrentContractor;
     size_t mCountProcessCollectingTopologyRun;
     bool mIAmGateway;
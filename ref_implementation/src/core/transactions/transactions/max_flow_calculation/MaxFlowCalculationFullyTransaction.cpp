@@ -34,7 +34,7 @@ InitiateMaxFlowCalculationFullyCommand::Shared MaxFlowCalculationFullyTransactio
     return mCommand;
 }
 
-TransactionResult::SharedConst MaxFlowCalculationFullyTransaction::sendRequestForCollectingTopology()
+TransactionResult MaxFlowCalculationFullyTransaction::sendRequestForCollectingTopology()
 {
 #ifdef DEBUG_LOG_MAX_FLOW_CALCULATION
     info() << "run\t" << "initiator: " << mNodeUUID;
@@ -77,7 +77,7 @@ TransactionResult::SharedConst MaxFlowCalculationFullyTransaction::sendRequestFo
         kWaitMillisecondsForCalculatingMaxFlow);
 }
 
-TransactionResult::SharedConst MaxFlowCalculationFullyTransaction::processCollectingTopology()
+TransactionResult MaxFlowCalculationFullyTransaction::processCollectingTopology()
 {
 #ifdef DEBUG_LOG_MAX_FLOW_CALCULATION
     info() << "CalculateMaxTransactionFlow";
@@ -126,7 +126,7 @@ TrustLineAmount MaxFlowCalculationFullyTransaction::calculateMaxFlow(
         return TrustLine::kZeroAmount();
     }
 
-    mCurrentMaxFlow = TrustLine::kZeroAmount();
+    mCurrentMaxFlow = 0;
     for (mCurrentPathLength = 1; mCurrentPathLength <= kMaxPathLength; mCurrentPathLength++) {
         calculateMaxFlowOnOneLevel();
     }
@@ -138,17 +138,17 @@ TrustLineAmount MaxFlowCalculationFullyTransaction::calculateMaxFlow(
     if (nodeCache != nullptr) {
         mMaxFlowCalculationNodeCacheManager->updateCache(
             mCurrentContractor,
-            mCurrentMaxFlow,
+            mCurrentMaxFlow.toTrustLineAmount(),
             true);
     } else {
         mMaxFlowCalculationNodeCacheManager->addCache(
             mCurrentContractor,
             make_shared<MaxFlowCalculationNodeCache>(
-                mCurrentMaxFlow,
+                mCurrentMaxFlow.toTrustLineAmount(),
                 true));
     }
 
-    return mCurrentMaxFlow;
+    return mCurrentMaxFlow.toTrustLineAmount();
 }
 
 // this method used the same logic as PathsManager::reBuildPathsOnOneLevel
@@ -156,22 +156,21 @@ TrustLineAmount MaxFlowCalculationFullyTransaction::calculateMaxFlow(
 void MaxFlowCalculationFullyTransaction::calculateMaxFlowOnOneLevel()
 {
     while(true) {
-        TrustLineAmount currentFlow = 0;
+        FixedTrustLineAmount currentFlow = 0;
         for (auto &trustLinePtr : mFirstLevelTopology) {
             auto trustLine = trustLinePtr->maxFlowCalculationtrustLine();
-            auto trustLineFreeAmountShared = trustLine->freeAmount();
-            auto trustLineAmountPtr = trustLineFreeAmountShared.get();
+            const auto kFreeAmount = trustLine->freeFixedAmount();
             mForbiddenNodeUUIDs.clear();
-            TrustLineAmount flow = calculateOneNode(
+            FixedTrustLineAmount flow = calculateOneNode(
                 trustLine->targetUUID(),
-                *trustLineAmountPtr,
+                kFreeAmount,
                 1);
-            if (flow > TrustLine::kZeroAmount()) {
+            if (not flow.isZero()) {
                 currentFlow += flow;
                 trustLine->addUsedAmount(flow);
             }
         }
-        if (currentFlow == 0) {
+        if (currentFlow.isZero()) {
             break;
         }
     }
@@ -180,13 +179,13 @@ void MaxFlowCalculationFullyTransaction::calculateMaxFlowOnOneLevel()
 // it used the same logic as PathsManager::calculateOneNodeForRebuildingPaths
 // and PathsManager::calculateOneNode
 // if you change this method, you should change others
-TrustLineAmount MaxFlowCalculationFullyTransaction::calculateOneNode(
+FixedTrustLineAmount MaxFlowCalculationFullyTransaction::calculateOneNode(
     const NodeUUID& nodeUUID,
-    const TrustLineAmount& currentFlow,
+    const FixedTrustLineAmount& currentFlow,
     byte level)
 {
     if (nodeUUID == mCurrentContractor) {
-        if (currentFlow > TrustLine::kZeroAmount()) {
+        if (not currentFlow.isZero()) {
             mCurrentMaxFlow += currentFlow;
         }
         return currentFlow;
@@ -211,22 +210,21 @@ TrustLineAmount MaxFlowCalculationFullyTransaction::calculateOneNode(
             trustLine->targetUUID()) != mForbiddenNodeUUIDs.end()) {
             continue;
         }
-        TrustLineAmount nextFlow = currentFlow;
-        auto trustLineFreeAmountShared = trustLine.get()->freeAmount();
-        auto trustLineFreeAmountPtr = trustLineFreeAmountShared.get();
-        if (*trustLineFreeAmountPtr < currentFlow) {
-            nextFlow = *trustLineFreeAmountPtr;
+        FixedTrustLineAmount nextFlow = currentFlow;
+        const auto kFreeAmount = trustLine->freeFixedAmount();
+        if (kFreeAmount < currentFlow) {
+            nextFlow = kFreeAmount;
         }
-        if (nextFlow == TrustLine::kZeroAmount()) {
+        if (nextFlow.isZero()) {
             continue;
         }
         mForbiddenNodeUUIDs.push_back(nodeUUID);
-        TrustLineAmount calcFlow = calculateOneNode(
+        FixedTrustLineAmount calcFlow = calculateOneNode(
             trustLine->targetUUID(),
             nextFlow,
             level + (byte)1);
         mForbiddenNodeUUIDs.pop_back();
-        if (calcFlow > TrustLine::kZeroAmount()) {
+        if (not calcFlow.isZero()) {
             trustLine->addUsedAmount(calcFlow);
             return calcFlow;
         }
@@ -234,7 +232,7 @@ TrustLineAmount MaxFlowCalculationFullyTransaction::calculateOneNode(
     return 0;
 }
 
-TransactionResult::SharedConst MaxFlowCalculationFullyTransaction::resultOk(
+TransactionResult MaxFlowCalculationFullyTransaction::resultOk(
     vector<pair<NodeUUID, TrustLineAmount>> &maxFlows)
 {
     stringstream ss;
@@ -249,7 +247,7 @@ TransactionResult::SharedConst MaxFlowCalculationFullyTransaction::resultOk(
             kMaxFlowAmountsStr));
 }
 
-TransactionResult::SharedConst MaxFlowCalculationFullyTransaction::resultProtocolError()
+TransactionResult MaxFlowCalculationFullyTransaction::resultProtocolError()
 {
     return transactionResultFromCommand(
         mCommand->responseProtocolError());
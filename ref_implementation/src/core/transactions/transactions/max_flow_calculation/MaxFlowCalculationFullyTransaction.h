@@ -43,24 +43,24 @@ protected:
     const string logHeader() const;
 
 private:
-    TransactionResult::SharedConst sendRequestForCollectingTopology();
+    TransactionResult sendRequestForCollectingTopology();
 
-    TransactionResult::SharedConst processCollectingTopology();
+    TransactionResult processCollectingTopology();
 
     TrustLineAmount calculateMaxFlow(
         const NodeUUID &contractorUUID);
 
     void calculateMaxFlowOnOneLevel();
 
-    TrustLineAmount calculateOneNode(
+    FixedTrustLineAmount calculateOneNode(
         const NodeUUID& nodeUUID,
-        const TrustLineAmount& currentFlow,
+        const FixedTrustLineAmount& currentFlow,
         byte level);
 
-    TransactionResult::SharedConst resultOk(
+    TransactionResult resultOk(
         vector<pair<NodeUUID, TrustLineAmount>> &maxFlows);
 
-    TransactionResult::SharedConst resultProtocolError();
+    TransactionResult resultProtocolError();
 
 private:
     static const byte kMaxPathLength = 6;
@@ -75,7 +75,7 @@ private:
     InitiateMaxFlowCalculationFullyCommand::Shared mCommand;
     vector<NodeUUID> mForbiddenNodeUUIDs;
     byte mCurrentPathLength;
-    TrustLineAmount mCurrentMaxFlow;
+    FixedTrustLineAmount mCurrentMaxFlow;
     NodeUUID mCurrentContractor;
     size_t mCountProcessCollectingTopologyRun;
     MaxFlowCalculationTrustLineManager::TrustLineWithPtrHashSet mFirstLevelTopology;
@@ -30,7 +30,7 @@ MaxFlowCalculationSourceFstLevelMessage::Shared MaxFlowCalculationSourceFstLevel
     return mMessage;
 }
 
-TransactionResult::SharedConst MaxFlowCalculationSourceFstLevelTransaction::run()
+TransactionResult MaxFlowCalculationSourceFstLevelTransaction::run()
 {
 #ifdef DEBUG_LOG_MAX_FLOW_CALCULATION
     info() << "run\t" << "Iam: " << mNodeUUID;
@@ -41,8 +41,8 @@ TransactionResult::SharedConst MaxFlowCalculationSourceFstLevelTransaction::run(
 #endif
     vector<NodeUUID> outgoingFlowUuids;
     if (mIAmGateway) {
-        vector<pair<NodeUUID, ConstSharedTrustLineAmount>> outgoingFlows;
-        vector<pair<NodeUUID, ConstSharedTrustLineAmount>> incomingFlows;
+        vector<pair<NodeUUID, TrustLineAmount>> outgoingFlows;
+        vector<pair<NodeUUID, TrustLineAmount>> incomingFlows;
         // inform that I am is gateway
         sendMessage<ResultMaxFlowCalculationGatewayMessage>(
             mMessage->senderUUID,
@@ -31,7 +31,7 @@ public:
 
     MaxFlowCalculationSourceFstLevelMessage::Shared message() const;
 
-    TransactionResult::SharedConst run();
+    TransactionResult run();
 
 protected:
     const string logHeader() const;
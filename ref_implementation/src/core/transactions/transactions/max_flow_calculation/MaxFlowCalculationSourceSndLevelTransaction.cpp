@@ -32,7 +32,7 @@ MaxFlowCalculationSourceSndLevelMessage::Shared MaxFlowCalculationSourceSndLevel
     return mMessage;
 }
 
-TransactionResult::SharedConst MaxFlowCalculationSourceSndLevelTransaction::run()
+TransactionResult MaxFlowCalculationSourceSndLevelTransaction::run()
 {
 #ifdef DEBUG_LOG_MAX_FLOW_CALCULATION
     info() << "run\t" << "Iam: " << mNodeUUID;
@@ -59,18 +59,18 @@ void MaxFlowCalculationSourceSndLevelTransaction::sendResultToInitiator()
 #ifdef DEBUG_LOG_MAX_FLOW_CALCULATION
     info() << "sendResultToInitiator\t" << "send to " << mMessage->targetUUID();
 #endif
-    vector<pair<NodeUUID, ConstSharedTrustLineAmount>> outgoingFlows;
+    vector<pair<NodeUUID, TrustLineAmount>> outgoingFlows;
     for (auto const &outgoingFlow : mTrustLinesManager->outgoingFlows()) {
-        if (*outgoingFlow.second.get() > TrustLine::kZeroAmount()
+        if (outgoingFlow.second > TrustLine::kZeroAmount()
             && outgoingFlow.first != mMessage->senderUUID
             && outgoingFlow.first != mMessage->targetUUID()) {
             outgoingFlows.push_back(
                 outgoingFlow);
         }
     }
-    vector<pair<NodeUUID, ConstSharedTrustLineAmount>> incomingFlows;
+    vector<pair<NodeUUID, TrustLineAmount>> incomingFlows;
     const auto incomingFlow = mTrustLinesManager->incomingFlow(mMessage->senderUUID);
-    if (*incomingFlow.second.get() > TrustLine::kZeroAmount()) {
+    if (incomingFlow.second > TrustLine::kZeroAmount()) {
         incomingFlows.push_back(
             incomingFlow);
     }
@@ -98,7 +98,7 @@ void MaxFlowCalculationSourceSndLevelTransaction::sendCachedResultToInitiator(
 #ifdef DEBUG_LOG_MAX_FLOW_CALCULATION
     info() << "sendCachedResultToInitiator\t" << "send to " << mMessage->targetUUID();
 #endif
-    vector<pair<NodeUUID, ConstSharedTrustLineAmount>> outgoingFlowsForSending;
+    vector<pair<NodeUUID, TrustLineAmount>> outgoingFlowsForSending;
     for (auto const &outgoingFlow : mTrustLinesManager->outgoingFlows()) {
         if (outgoingFlow.first != mMessage->senderUUID
             && outgoingFlow.first != mMessage->targetUUID()
@@ -107,7 +107,7 @@ void MaxFlowCalculationSourceSndLevelTransaction::sendCachedResultToInitiator(
                 outgoingFlow);
         }
     }
-    vector<pair<NodeUUID, ConstSharedTrustLineAmount>> incomingFlowsForSending;
+    vector<pair<NodeUUID, TrustLineAmount>> incomingFlowsForSending;
     auto const incomingFlow = mTrustLinesManager->incomingFlow(mMessage->senderUUID);
     if (!maxFlowCalculationCachePtr->containsIncomingFlow(incomingFlow.first, incomingFlow.second)) {
         incomingFlowsForSending.push_back(
@@ -137,9 +137,9 @@ void MaxFlowCalculationSourceSndLevelTransaction::sendGatewayResultToInitiator()
 #ifdef DEBUG_LOG_MAX_FLOW_CALCULATION
     info() << "sendGatewayResultToInitiator\t" << "send to " << mMessage->targetUUID();
 #endif
-    vector<pair<NodeUUID, ConstSharedTrustLineAmount>> outgoingFlows;
+    vector<pair<NodeUUID, TrustLineAmount>> outgoingFlows;
     for (auto const &outgoingFlow : mTrustLinesManager->outgoingFlowsToGateways()) {
-        if (*outgoingFlow.second.get() > TrustLine::kZeroAmount()
+        if (outgoingFlow.second > TrustLine::kZeroAmount()
             && outgoingFlow.first != mMessage->senderUUID
             && outgoingFlow.first != mMessage->targetUUID()) {
             outgoingFlows.push_back(
@@ -147,9 +147,9 @@ void MaxFlowCalculationSourceSndLevelTransaction::sendGatewayResultToInitiator()
         }
     }
 
-    vector<pair<NodeUUID, ConstSharedTrustLineAmount>> incomingFlows;
+    vector<pair<NodeUUID, TrustLineAmount>> incomingFlows;
     const auto incomingFlow = mTrustLinesManager->incomingFlow(mMessage->senderUUID);
-    if (*incomingFlow.second.get() > TrustLine::kZeroAmount()) {
+    if (incomingFlow.second > TrustLine::kZeroAmount()) {
         incomingFlows.push_back(
             incomingFlow);
     }
@@ -177,7 +177,7 @@ void MaxFlowCalculationSourceSndLevelTransaction::sendCachedGatewayResultToIniti
 #ifdef DEBUG_LOG_MAX_FLOW_CALCULATION
     info() << "sendCachedGatewayResultToInitiator\t" << "send to " << mMessage->targetUUID();
 #endif
-    vector<pair<NodeUUID, ConstSharedTrustLineAmount>> outgoingFlowsForSending;
+    vector<pair<NodeUUID, TrustLineAmount>> outgoingFlowsForSending;
     for (auto const &outgoingFlow : mTrustLinesManager->outgoingFlowsToGateways()) {
         if (outgoingFlow.first != mMessage->senderUUID
             && outgoingFlow.first != mMessage->targetUUID()
@@ -187,7 +187,7 @@ void MaxFlowCalculationSourceSndLevelTransaction::sendCachedGatewayResultToIniti
         }
     }
 
-    vector<pair<NodeUUID, ConstSharedTrustLineAmount>> incomingFlowsForSending;
+    vector<pair<NodeUUID, TrustLineAmount>> incomingFlowsForSending;
     auto const incomingFlow = mTrustLinesManager->incomingFlow(mMessage->senderUUID);
     if (!maxFlowCalculationCachePtr->containsIncomingFlow(incomingFlow.first, incomingFlow.second)) {
         incomingFlowsForSending.push_back(
@@ -38,7 +38,7 @@ InitiateMaxFlowCalculationCommand::Shared MaxFlowCalculationStepTwoTransaction::
     return mCommand;
 }
 
-TransactionResult::SharedConst MaxFlowCalculationStepTwoTransaction::sendRequestForCollectingTopology()
+TransactionResult MaxFlowCalculationStepTwoTransaction::sendRequestForCollectingTopology()
 {
 #ifdef DEBUG_LOG_MAX_FLOW_CALCULATION
     info() << "run\t" << "initiator: " << mNodeUUID;
@@ -51,7 +51,7 @@ TransactionResult::SharedConst MaxFlowCalculationStepTwoTransaction::sendRequest
         kWaitMillisecondsForCalculatingMaxFlow);
 }
 
-TransactionResult::SharedConst MaxFlowCalculationStepTwoTransaction::processCollectingTopology()
+TransactionResult MaxFlowCalculationStepTwoTransaction::processCollectingTopology()
 {
 #ifdef DEBUG_LOG_MAX_FLOW_CALCULATION
     info() << "CalculateMaxTransactionFlow";
@@ -132,7 +132,7 @@ TrustLineAmount MaxFlowCalculationStepTwoTransaction::calculateMaxFlow(
         return TrustLine::kZeroAmount();
     }
 
-    mCurrentMaxFlow = TrustLine::kZeroAmount();
+    mCurrentMaxFlow = 0;
     for (mCurrentPathLength = 1; mCurrentPathLength <= kMaxPathLength; mCurrentPathLength++) {
         calculateMaxFlowOnOneLevel();
     }
@@ -141,9 +141,9 @@ TrustLineAmount MaxFlowCalculationStepTwoTransaction::calculateMaxFlow(
     info() << "max flow calculating time: " << utc_now() - startTime;
     mMaxFlowCalculationNodeCacheManager->updateCache(
         mCurrentContractor,
-        mCurrentMaxFlow,
+        mCurrentMaxFlow.toTrustLineAmount(),
         true);
-    return mCurrentMaxFlow;
+    return mCurrentMaxFlow.toTrustLineAmount();
 }
 
 // this method used the same logic as PathsManager::reBuildPathsOnOneLevel
@@ -151,22 +151,21 @@ TrustLineAmount MaxFlowCalculationStepTwoTransaction::calculateMaxFlow(
 void MaxFlowCalculationStepTwoTransaction::calculateMaxFlowOnOneLevel()
 {
     while(true) {
-        TrustLineAmount currentFlow = 0;
+        FixedTrustLineAmount currentFlow = 0;
         for (auto &trustLinePtr : mFirstLevelTopology) {
             auto trustLine = trustLinePtr->maxFlowCalculationtrustLine();
-            auto trustLineFreeAmountShared = trustLine->freeAmount();
-            auto trustLineAmountPtr = trustLineFreeAmountShared.get();
+            const auto kFreeAmount = trustLine->freeFixedAmount();
             mForbiddenNodeUUIDs.clear();
-            TrustLineAmount flow = calculateOneNode(
+            FixedTrustLineAmount flow = calculateOneNode(
                 trustLine->targetUUID(),
-                *trustLineAmountPtr,
+                kFreeAmount,
                 1);
-            if (flow > TrustLine::kZeroAmount()) {
+            if (not flow.isZero()) {
                 currentFlow += flow;
                 trustLine->addUsedAmount(flow);
             }
         }
-        if (currentFlow == 0) {
+        if (currentFlow.isZero()) {
             break;
         }
     }
@@ -175,13 +174,13 @@ void MaxFlowCalculationStepTwoTransaction::calculateMaxFlowOnOneLevel()
 // it used the same logic as PathsManager::calculateOneNodeForRebuildingPaths
 // and PathsManager::calculateOneNode
 // if you change this method, you should change others
-TrustLineAmount MaxFlowCalculationStepTwoTransaction::calculateOneNode(
+FixedTrustLineAmount MaxFlowCalculationStepTwoTransaction::calculateOneNode(
     const NodeUUID& nodeUUID,
-    const TrustLineAmount& currentFlow,
+    const FixedTrustLineAmount& currentFlow,
     byte level)
 {
     if (nodeUUID == mCurrentContractor) {
-        if (currentFlow > TrustLine::kZeroAmount()) {
+        if (not currentFlow.isZero()) {
             mCurrentMaxFlow += currentFlow;
         }
         return currentFlow;
@@ -206,22 +205,21 @@ TrustLineAmount MaxFlowCalculationStepTwoTransaction::calculateOneNode(
                 trustLine->targetUUID()) != mForbiddenNodeUUIDs.end()) {
             continue;
         }
-        TrustLineAmount nextFlow = currentFlow;
-        auto trustLineFreeAmountShared = trustLine.get()->freeAmount();
-        auto trustLineFreeAmountPtr = trustLineFreeAmountShared.get();
-        if (*trustLineFreeAmountPtr < currentFlow) {
-            nextFlow = *trustLineFreeAmountPtr;
+        FixedTrustLineAmount nextFlow = currentFlow;
+        const auto kFreeAmount = trustLine->freeFixedAmount();
+        if (kFreeAmount < currentFlow) {
+            nextFlow = kFreeAmount;
         }
-        if (nextFlow == TrustLine::kZeroAmount()) {
+        if (nextFlow.isZero()) {
             continue;
         }
         mForbiddenNodeUUIDs.push_back(nodeUUID);
-        TrustLineAmount calcFlow = calculateOneNode(
+        FixedTrustLineAmount calcFlow = calculateOneNode(
             trustLine->targetUUID(),
             nextFlow,
             level + (byte)1);
         mForbiddenNodeUUIDs.pop_back();
-        if (calcFlow > TrustLine::kZeroAmount()) {
+        if (not calcFlow.isZero()) {
             trustLine->addUsedAmount(calcFlow);
             return calcFlow;
         }
@@ -229,7 +227,7 @@ TrustLineAmount MaxFlowCalculationStepTwoTransaction::calculateOneNode(
     return 0;
 }
 
-TransactionResult::SharedConst MaxFlowCalculationStepTwoTransaction::resultOk(
+TransactionResult MaxFlowCalculationStepTwoTransaction::resultOk(
     bool finalMaxFlows,
     vector<pair<NodeUUID, TrustLineAmount>> &maxFlows)
 {
@@ -42,21 +42,21 @@ protected:
     const string logHeader() const;
 
 private:
-    TransactionResult::SharedConst sendRequestForCollectingTopology();
+    TransactionResult sendRequestForCollectingTopology();
 
-    TransactionResult::SharedConst processCollectingTopology();
+    TransactionResult processCollectingTopology();
 
     TrustLineAmount calculateMaxFlow(
         const NodeUUID &contractorUUID);
 
     void calculateMaxFlowOnOneLevel();
 
-    TrustLineAmount calculateOneNode(
+    FixedTrustLineAmount calculateOneNode(
         const NodeUUID& nodeUUID,
-        const TrustLineAmount& currentFlow,
+        const FixedTrustLineAmount& currentFlow,
         byte level);
 
-    TransactionResult::SharedConst resultOk(
+    TransactionResult resultOk(
         bool finalMaxFlows,
         vector<pair<NodeUUID, TrustLineAmount>> &maxFlows);
 
@@ -73,7 +73,7 @@ private:
     InitiateMaxFlowCalculationCommand::Shared mCommand;
     vector<NodeUUID> mForbiddenNodeUUIDs;
     byte mCurrentPathLength;
-    TrustLineAmount mCurrentMaxFlow;
+    FixedTrustLineAmount mCurrentMaxFlow;
     NodeUUID mCurrentContractor;
     size_t mCountProcessCollectingTopologyRun;
     MaxFlowCalculationTrustLineManager::TrustLineWithPtrHashSet mFirstLevelTopology;
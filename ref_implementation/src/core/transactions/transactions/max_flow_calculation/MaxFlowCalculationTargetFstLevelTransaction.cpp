@@ -30,7 +30,7 @@ MaxFlowCalculationTargetFstLevelMessage::Shared MaxFlowCalculationTargetFstLevel
     return mMessage;
 }
 
-TransactionResult::SharedConst MaxFlowCalculationTargetFstLevelTransaction::run()
+TransactionResult MaxFlowCalculationTargetFstLevelTransaction::run()
 {
 #ifdef DEBUG_LOG_MAX_FLOW_CALCULATION
     info() << "run\t" << "Iam: " << mNodeUUID;
@@ -42,8 +42,8 @@ TransactionResult::SharedConst MaxFlowCalculationTargetFstLevelTransaction::run(
 #endif
     vector<NodeUUID> incomingFlowUuids;
     if (mIAmGateway) {
-        vector<pair<NodeUUID, ConstSharedTrustLineAmount>> outgoingFlows;
-        vector<pair<NodeUUID, ConstSharedTrustLineAmount>> incomingFlows;
+        vector<pair<NodeUUID, TrustLineAmount>> outgoingFlows;
+        vector<pair<NodeUUID, TrustLineAmount>> incomingFlows;
         // inform that I am is gateway
         sendMessage<ResultMaxFlowCalculationGatewayMessage>(
             mMessage->targetUUID(),
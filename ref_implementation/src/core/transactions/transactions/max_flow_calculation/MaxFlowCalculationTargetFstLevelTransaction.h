@@ -31,7 +31,7 @@ public:
 
     MaxFlowCalculationTargetFstLevelMessage::Shared message() const;
 
-    TransactionResult::SharedConst run();
+    TransactionResult run();
 
 protected:
     const string logHeader() const;
@@ -32,7 +32,7 @@ MaxFlowCalculationTargetSndLevelMessage::Shared MaxFlowCalculationTargetSndLevel
     return mMessage;
 }
 
-TransactionResult::SharedConst MaxFlowCalculationTargetSndLevelTransaction::run()
+TransactionResult MaxFlowCalculationTargetSndLevelTransaction::run()
 {
 #ifdef DEBUG_LOG_MAX_FLOW_CALCULATION
     info() << "run\t" << "Iam: " << mNodeUUID.stringUUID();
@@ -56,17 +56,17 @@ void MaxFlowCalculationTargetSndLevelTransaction::sendResultToInitiator()
         sendCachedResultToInitiator(maxFlowCalculationCachePtr);
         return;
     }
-    vector<pair<NodeUUID, ConstSharedTrustLineAmount>> outgoingFlows;
+    vector<pair<NodeUUID, TrustLineAmount>> outgoingFlows;
     auto const outgoingFlow = mTrustLinesManager->outgoingFlow(
         mMessage->senderUUID);
-    if (*outgoingFlow.second.get() > TrustLine::kZeroAmount()) {
+    if (outgoingFlow.second > TrustLine::kZeroAmount()) {
         outgoingFlows.push_back(
             outgoingFlow);
     }
 
-    vector<pair<NodeUUID, ConstSharedTrustLineAmount>> incomingFlows;
+    vector<pair<NodeUUID, TrustLineAmount>> incomingFlows;
     for (auto const &incomingFlow : mTrustLinesManager->incomingFlowsFromNonGateways()) {
-        if (*incomingFlow.second.get() > TrustLine::kZeroAmount()
+        if (incomingFlow.second > TrustLine::kZeroAmount()
             && incomingFlow.first != mMessage->senderUUID
             && incomingFlow.first != mMessage->targetUUID()) {
             incomingFlows.push_back(
@@ -98,7 +98,7 @@ void MaxFlowCalculationTargetSndLevelTransaction::sendCachedResultToInitiator(
 #ifdef DEBUG_LOG_MAX_FLOW_CALCULATION
     info() << "sendCachedResultToInitiator\t" << "send to " << mMessage->targetUUID();
 #endif
-    vector<pair<NodeUUID, ConstSharedTrustLineAmount>> outgoingFlowsForSending;
+    vector<pair<NodeUUID, TrustLineAmount>> outgoingFlowsForSending;
     auto const outgoingFlow = mTrustLinesManager->outgoingFlow(
         mMessage->senderUUID);
     if (!maxFlowCalculationCachePtr->containsOutgoingFlow(outgoingFlow.first, outgoingFlow.second)) {
@@ -106,7 +106,7 @@ void MaxFlowCalculationTargetSndLevelTransaction::sendCachedResultToInitiator(
             outgoingFlow);
     }
 
-    vector<pair<NodeUUID, ConstSharedTrustLineAmount>> incomingFlowsForSending;
+    vector<pair<NodeUUID, TrustLineAmount>> incomingFlowsForSending;
     for (auto const &incomingFlow : mTrustLinesManager->incomingFlowsFromNonGateways()) {
         if (incomingFlow.first != mMessage->senderUUID
             && incomingFlow.first != mMessage->targetUUID()
@@ -140,17 +140,17 @@ void MaxFlowCalculationTargetSndLevelTransaction::sendGatewayResultToInitiator()
         return;
     }
 
-    vector<pair<NodeUUID, ConstSharedTrustLineAmount>> outgoingFlows;
+    vector<pair<NodeUUID, TrustLineAmount>> outgoingFlows;
     auto const outgoingFlow = mTrustLinesManager->outgoingFlow(
         mMessage->senderUUID);
-    if (*outgoingFlow.second.get() > TrustLine::kZeroAmount()) {
+    if (outgoingFlow.second > TrustLine::kZeroAmount()) {
         outgoingFlows.push_back(
             outgoingFlow);
     }
 
-    vector<pair<NodeUUID, ConstSharedTrustLineAmount>> incomingFlows;
+    vector<pair<NodeUUID, TrustLineAmount>> incomingFlows;
     for (auto const &incomingFlow : mTrustLinesManager->incomingFlows()) {
-        if (*incomingFlow.second.get() > TrustLine::kZeroAmount()
+        if (incomingFlow.second > TrustLine::kZeroAmount()
             && incomingFlow.first != mMessage->senderUUID
             && incomingFlow.first != mMessage->targetUUID()) {
             incomingFlows.push_back(
@@ -182,7 +182,7 @@ void MaxFlowCalculationTargetSndLevelTransaction::sendCachedGatewayResultToIniti
 #ifdef DEBUG_LOG_MAX_FLOW_CALCULATION
     info() << "sendCachedGatewayResultToInitiator\t" << "send to " << mMessage->targetUUID();
 #endif
-    vector<pair<NodeUUID, ConstSharedTrustLineAmount>> outgoingFlowsForSending;
+    vector<pair<NodeUUID, TrustLineAmount>> outgoingFlowsForSending;
     auto const outgoingFlow = mTrustLinesManager->outgoingFlow(
         mMessage->senderUUID);
     if (!maxFlowCalculationCachePtr->containsOutgoingFlow(outgoingFlow.first, outgoingFlow.second)) {
@@ -190,7 +190,7 @@ void MaxFlowCalculationTargetSndLevelTransaction::sendCachedGatewayResultToIniti
             outgoingFlow);
     }
 
-    vector<pair<NodeUUID, ConstSharedTrustLineAmount>> incomingFlowsForSending;
+    vector<pair<NodeUUID, TrustLineAmount>> incomingFlowsForSending;
     for (auto const &incomingFlow : mTrustLinesManager->incomingFlows()) {
         if (incomingFlow.first != mMessage->senderUUID
             && incomingFlow.first != mMessage->targetUUID()
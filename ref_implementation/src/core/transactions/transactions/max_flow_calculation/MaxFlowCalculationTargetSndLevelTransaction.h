@@ -33,7 +33,7 @@ public:
 
     MaxFlowCalculationTargetSndLevelMessage::Shared message() const;
 
-    TransactionResult::SharedConst run();
+    TransactionResult run();
 
 protected:
     const string logHeader() const;
@@ -30,7 +30,7 @@ InitiateMaxFlowCalculationMessage::Shared ReceiveMaxFlowCalculationOnTargetTrans
     return mMessage;
 }
 
-TransactionResult::SharedConst ReceiveMaxFlowCalculationOnTargetTransaction::run()
+TransactionResult ReceiveMaxFlowCalculationOnTargetTransaction::run()
 {
 #ifdef DEBUG_LOG_MAX_FLOW_CALCULATION
     info() << "run\t" << "target: " << mNodeUUID;
@@ -51,10 +51,10 @@ void ReceiveMaxFlowCalculationOnTargetTransaction::sendResultToInitiator()
         sendCachedResultToInitiator(maxFlowCalculationCachePtr);
         return;
     }
-    vector<pair<NodeUUID, ConstSharedTrustLineAmount>> outgoingFlows;
-    vector<pair<NodeUUID, ConstSharedTrustLineAmount>> incomingFlows;
+    vector<pair<NodeUUID, TrustLineAmount>> outgoingFlows;
+    vector<pair<NodeUUID, TrustLineAmount>> incomingFlows;
     for (auto const &incomingFlow : mTrustLinesManager->incomingFlows()) {
-        if (*incomingFlow.second.get() > TrustLine::kZeroAmount() && incomingFlow.first != mMessage->senderUUID) {
+        if (incomingFlow.second > TrustLine::kZeroAmount() && incomingFlow.first != mMessage->senderUUID) {
             incomingFlows.push_back(
                 incomingFlow);
         }
@@ -83,8 +83,8 @@ void ReceiveMaxFlowCalculationOnTargetTransaction::sendCachedResultToInitiator(
 #ifdef DEBUG_LOG_MAX_FLOW_CALCULATION
     info() << "sendCachedResultToInitiator\t" << "send to " << mMessage->senderUUID;
 #endif
-    vector<pair<NodeUUID, ConstSharedTrustLineAmount>> outgoingFlowsForSending;
-    vector<pair<NodeUUID, ConstSharedTrustLineAmount>> incomingFlowsForSending;
+    vector<pair<NodeUUID, TrustLineAmount>> outgoingFlowsForSending;
+    vector<pair<NodeUUID, TrustLineAmount>> incomingFlowsForSending;
     for (auto const &incomingFlow : mTrustLinesManager->incomingFlows()) {
         if (incomingFlow.first != mMessage->senderUUID
             && !maxFlowCalculationCachePtr->containsIncomingFlow(incomingFlow.first, incomingFlow.second)) {
@@ -32,7 +32,7 @@ public:
 
     InitiateMaxFlowCalculationMessage::Shared message() const;
 
-    TransactionResult::SharedConst run();
+    TransactionResult run();
 
 protected:
     const string logHeader() const;
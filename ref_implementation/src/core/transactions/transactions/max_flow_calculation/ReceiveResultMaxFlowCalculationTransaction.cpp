@@ -48,7 +48,7 @@ ResultMaxFlowCalculationMessage::Shared ReceiveResultMaxFlowCalculationTransacti
     return mMessage;
 }
 
-TransactionResult::SharedConst ReceiveResultMaxFlowCalculationTransaction::run()
+TransactionResult ReceiveResultMaxFlowCalculationTransaction::run()
 {
 #ifdef DEBUG_LOG_MAX_FLOW_CALCULATION
     info() << "initiator: " << mNodeUUID;
@@ -65,7 +65,7 @@ TransactionResult::SharedConst ReceiveResultMaxFlowCalculationTransaction::run()
 
     for (auto const &outgoingFlow : mMessage->outgoingFlows()) {
 #ifdef DEBUG_LOG_MAX_FLOW_CALCULATION
-        info() << "\t" << outgoingFlow.first << " " << *outgoingFlow.second.get();
+        info() << "\t" << outgoingFlow.first << " " << outgoingFlow.second;
 #endif
         mMaxFlowCalculationTrustLineManager->addTrustLine(
             make_shared<MaxFlowCalculationTrustLine>(
@@ -78,7 +78,7 @@ TransactionResult::SharedConst ReceiveResultMaxFlowCalculationTransaction::run()
 #endif
     for (auto const &incomingFlow : mMessage->incomingFlows()) {
 #ifdef DEBUG_LOG_MAX_FLOW_CALCULATION
-        info() << "\t" << incomingFlow.first << " " << *incomingFlow.second.get();
+        info() << "\t" << incomingFlow.first << " " << incomingFlow.second;
 #endif
         mMaxFlowCalculationTrustLineManager->addTrustLine(
             make_shared<MaxFlowCalculationTrustLine>(
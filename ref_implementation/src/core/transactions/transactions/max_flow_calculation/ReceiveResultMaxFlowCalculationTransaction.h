@@ -39,7 +39,7 @@ public:
 
     ResultMaxFlowCalculationMessage::Shared message() const;
 
-    TransactionResult::SharedConst run();
+    TransactionResult run();
 
 protected:
     const string logHeader() const;
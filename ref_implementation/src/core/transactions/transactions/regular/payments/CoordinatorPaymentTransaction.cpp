@@ -70,7 +70,7 @@ CoordinatorPaymentTransaction::CoordinatorPaymentTransaction(
 {}
 
 
-TransactionResult::SharedConst CoordinatorPaymentTransaction::run()
+TransactionResult CoordinatorPaymentTransaction::run()
     noexcept
 {
     while (true) {
@@ -126,7 +126,7 @@ TransactionResult::SharedConst CoordinatorPaymentTransaction::run()
 }
 
 
-TransactionResult::SharedConst CoordinatorPaymentTransaction::runPaymentInitialisationStage ()
+TransactionResult CoordinatorPaymentTransaction::runPaymentInitialisationStage ()
 {
     if (!mSubsystemsController->isRunPaymentTransactions()) {
         debug() << "It is forbidden run payment transactions";
@@ -144,7 +144,7 @@ TransactionResult::SharedConst CoordinatorPaymentTransaction::runPaymentInitiali
     // Check if total outgoing possibilities of this node are not smaller,
     // than total operation amount. In case if so - there is no reason to begin the operation:
     // current node would not be able to pay such an amount.
-    const auto kTotalOutgoingPossibilities = *(mTrustLines->totalOutgoingAmount());
+    const auto kTotalOutgoingPossibilities = mTrustLines->totalOutgoingAmount();
     if (kTotalOutgoingPossibilities < mCommand->amount())
         return resultInsufficientFundsError();
 
@@ -162,7 +162,7 @@ TransactionResult::SharedConst CoordinatorPaymentTransaction::runPaymentInitiali
         maxNetworkDelay(4));
 }
 
-TransactionResult::SharedConst CoordinatorPaymentTransaction::runPathsResourceProcessingStage()
+TransactionResult CoordinatorPaymentTransaction::runPathsResourceProcessingStage()
 {
     debug() << "runPathsResourceProcessingStage";
     if (!mResources.empty()) {
@@ -211,7 +211,7 @@ TransactionResult::SharedConst CoordinatorPaymentTransaction::runPathsResourcePr
         kMaxMessageTransferLagMSec);
 }
 
-TransactionResult::SharedConst CoordinatorPaymentTransaction::runReceiverResponseProcessingStage ()
+TransactionResult CoordinatorPaymentTransaction::runReceiverResponseProcessingStage ()
 {
     if (! contextIsValid(Message::Payments_ReceiverInitPaymentResponse)) {
         warning() << "Receiver reservation response wasn't received. Canceling.";
@@ -229,7 +229,7 @@ TransactionResult::SharedConst CoordinatorPaymentTransaction::runReceiverRespons
     return runAmountReservationStage();
 }
 
-TransactionResult::SharedConst CoordinatorPaymentTransaction::runAmountReservationStage ()
+TransactionResult CoordinatorPaymentTransaction::runAmountReservationStage ()
 {
     debug() << "runAmountReservationStage";
     switch (mReservationsStage) {
@@ -291,7 +291,7 @@ TransactionResult::SharedConst CoordinatorPaymentTransaction::runAmountReservati
  * @param shouldSetUpDelay flag which tell us if need check on delay before sending,
  * has true value only on processRemoteNodeResponse stage
  */
-TransactionResult::SharedConst CoordinatorPaymentTransaction::propagateVotesListAndWaitForVotingResult()
+TransactionResult CoordinatorPaymentTransaction::propagateVotesListAndWaitForVotingResult()
 {
     debug() << "propagateVotesListAndWaitForVotingResult";
     const auto kCurrentNodeUUID = currentNodeUUID();
@@ -366,7 +366,7 @@ void CoordinatorPaymentTransaction::initAmountsReservationOnNextPath()
 /*
  * Tries to reserve amount on path that consists only of sender and receiver nodes.
  */
-TransactionResult::SharedConst CoordinatorPaymentTransaction::tryReserveAmountDirectlyOnReceiver (
+TransactionResult CoordinatorPaymentTransaction::tryReserveAmountDirectlyOnReceiver (
     const PathID pathID,
     PathStats *pathStats)
 {
@@ -401,7 +401,7 @@ TransactionResult::SharedConst CoordinatorPaymentTransaction::tryReserveAmountDi
     // Check if local reservation is possible.
     // If not - there is no reason to send any reservations requests.
     const auto kAvailableOutgoingAmount = mTrustLines->outgoingTrustAmountConsideringReservations(kContractor);
-    if (*kAvailableOutgoingAmount == TrustLineAmount(0)) {
+    if (kAvailableOutgoingAmount == TrustLineAmount(0)) {
         debug() << "There is no direct outgoing amount available for the receiver node. "
                << "Switching to another path.";
 
@@ -413,7 +413,7 @@ TransactionResult::SharedConst CoordinatorPaymentTransaction::tryReserveAmountDi
     const auto kRemainingAmountForProcessing =
             mCommand->amount() - totalReservedAmount(AmountReservation::Outgoing);
     // Reserving amount locally.
-    const auto kReservationAmount = min(kRemainingAmountForProcessing, *kAvailableOutgoingAmount);
+    const auto kReservationAmount = min(kRemainingAmountForProcessing, kAvailableOutgoingAmount);
     if (not reserveOutgoingAmount(
         kContractor,
         kReservationAmount,
@@ -462,7 +462,7 @@ TransactionResult::SharedConst CoordinatorPaymentTransaction::tryReserveAmountDi
 }
 
 
-TransactionResult::SharedConst CoordinatorPaymentTransaction::tryReserveNextIntermediateNodeAmount (
+TransactionResult CoordinatorPaymentTransaction::tryReserveNextIntermediateNodeAmount (
     PathStats *pathStats)
 {
     debug() << "tryReserveNextIntermediateNodeAmount";
@@ -531,7 +531,7 @@ void CoordinatorPaymentTransaction::addPathForFurtherProcessing(
     }
 }
 
-TransactionResult::SharedConst CoordinatorPaymentTransaction::askNeighborToReserveAmount(
+TransactionResult CoordinatorPaymentTransaction::askNeighborToReserveAmount(
     const NodeUUID &neighbor,
     PathStats *path)
 {
@@ -558,10 +558,10 @@ TransactionResult::SharedConst CoordinatorPaymentTransaction::askNeighborToReser
     const auto kRemainingAmountForProcessing =
             mCommand->amount() - totalReservedAmount(AmountReservation::Outgoing);
 
-    const auto kReservationAmount = min(*kAvailableOutgoingAmount, kRemainingAmountForProcessing);
+    const auto kReservationAmount = min(kAvailableOutgoingAmount, kRemainingAmountForProcessing);
 
     if (kReservationAmount == 0) {
-        debug() << "AvailableOutgoingAmount " << *kAvailableOutgoingAmount;
+        debug() << "AvailableOutgoingAmount " << kAvailableOutgoingAmount;
         debug() << "RemainingAmountForProcessing " << kRemainingAmountForProcessing;
         debug() << "No payment amount is available for (" << neighbor << "). "
                   "Switching to another path.";
@@ -625,7 +625,7 @@ TransactionResult::SharedConst CoordinatorPaymentTransaction::askNeighborToReser
         maxNetworkDelay(2));
 }
 
-TransactionResult::SharedConst CoordinatorPaymentTransaction::askNeighborToApproveFurtherNodeReservation(
+TransactionResult CoordinatorPaymentTransaction::askNeighborToApproveFurtherNodeReservation(
     const NodeUUID& neighbor,
     PathStats *path)
 {
@@ -684,7 +684,7 @@ TransactionResult::SharedConst CoordinatorPaymentTransaction::askNeighborToAppro
         maxNetworkDelay(4));
 }
 
-TransactionResult::SharedConst CoordinatorPaymentTransaction::processNeighborAmountReservationResponse()
+TransactionResult CoordinatorPaymentTransaction::processNeighborAmountReservationResponse()
 {
     debug() << "processNeighborAmountReservationResponse";
     if (! contextIsValid(Message::Payments_IntermediateNodeReservationResponse)) {
@@ -752,7 +752,7 @@ TransactionResult::SharedConst CoordinatorPaymentTransaction::processNeighborAmo
     return runAmountReservationStage();
 }
 
-TransactionResult::SharedConst CoordinatorPaymentTransaction::processNeighborFurtherReservationResponse()
+TransactionResult CoordinatorPaymentTransaction::processNeighborFurtherReservationResponse()
 {
     debug() << "processNeighborFurtherReservationResponse";
     if (! contextIsValid(Message::Payments_CoordinatorReservationResponse)) {
@@ -900,7 +900,7 @@ TransactionResult::SharedConst CoordinatorPaymentTransaction::processNeighborFur
     return runAmountReservationStage();
 }
 
-TransactionResult::SharedConst CoordinatorPaymentTransaction::askRemoteNodeToApproveReservation(
+TransactionResult CoordinatorPaymentTransaction::askRemoteNodeToApproveReservation(
     PathStats* path,
     const NodeUUID& remoteNode,
     const byte remoteNodePosition,
@@ -954,7 +954,7 @@ TransactionResult::SharedConst CoordinatorPaymentTransaction::askRemoteNodeToApp
         maxNetworkDelay(4));
 }
 
-TransactionResult::SharedConst CoordinatorPaymentTransaction::processRemoteNodeResponse()
+TransactionResult CoordinatorPaymentTransaction::processRemoteNodeResponse()
 {
     debug() << "processRemoteNodeResponse";
     if (! contextIsValid(Message::Payments_CoordinatorReservationResponse)){
@@ -1118,7 +1118,7 @@ TransactionResult::SharedConst CoordinatorPaymentTransaction::processRemoteNodeR
     return tryReserveNextIntermediateNodeAmount(path);
 }
 
-TransactionResult::SharedConst CoordinatorPaymentTransaction::tryProcessNextPath()
+TransactionResult CoordinatorPaymentTransaction::tryProcessNextPath()
 {
     debug() << "tryProcessNextPath";
     try {
@@ -1150,7 +1150,7 @@ TransactionResult::SharedConst CoordinatorPaymentTransaction::tryProcessNextPath
     }
 }
 
-TransactionResult::SharedConst CoordinatorPaymentTransaction::sendFinalAmountsConfigurationToAllParticipants()
+TransactionResult CoordinatorPaymentTransaction::sendFinalAmountsConfigurationToAllParticipants()
 {
     debug() << "sendFinalAmountsConfigurationToAllParticipants";
 
@@ -1202,7 +1202,7 @@ TransactionResult::SharedConst CoordinatorPaymentTransaction::sendFinalAmountsCo
         maxNetworkDelay(4));
 }
 
-TransactionResult::SharedConst CoordinatorPaymentTransaction::runFinalAmountsConfigurationConfirmation()
+TransactionResult CoordinatorPaymentTransaction::runFinalAmountsConfigurationConfirmation()
 {
     debug() << "runFinalAmountsConfigurationConfirmation";
     if (contextIsValid(Message::MessageType::Payments_TTLProlongationRequest, false)) {
@@ -1220,7 +1220,7 @@ TransactionResult::SharedConst CoordinatorPaymentTransaction::runFinalAmountsCon
     return reject("Some nodes didn't confirm final amount configuration. Transaction rejected.");
 }
 
-TransactionResult::SharedConst CoordinatorPaymentTransaction::runFinalAmountsParticipantConfirmation()
+TransactionResult CoordinatorPaymentTransaction::runFinalAmountsParticipantConfirmation()
 {
     debug() << "runFinalAmountsParticipantConfirmation";
     auto kMessage = popNextMessage<FinalAmountsConfigurationResponseMessage>();
@@ -1263,7 +1263,7 @@ TransactionResult::SharedConst CoordinatorPaymentTransaction::runFinalAmountsPar
     }
 }
 
-TransactionResult::SharedConst CoordinatorPaymentTransaction::runFinalReservationsNeighborConfirmation()
+TransactionResult CoordinatorPaymentTransaction::runFinalReservationsNeighborConfirmation()
 {
     debug() << "runFinalReservationsNeighborConfirmation";
     auto kMessage = popNextMessage<ReservationsInRelationToNodeMessage>();
@@ -1352,51 +1352,51 @@ void CoordinatorPaymentTransaction::switchToNextPath()
     }
 }
 
-TransactionResult::SharedConst CoordinatorPaymentTransaction::resultOK()
+TransactionResult CoordinatorPaymentTransaction::resultOK()
 {
     string transactionUUID = mTransactionUUID.stringUUID();
     return transactionResultFromCommand(
         mCommand->responseOK(transactionUUID));
 }
 
-TransactionResult::SharedConst CoordinatorPaymentTransaction::resultForbiddenRun()
+TransactionResult CoordinatorPaymentTransaction::resultForbiddenRun()
 {
     string transactionUUID = mTransactionUUID.stringUUID();
     return transactionResultFromCommand(
         mCommand->responseForbiddenRunTransaction());
 }
 
-TransactionResult::SharedConst CoordinatorPaymentTransaction::resultNoPathsError()
+TransactionResult CoordinatorPaymentTransaction::resultNoPathsError()
 {
     return transactionResultFromCommand(
         mCommand->responseNoRoutes());
 }
 
-TransactionResult::SharedConst CoordinatorPaymentTransaction::resultProtocolError()
+TransactionResult CoordinatorPaymentTransaction::resultProtocolError()
 {
     return transactionResultFromCommand(
         mCommand->responseProtocolError());
 }
 
-TransactionResult::SharedConst CoordinatorPaymentTransaction::resultNoResponseError()
+TransactionResult CoordinatorPaymentTransaction::resultNoResponseError()
 {
     return transactionResultFromCommand(
         mCommand->responseRemoteNodeIsInaccessible());
 }
 
-TransactionResult::SharedConst CoordinatorPaymentTransaction::resultInsufficientFundsError()
+TransactionResult CoordinatorPaymentTransaction::resultInsufficientFundsError()
 {
     return transactionResultFromCommand(
         mCommand->responseInsufficientFunds());
 }
 
-TransactionResult::SharedConst CoordinatorPaymentTransaction::resultNoConsensusError()
+TransactionResult CoordinatorPaymentTransaction::resultNoConsensusError()
 {
     return transactionResultFromCommand(
         mCommand->responseNoConsensus());
 }
 
-TransactionResult::SharedConst CoordinatorPaymentTransaction::resultUnexpectedError()
+TransactionResult CoordinatorPaymentTransaction::resultUnexpectedError()
 {
     return transactionResultFromCommand(
         mCommand->responseUnexpectedError());
@@ -1409,7 +1409,7 @@ const string CoordinatorPaymentTransaction::logHeader() const
     return s.str();
 }
 
-TransactionResult::SharedConst CoordinatorPaymentTransaction::approve()
+TransactionResult CoordinatorPaymentTransaction::approve()
 {
     mCommittedAmount = totalReservedAmount(
         AmountReservation::Outgoing);
@@ -1431,7 +1431,7 @@ TransactionResult::SharedConst CoordinatorPaymentTransaction::approve()
     return resultOK();
 }
 
-TransactionResult::SharedConst CoordinatorPaymentTransaction::reject(
+TransactionResult CoordinatorPaymentTransaction::reject(
     const char *message)
 {
     BasePaymentTransaction::reject(message);
@@ -1441,7 +1441,7 @@ TransactionResult::SharedConst CoordinatorPaymentTransaction::reject(
     return resultNoConsensusError();
 }
 
-TransactionResult::SharedConst CoordinatorPaymentTransaction::runDirectAmountReservationResponseProcessingStage ()
+TransactionResult CoordinatorPaymentTransaction::runDirectAmountReservationResponseProcessingStage ()
 {
     debug() << "runDirectAmountReservationResponseProcessingStage";
     auto pathStats = currentAmountReservationPathStats();
@@ -1521,7 +1521,7 @@ TransactionResult::SharedConst CoordinatorPaymentTransaction::runDirectAmountRes
     return tryProcessNextPath();
 }
 
-TransactionResult::SharedConst CoordinatorPaymentTransaction::runVotesConsistencyCheckingStage()
+TransactionResult CoordinatorPaymentTransaction::runVotesConsistencyCheckingStage()
 {
     debug() << "runVotesConsistencyCheckingStage";
     // Intermediate node or Receiver can send request if transaction is still alive.
@@ -1565,7 +1565,7 @@ TransactionResult::SharedConst CoordinatorPaymentTransaction::runVotesConsistenc
     return reject("Coordinator received message with some uncertain votes. Rolling back");
 }
 
-TransactionResult::SharedConst CoordinatorPaymentTransaction::runTTLTransactionResponse()
+TransactionResult CoordinatorPaymentTransaction::runTTLTransactionResponse()
 {
     debug() << "runTTLTransactionResponse";
     auto kMessage = popNextMessage<TTLProlongationRequestMessage>();
@@ -1818,7 +1818,7 @@ void CoordinatorPaymentTransaction::savePaymentOperationIntoHistory(
             PaymentRecord::PaymentOperationType::OutgoingPaymentType,
             mCommand->contractorUUID(),
             mCommittedAmount,
-            *mTrustLines->totalBalance().get(),
+            mTrustLines->totalBalance(),
             mCommand->UUID()));
     debug() << "Operation saved";
 }
@@ -68,7 +68,7 @@ public:
         SubsystemsController *subsystemsController)
         throw (bad_alloc);
 
-    TransactionResult::SharedConst run()
+    TransactionResult run()
         noexcept;
 
     /**
@@ -87,75 +87,75 @@ protected:
      * check conditions if transaction can be run
      * send request for building payment paths
      */
-    TransactionResult::SharedConst runPaymentInitialisationStage ();
+    TransactionResult runPaymentInitialisationStage ();
 
     /**
      * process the result of building paths
      * send request to Receiver for initialization payment transaction on it
      */
-    TransactionResult::SharedConst runPathsResourceProcessingStage();
+    TransactionResult runPathsResourceProcessingStage();
 
     /**
      * process response initialization from Receiver
      */
-    TransactionResult::SharedConst runReceiverResponseProcessingStage ();
+    TransactionResult runReceiverResponseProcessingStage ();
 
     /**
      * process the reservation of transaction amount on built paths
      */
-    TransactionResult::SharedConst runAmountReservationStage ();
+    TransactionResult runAmountReservationStage ();
 
     /**
      * reaction on request of reserve amount on direct way to Receiver
      */
-    TransactionResult::SharedConst runDirectAmountReservationResponseProcessingStage ();
+    TransactionResult runDirectAmountReservationResponseProcessingStage ();
 
     /**
      * reaction on messages with approving or not of final amounts configuration from all participants
      */
-    TransactionResult::SharedConst runFinalAmountsConfigurationConfirmation();
+    TransactionResult runFinalAmountsConfigurationConfirmation();
 
-    TransactionResult::SharedConst runFinalAmountsParticipantConfirmation();
+    TransactionResult runFinalAmountsParticipantConfirmation();
 
-    TransactionResult::SharedConst runFinalReservationsNeighborConfirmation();
+    TransactionResult runFinalReservationsNeighborConfirmation();
 
     /**
      * reaction on receiving participants votes message with result of voting
      * on this stage node can commit transaction or reject it
      * and send result to all participants
      */
-    TransactionResult::SharedConst runVotesConsistencyCheckingStage();
+    TransactionResult runVotesConsistencyCheckingStage();
 
     /*
      * reaction on message from some node if transaction is still alive
      * send message to requester with instruction "continue transaction" or "finish transaction"
      */
-    TransactionResult::SharedConst runTTLTransactionResponse();
+    TransactionResult runTTLTransactionResponse();
 
 protected:
     // Coordinator must return command result on transaction finishing.
     // Therefore this methods are overridden.
-    TransactionResult::SharedConst approve();
-    TransactionResult::SharedConst reject(
+    TransactionResult approve();
+    TransactionResult reject(
         const char *message = nullptr);
 
 protected:
     // Results handlers
-    TransactionResult::SharedConst resultOK();
-    TransactionResult::SharedConst resultForbiddenRun();
-    TransactionResult::SharedConst resultNoPathsError();
-    TransactionResult::SharedConst resultProtocolError();
-    TransactionResult::SharedConst resultNoResponseError();
-    TransactionResult::SharedConst resultInsufficientFundsError();
-    TransactionResult::SharedConst resultNoConsensusError();
-    TransactionResult::SharedConst resultUnexpectedError();
+    TransactionResult resultOK();
+    TransactionResult resultForbiddenRun();
+    TransactionResult resultNoPathsError();
+    TransactionResult resultProtocolError();
+    TransactionResult resultNoResponseError();
+    TransactionResult resultInsufficientFundsError();
+    TransactionResult resultNoConsensusError();
+    TransactionResult resultUnexpectedError();
 
 protected:
     /*
      * build participants votes message and send it to first participant
      * and wait for this message with result of voting
      */
-    TransactionResult::SharedConst propagateVotesListAndWaitForVotingResult();
+    TransactionResult propagateVotesListAndWaitForVotingResult();
 
     /**
      * add built path to mPathsStats for further processing on amount reservation stage
@@ -184,7 +184,7 @@ protected:
      * if paths is over, try rebuild new paths and switch on new path
      * in case if no new path build, returns resultInsufficientFundsError
      */
-    TransactionResult::SharedConst tryProcessNextPath();
+    TransactionResult tryProcessNextPath();
 
     /**
      * try reserve available amount on direct path to Receiver
@@ -192,7 +192,7 @@ protected:
      * @param pathID id of path on which amount reserved
      * @param pathStats path in which amount reserved
      */
-    TransactionResult::SharedConst tryReserveAmountDirectlyOnReceiver (
+    TransactionResult tryReserveAmountDirectlyOnReceiver (
         const PathID pathID,
         PathStats *pathStats);
 
@@ -200,7 +200,7 @@ protected:
      * try reserve available amount on next node on path
      * @param pathStats path on which trying reserve
      */
-    TransactionResult::SharedConst tryReserveNextIntermediateNodeAmount (
+    TransactionResult tryReserveNextIntermediateNodeAmount (
         PathStats *pathStats);
 
     /**
@@ -208,28 +208,28 @@ protected:
      * @param neighbor neighbor of current node on which reservation request will be sent
      * @param pathStats path on which thr reservation is made
      */
-    TransactionResult::SharedConst askNeighborToReserveAmount(
+    TransactionResult askNeighborToReserveAmount(
         const NodeUUID &neighbor,
         PathStats *pathStats);
 
     /**
      * reaction on reservation response from neighbor
      */
-    TransactionResult::SharedConst processNeighborAmountReservationResponse();
+    TransactionResult processNeighborAmountReservationResponse();
 
     /**
      * send further reservation request to neighbor (neighbor should reserve amount to his neighbor)
      * @param neighbor neighbor of current node on which further reservation request will be sent
      * @param pathStats path on which thr reservation is made
      */
-    TransactionResult::SharedConst askNeighborToApproveFurtherNodeReservation(
+    TransactionResult askNeighborToApproveFurtherNodeReservation(
         const NodeUUID &neighbor,
         PathStats *pathStats);
 
     /**
      * reaction on further reservation response from neighbor
      */
-    TransactionResult::SharedConst processNeighborFurtherReservationResponse();
+    TransactionResult processNeighborFurtherReservationResponse();
 
     /**
      * send further reservation request to remote intermediate node (node should reserve amount to his neighbor)
@@ -238,7 +238,7 @@ protected:
      * @param remoteNodePosition position of remote node in pathStats
      * @param nextNodeAfterRemote neighbor of remote node to which it should reserve available amount
      */
-    TransactionResult::SharedConst askRemoteNodeToApproveReservation(
+    TransactionResult askRemoteNodeToApproveReservation(
         PathStats *pathStats,
         const NodeUUID &remoteNode,
         const byte remoteNodePosition,
@@ -247,12 +247,12 @@ protected:
     /**
      * reaction on further reservation response from remote node
      */
-    TransactionResult::SharedConst processRemoteNodeResponse();
+    TransactionResult processRemoteNodeResponse();
 
     /**
      * send messages to all transaction participants with their final amount configuration
      */
-    TransactionResult::SharedConst sendFinalAmountsConfigurationToAllParticipants();
+    TransactionResult sendFinalAmountsConfigurationToAllParticipants();
 
     // add final path configuration to mNodesFinalAmountsConfiguration for all path nodes
     void addFinalConfigurationOnPath(
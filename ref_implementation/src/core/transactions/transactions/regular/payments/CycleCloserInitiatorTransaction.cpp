@@ -61,7 +61,7 @@ throw (bad_alloc) :
 {}
 
 
-TransactionResult::SharedConst CycleCloserInitiatorTransaction::run()
+TransactionResult CycleCloserInitiatorTransaction::run()
     noexcept
 {
     try {
@@ -104,7 +104,7 @@ TransactionResult::SharedConst CycleCloserInitiatorTransaction::run()
     }
 }
 
-TransactionResult::SharedConst CycleCloserInitiatorTransaction::runInitialisationStage()
+TransactionResult CycleCloserInitiatorTransaction::runInitialisationStage()
 {
     debug() << "runInitialisationStage";
     // Firstly check if paths is valid cycle
@@ -124,11 +124,11 @@ TransactionResult::SharedConst CycleCloserInitiatorTransaction::runInitialisatio
     const auto kOutgoingAmounts = mTrustLines->availableOutgoingCycleAmounts(mNextNode);
     const auto kOutgoingAmountWithReservations = kOutgoingAmounts.first;
     const auto kOutgoingAmountWithoutReservations = kOutgoingAmounts.second;
-    debug() << "OutgoingAmountWithReservations: " << *kOutgoingAmountWithReservations
-            << " OutgoingAmountWithoutReservations: " << *kOutgoingAmountWithoutReservations;
+    debug() << "OutgoingAmountWithReservations: " << kOutgoingAmountWithReservations
+            << " OutgoingAmountWithoutReservations: " << kOutgoingAmountWithoutReservations;
 
-    if (*kOutgoingAmountWithReservations == TrustLine::kZeroAmount()) {
-        if (*kOutgoingAmountWithoutReservations == TrustLine::kZeroAmount()) {
+    if (kOutgoingAmountWithReservations == TrustLine::kZeroAmount()) {
+        if (kOutgoingAmountWithoutReservations == TrustLine::kZeroAmount()) {
             warning() << "Can't close cycle, because coordinator outgoing amount equal zero, "
                 "and can't use reservations from other transactions";
             mCyclesManager->addClosedTrustLine(
@@ -139,7 +139,7 @@ TransactionResult::SharedConst CycleCloserInitiatorTransaction::runInitialisatio
             mOutgoingAmount = TrustLineAmount(0);
         }
     } else {
-        mOutgoingAmount = *kOutgoingAmountWithReservations;
+        mOutgoingAmount = kOutgoingAmountWithReservations;
     }
 
     debug() << "outgoing Possibilities: " << mOutgoingAmount;
@@ -155,7 +155,7 @@ TransactionResult::SharedConst CycleCloserInitiatorTransaction::runInitialisatio
     }
 
     const auto kIncomingAmounts = mTrustLines->availableIncomingCycleAmounts(mPreviousNode);
-    mIncomingAmount = *(kIncomingAmounts.first);
+    mIncomingAmount = kIncomingAmounts.first;
 
     if (mIncomingAmount == TrustLine::kZeroAmount()) {
         warning() << "Can't close cycle, because coordinator incoming amount equal zero";
@@ -174,7 +174,7 @@ TransactionResult::SharedConst CycleCloserInitiatorTransaction::runInitialisatio
     return runAmountReservationStage();
 }
 
-TransactionResult::SharedConst CycleCloserInitiatorTransaction::runAmountReservationStage ()
+TransactionResult CycleCloserInitiatorTransaction::runAmountReservationStage ()
 {
     debug() << "runAmountReservationStage";
     const auto kPathStats = mPathStats.get();
@@ -200,7 +200,7 @@ TransactionResult::SharedConst CycleCloserInitiatorTransaction::runAmountReserva
  * Collects all nodes from all paths into one votes list,
  * and propagates it to the next node in the votes list.
  */
-TransactionResult::SharedConst CycleCloserInitiatorTransaction::propagateVotesListAndWaitForVotingResult()
+TransactionResult CycleCloserInitiatorTransaction::propagateVotesListAndWaitForVotingResult()
 {
     debug() << "propagateVotesListAndWaitForVotingResult";
     const auto kCurrentNodeUUID = currentNodeUUID();
@@ -258,7 +258,7 @@ TransactionResult::SharedConst CycleCloserInitiatorTransaction::propagateVotesLi
         maxNetworkDelay(5));
 }
 
-TransactionResult::SharedConst CycleCloserInitiatorTransaction::tryReserveNextIntermediateNodeAmount ()
+TransactionResult CycleCloserInitiatorTransaction::tryReserveNextIntermediateNodeAmount ()
 {
     debug() << "tryReserveNextIntermediateNodeAmount";
     /*
@@ -298,7 +298,7 @@ TransactionResult::SharedConst CycleCloserInitiatorTransaction::tryReserveNextIn
     }
 }
 
-TransactionResult::SharedConst CycleCloserInitiatorTransaction::askNeighborToReserveAmount()
+TransactionResult CycleCloserInitiatorTransaction::askNeighborToReserveAmount()
 {
     debug() << "askNeighborToReserveAmount";
     const auto kCurrentNode = currentNodeUUID();
@@ -357,7 +357,7 @@ TransactionResult::SharedConst CycleCloserInitiatorTransaction::askNeighborToRes
         maxNetworkDelay(1));
 }
 
-TransactionResult::SharedConst CycleCloserInitiatorTransaction::runAmountReservationStageAgain()
+TransactionResult CycleCloserInitiatorTransaction::runAmountReservationStageAgain()
 {
     debug() << "runAmountReservationStageAgain";
 
@@ -395,7 +395,7 @@ TransactionResult::SharedConst CycleCloserInitiatorTransaction::runAmountReserva
         maxNetworkDelay(1));
 }
 
-TransactionResult::SharedConst CycleCloserInitiatorTransaction::processNeighborAmountReservationResponse()
+TransactionResult CycleCloserInitiatorTransaction::processNeighborAmountReservationResponse()
 {
     debug() << "processNeighborAmountReservationResponse";
     if (! contextIsValid(Message::Payments_IntermediateNodeCycleReservationResponse)) {
@@ -434,7 +434,7 @@ TransactionResult::SharedConst CycleCloserInitiatorTransaction::processNeighborA
     return runAmountReservationStage();
 }
 
-TransactionResult::SharedConst CycleCloserInitiatorTransaction::askNeighborToApproveFurtherNodeReservation()
+TransactionResult CycleCloserInitiatorTransaction::askNeighborToApproveFurtherNodeReservation()
 {
     debug() << "askNeighborToApproveFurtherNodeReservation";
     const auto kCoordinator = currentNodeUUID();
@@ -472,7 +472,7 @@ TransactionResult::SharedConst CycleCloserInitiatorTransaction::askNeighborToApp
 }
 
 
-TransactionResult::SharedConst CycleCloserInitiatorTransaction::processNeighborFurtherReservationResponse()
+TransactionResult CycleCloserInitiatorTransaction::processNeighborFurtherReservationResponse()
 {
     debug() << "processNeighborFurtherReservationResponse";
     auto path = mPathStats.get();
@@ -546,7 +546,7 @@ TransactionResult::SharedConst CycleCloserInitiatorTransaction::processNeighborF
     return runAmountReservationStage();
 }
 
-TransactionResult::SharedConst CycleCloserInitiatorTransaction::askRemoteNodeToApproveReservation(
+TransactionResult CycleCloserInitiatorTransaction::askRemoteNodeToApproveReservation(
     const NodeUUID& remoteNode,
     const byte remoteNodePosition,
     const NodeUUID& nextNodeAfterRemote)
@@ -593,7 +593,7 @@ TransactionResult::SharedConst CycleCloserInitiatorTransaction::askRemoteNodeToA
         maxNetworkDelay(4));
 }
 
-TransactionResult::SharedConst CycleCloserInitiatorTransaction::processRemoteNodeResponse()
+TransactionResult CycleCloserInitiatorTransaction::processRemoteNodeResponse()
 {
     debug() << "processRemoteNodeResponse";
     auto path = mPathStats.get();
@@ -709,7 +709,7 @@ TransactionResult::SharedConst CycleCloserInitiatorTransaction::processRemoteNod
     return tryReserveNextIntermediateNodeAmount();
 }
 
-TransactionResult::SharedConst CycleCloserInitiatorTransaction::runPreviousNeighborRequestProcessingStage()
+TransactionResult CycleCloserInitiatorTransaction::runPreviousNeighborRequestProcessingStage()
 {
     debug() << "runPreviousNeighborRequestProcessingStage";
     if (! contextIsValid(Message::Payments_IntermediateNodeCycleReservationRequest, false))
@@ -723,10 +723,10 @@ TransactionResult::SharedConst CycleCloserInitiatorTransaction::runPreviousNeigh
     const auto kIncomingAmounts = mTrustLines->availableIncomingCycleAmounts(mPreviousNode);
     const auto kIncomingAmountWithReservations = kIncomingAmounts.first;
     const auto kIncomingAmountWithoutReservations = kIncomingAmounts.second;
-    debug() << "IncomingAmountWithReservations: " << *kIncomingAmountWithReservations
-            << " IncomingAmountWithoutReservations: " << *kIncomingAmountWithoutReservations;
-    if (*kIncomingAmountWithReservations == TrustLine::kZeroAmount()) {
-        if (*kIncomingAmountWithoutReservations == TrustLine::kZeroAmount()) {
+    debug() << "IncomingAmountWithReservations: " << kIncomingAmountWithReservations
+            << " IncomingAmountWithoutReservations: " << kIncomingAmountWithoutReservations;
+    if (kIncomingAmountWithReservations == TrustLine::kZeroAmount()) {
+        if (kIncomingAmountWithoutReservations == TrustLine::kZeroAmount()) {
             sendMessage<IntermediateNodeCycleReservationResponseMessage>(
                 mPreviousNode,
                 currentNodeUUID(),
@@ -741,7 +741,7 @@ TransactionResult::SharedConst CycleCloserInitiatorTransaction::runPreviousNeigh
     } else {
         mIncomingAmount = min(
             kMessage->amount(),
-            *kIncomingAmountWithReservations);
+            kIncomingAmountWithReservations);
     }
 
     if (0 == mIncomingAmount) {
@@ -791,7 +791,7 @@ TransactionResult::SharedConst CycleCloserInitiatorTransaction::runPreviousNeigh
         maxNetworkDelay(2));
 }
 
-TransactionResult::SharedConst CycleCloserInitiatorTransaction::runPreviousNeighborRequestProcessingStageAgain()
+TransactionResult CycleCloserInitiatorTransaction::runPreviousNeighborRequestProcessingStageAgain()
 {
     debug() << "runPreviousNeighborRequestProcessingStageAgain";
 
@@ -833,7 +833,7 @@ TransactionResult::SharedConst CycleCloserInitiatorTransaction::runPreviousNeigh
         maxNetworkDelay(2));
 }
 
-TransactionResult::SharedConst CycleCloserInitiatorTransaction::runFinalAmountsConfigurationConfirmationProcessingStage()
+TransactionResult CycleCloserInitiatorTransaction::runFinalAmountsConfigurationConfirmationProcessingStage()
 {
     debug() << "runFinalAmountsConfigurationConfirmationProcessingStage";
     if (contextIsValid(Message::Payments_FinalAmountsConfigurationResponse, false)) {
@@ -847,7 +847,7 @@ TransactionResult::SharedConst CycleCloserInitiatorTransaction::runFinalAmountsC
     return reject("Some nodes didn't confirm final amount configuration. Transaction rejected.");
 }
 
-TransactionResult::SharedConst CycleCloserInitiatorTransaction::runFinalAmountsParticipantConfirmation()
+TransactionResult CycleCloserInitiatorTransaction::runFinalAmountsParticipantConfirmation()
 {
     debug() << "runFinalAmountsParticipantConfirmation";
     auto kMessage = popNextMessage<FinalAmountsConfigurationResponseMessage>();
@@ -887,7 +887,7 @@ TransactionResult::SharedConst CycleCloserInitiatorTransaction::runFinalAmountsP
     }
 }
 
-TransactionResult::SharedConst CycleCloserInitiatorTransaction::runFinalReservationsNeighborConfirmation()
+TransactionResult CycleCloserInitiatorTransaction::runFinalReservationsNeighborConfirmation()
 {
     debug() << "runFinalReservationsNeighborConfirmation";
     auto kMessage = popNextMessage<ReservationsInRelationToNodeMessage>();
@@ -924,7 +924,7 @@ TransactionResult::SharedConst CycleCloserInitiatorTransaction::runFinalReservat
     }
 }
 
-TransactionResult::SharedConst CycleCloserInitiatorTransaction::runVotesConsistencyCheckingStage()
+TransactionResult CycleCloserInitiatorTransaction::runVotesConsistencyCheckingStage()
 {
     debug() << "runVotesConsistencyCheckingStage";
     if (! contextIsValid(Message::Payments_ParticipantsVotes)) {
@@ -1032,7 +1032,7 @@ void CycleCloserInitiatorTransaction::sendFinalPathConfiguration(
     }
 }
 
-TransactionResult::SharedConst CycleCloserInitiatorTransaction::approve()
+TransactionResult CycleCloserInitiatorTransaction::approve()
 {
     mCommittedAmount = totalReservedAmount(
         AmountReservation::Outgoing);
@@ -53,7 +53,7 @@ public:
         SubsystemsController *subsystemsController)
         throw (bad_alloc);
 
-    TransactionResult::SharedConst run()
+    TransactionResult run()
         noexcept;
 
     /**
@@ -73,72 +73,72 @@ protected:
     /**
      * check if cycle is valid and current node has enough amount to close it
      */
-    TransactionResult::SharedConst runInitialisationStage();
+    TransactionResult runInitialisationStage();
 
     /**
      * process the reservation of transaction amount on cycle path
      */
-    TransactionResult::SharedConst runAmountReservationStage ();
+    TransactionResult runAmountReservationStage ();
 
     /**
      * reaction on reservation request message from last intermediate node in path
      */
-    TransactionResult::SharedConst runPreviousNeighborRequestProcessingStage();
+    TransactionResult runPreviousNeighborRequestProcessingStage();
 
     /**
      * continue process the reservation of transaction amount on cycle path
      * after waiting for closing conflicted transaction and releasing it amount
      */
-    TransactionResult::SharedConst runAmountReservationStageAgain();
+    TransactionResult runAmountReservationStageAgain();
 
     /**
      * continue reaction on reservation request message from last intermediate node in path
      * after waiting for closing conflicted transaction and releasing it amount
      */
-    TransactionResult::SharedConst runPreviousNeighborRequestProcessingStageAgain();
+    TransactionResult runPreviousNeighborRequestProcessingStageAgain();
 
     /**
      * reaction on messages with approving or not of final amounts configuration from all participants
      */
-    TransactionResult::SharedConst runFinalAmountsConfigurationConfirmationProcessingStage();
+    TransactionResult runFinalAmountsConfigurationConfirmationProcessingStage();
 
-    TransactionResult::SharedConst runFinalAmountsParticipantConfirmation();
+    TransactionResult runFinalAmountsParticipantConfirmation();
 
-    TransactionResult::SharedConst runFinalReservationsNeighborConfirmation();
+    TransactionResult runFinalReservationsNeighborConfirmation();
 
     /**
      * reaction on receiving participants votes message with result of voting,
      * on this stage node can commit transaction or reject it
      * and send result to all participants
      */
-    TransactionResult::SharedConst runVotesConsistencyCheckingStage();
+    TransactionResult runVotesConsistencyCheckingStage();
 
 protected:
     /**
      * try reserve available amount to next node on closing cycle
      */
-    TransactionResult::SharedConst tryReserveNextIntermediateNodeAmount();
+    TransactionResult tryReserveNextIntermediateNodeAmount();
 
     /**
      * send reservation request to neighbor on closing cycle
      */
-    TransactionResult::SharedConst askNeighborToReserveAmount();
+    TransactionResult askNeighborToReserveAmount();
 
     /**
      * reaction on reservation response from neighbor
      */
-    TransactionResult::SharedConst processNeighborAmountReservationResponse();
+    TransactionResult processNeighborAmountReservationResponse();
 
     /**
      * send further reservation request to neighbor on closing cycle
      * (neighbor should reserve amount to his neighbor)
      */
-    TransactionResult::SharedConst askNeighborToApproveFurtherNodeReservation();
+    TransactionResult askNeighborToApproveFurtherNodeReservation();
 
     /**
      * reaction on further reservation response from neighbor
      */
-    TransactionResult::SharedConst processNeighborFurtherReservationResponse();
+    TransactionResult processNeighborFurtherReservationResponse();
 
     /**
      * send further reservation request to remote intermediate node (node should reserve amount to his neighbor)
@@ -146,7 +146,7 @@ protected:
      * @param remoteNodePosition position of remote node in pathStats
      * @param nextNodeAfterRemote neighbor of remote node to which it should reserve available amount
      */
-    TransactionResult::SharedConst askRemoteNodeToApproveReservation(
+    TransactionResult askRemoteNodeToApproveReservation(
         const NodeUUID &remoteNode,
         const byte remoteNodePosition,
         const NodeUUID &nextNodeAfterRemote);
@@ -154,16 +154,16 @@ protected:
     /**
      * reaction on further reservation response from remote node
      */
-    TransactionResult::SharedConst processRemoteNodeResponse();
+    TransactionResult processRemoteNodeResponse();
 
     /*
      * build participants votes message and send it to first participant
      * and wait for this message with result of voting
      */
-    TransactionResult::SharedConst propagateVotesListAndWaitForVotingResult();
+    TransactionResult propagateVotesListAndWaitForVotingResult();
 
 protected:
-    TransactionResult::SharedConst approve();
+    TransactionResult approve();
 
 protected:
     const string logHeader() const;
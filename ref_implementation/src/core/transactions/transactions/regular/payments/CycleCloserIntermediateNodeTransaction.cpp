@@ -59,7 +59,7 @@ CycleCloserIntermediateNodeTransaction::CycleCloserIntermediateNodeTransaction(
     mCyclesManager(cyclesManager)
 {}
 
-TransactionResult::SharedConst CycleCloserIntermediateNodeTransaction::run()
+TransactionResult CycleCloserIntermediateNodeTransaction::run()
     noexcept {
     try {
         switch (mStep) {
@@ -101,7 +101,7 @@ TransactionResult::SharedConst CycleCloserIntermediateNodeTransaction::run()
     }
 }
 
-TransactionResult::SharedConst CycleCloserIntermediateNodeTransaction::runPreviousNeighborRequestProcessingStage()
+TransactionResult CycleCloserIntermediateNodeTransaction::runPreviousNeighborRequestProcessingStage()
 {
     debug() << "runPreviousNeighborRequestProcessingStage";
     mPreviousNode = mMessage->senderUUID;
@@ -126,10 +126,10 @@ TransactionResult::SharedConst CycleCloserIntermediateNodeTransaction::runPrevio
     const auto kIncomingAmountWithReservations = kIncomingAmounts.first;
     const auto kIncomingAmountWithoutReservations = kIncomingAmounts.second;
 
-    debug() << "IncomingAmountWithReservations: " << *kIncomingAmountWithReservations
-            << " IncomingAmountWithoutReservations: " << *kIncomingAmountWithoutReservations;
-    if (*kIncomingAmountWithReservations == TrustLine::kZeroAmount()) {
-        if (*kIncomingAmountWithoutReservations == TrustLine::kZeroAmount()) {
+    debug() << "IncomingAmountWithReservations: " << kIncomingAmountWithReservations
+            << " IncomingAmountWithoutReservations: " << kIncomingAmountWithoutReservations;
+    if (kIncomingAmountWithReservations == TrustLine::kZeroAmount()) {
+        if (kIncomingAmountWithoutReservations == TrustLine::kZeroAmount()) {
             sendMessage<IntermediateNodeCycleReservationResponseMessage>(
                 mPreviousNode,
                 currentNodeUUID(),
@@ -143,7 +143,7 @@ TransactionResult::SharedConst CycleCloserIntermediateNodeTransaction::runPrevio
     } else {
         mReservationAmount = min(
             mMessage->amount(),
-            *kIncomingAmountWithReservations);
+            kIncomingAmountWithReservations);
     }
 
     if (0 == mReservationAmount) {
@@ -201,7 +201,7 @@ TransactionResult::SharedConst CycleCloserIntermediateNodeTransaction::runPrevio
         maxNetworkDelay(3));
 }
 
-TransactionResult::SharedConst CycleCloserIntermediateNodeTransaction::runPreviousNeighborRequestProcessingStageAgain()
+TransactionResult CycleCloserIntermediateNodeTransaction::runPreviousNeighborRequestProcessingStageAgain()
 {
     debug() << "runPreviousNeighborRequestProcessingStageAgain";
     if (mCyclesManager->isTransactionStillAlive(
@@ -245,7 +245,7 @@ TransactionResult::SharedConst CycleCloserIntermediateNodeTransaction::runPrevio
         maxNetworkDelay(3));
 }
 
-TransactionResult::SharedConst CycleCloserIntermediateNodeTransaction::runCoordinatorRequestProcessingStage()
+TransactionResult CycleCloserIntermediateNodeTransaction::runCoordinatorRequestProcessingStage()
 {
     debug() << "runCoordinatorRequestProcessingStage";
     if (contextIsValid(Message::Payments_TTLProlongationResponse, false)) {
@@ -292,11 +292,11 @@ TransactionResult::SharedConst CycleCloserIntermediateNodeTransaction::runCoordi
     const auto kOutgoingAmounts = mTrustLines->availableOutgoingCycleAmounts(mNextNode);
     const auto kOutgoingAmountWithReservations = kOutgoingAmounts.first;
     const auto kOutgoingAmountWithoutReservations = kOutgoingAmounts.second;
-    debug() << "OutgoingAmountWithReservations: " << *kOutgoingAmountWithReservations
-            << " OutgoingAmountWithoutReservations: " << *kOutgoingAmountWithoutReservations;
+    debug() << "OutgoingAmountWithReservations: " << kOutgoingAmountWithReservations
+            << " OutgoingAmountWithoutReservations: " << kOutgoingAmountWithoutReservations;
 
-    if (*kOutgoingAmountWithReservations == TrustLine::kZeroAmount()) {
-        if (*kOutgoingAmountWithoutReservations == TrustLine::kZeroAmount()) {
+    if (kOutgoingAmountWithReservations == TrustLine::kZeroAmount()) {
+        if (kOutgoingAmountWithoutReservations == TrustLine::kZeroAmount()) {
             sendMessage<CoordinatorCycleReservationResponseMessage>(
                 mCoordinator,
                 currentNodeUUID(),
@@ -312,7 +312,7 @@ TransactionResult::SharedConst CycleCloserIntermediateNodeTransaction::runCoordi
     } else {
         mReservationAmount = min(
             kMessage->amount(),
-            *kOutgoingAmountWithReservations);
+            kOutgoingAmountWithReservations);
     }
 
     if (0 == mReservationAmount) {
@@ -370,7 +370,7 @@ TransactionResult::SharedConst CycleCloserIntermediateNodeTransaction::runCoordi
         maxNetworkDelay(2));
 }
 
-TransactionResult::SharedConst CycleCloserIntermediateNodeTransaction::runCoordinatorRequestProcessingStageAgain()
+TransactionResult CycleCloserIntermediateNodeTransaction::runCoordinatorRequestProcessingStageAgain()
 {
     debug() << "runCoordinatorRequestProcessingStageAgain";
     if (mCyclesManager->isTransactionStillAlive(
@@ -414,7 +414,7 @@ TransactionResult::SharedConst CycleCloserIntermediateNodeTransaction::runCoordi
         maxNetworkDelay(2));
 }
 
-TransactionResult::SharedConst CycleCloserIntermediateNodeTransaction::runNextNeighborResponseProcessingStage()
+TransactionResult CycleCloserIntermediateNodeTransaction::runNextNeighborResponseProcessingStage()
 {
     debug() << "runNextNeighborResponseProcessingStage";
     if (! contextIsValid(Message::Payments_IntermediateNodeCycleReservationResponse)) {
@@ -493,7 +493,7 @@ TransactionResult::SharedConst CycleCloserIntermediateNodeTransaction::runNextNe
         maxNetworkDelay((kMaxPathLength - 2) * 4));
 }
 
-TransactionResult::SharedConst CycleCloserIntermediateNodeTransaction::runFinalPathConfigurationProcessingStage()
+TransactionResult CycleCloserIntermediateNodeTransaction::runFinalPathConfigurationProcessingStage()
 {
     debug() << "runFinalPathConfigurationProcessingStage";
     if (contextIsValid(Message::Payments_TTLProlongationResponse, false)) {
@@ -514,7 +514,7 @@ TransactionResult::SharedConst CycleCloserIntermediateNodeTransaction::runFinalP
     return reject("No final paths configuration was received from the coordinator. Rejected.");
 }
 
-TransactionResult::SharedConst CycleCloserIntermediateNodeTransaction::runFinalPathConfigurationCoordinatorConfirmation()
+TransactionResult CycleCloserIntermediateNodeTransaction::runFinalPathConfigurationCoordinatorConfirmation()
 {
     debug() << "runFinalPathConfigurationCoordinatorConfirmation";
     const auto kMessage = popNextMessage<FinalPathCycleConfigurationMessage>();
@@ -589,7 +589,7 @@ TransactionResult::SharedConst CycleCloserIntermediateNodeTransaction::runFinalP
         maxNetworkDelay(2));
 }
 
-TransactionResult::SharedConst CycleCloserIntermediateNodeTransaction::runFinalReservationsNeighborConfirmation()
+TransactionResult CycleCloserIntermediateNodeTransaction::runFinalReservationsNeighborConfirmation()
 {
     debug() << "runFinalReservationsNeighborConfirmation";
     auto kMessage = popNextMessage<ReservationsInRelationToNodeMessage>();
@@ -639,7 +639,7 @@ TransactionResult::SharedConst CycleCloserIntermediateNodeTransaction::runFinalR
         maxNetworkDelay(2));
 }
 
-TransactionResult::SharedConst CycleCloserIntermediateNodeTransaction::runVotesCheckingStageWithPossibleTTL()
+TransactionResult CycleCloserIntermediateNodeTransaction::runVotesCheckingStageWithPossibleTTL()
 {
     debug() << "runVotesCheckingStageWithPossibleTTL";
     if (contextIsValid(Message::Payments_TTLProlongationResponse, false)) {
@@ -673,7 +673,7 @@ const SerializedPathLengthSize CycleCloserIntermediateNodeTransaction::cycleLeng
     return mCycleLength;
 }
 
-TransactionResult::SharedConst CycleCloserIntermediateNodeTransaction::approve()
+TransactionResult CycleCloserIntermediateNodeTransaction::approve()
 {
     mCommittedAmount = totalReservedAmount(
         AmountReservation::Outgoing);
@@ -42,7 +42,7 @@ public:
         Logger &log,
         SubsystemsController *subsystemsController);
 
-    TransactionResult::SharedConst run()
+    TransactionResult run()
     noexcept;
 
     /**
@@ -61,42 +61,42 @@ protected:
      * reaction on reservation request message from previous node on closing cycle
      * try reserve requested incoming amount and send reservation response
      */
-    TransactionResult::SharedConst runPreviousNeighborRequestProcessingStage();
+    TransactionResult runPreviousNeighborRequestProcessingStage();
 
     /**
      * reaction on coordinator further reservation request message
      * try reserve requested outgoing amount to next node on closing cycle
      * and send reservation request message to this node
      */
-    TransactionResult::SharedConst runCoordinatorRequestProcessingStage();
+    TransactionResult runCoordinatorRequestProcessingStage();
 
     /**
      * reaction on next node reservation response message
      * send reservation response to coordinator
      */
-    TransactionResult::SharedConst runNextNeighborResponseProcessingStage();
+    TransactionResult runNextNeighborResponseProcessingStage();
 
     /**
      * reaction on message with final amount configuration from coordinator
      * update all reservations according to received final configuration
      */
-    TransactionResult::SharedConst runFinalPathConfigurationProcessingStage();
+    TransactionResult runFinalPathConfigurationProcessingStage();
 
-    TransactionResult::SharedConst runFinalPathConfigurationCoordinatorConfirmation();
+    TransactionResult runFinalPathConfigurationCoordinatorConfirmation();
 
-    TransactionResult::SharedConst runFinalReservationsNeighborConfirmation();
+    TransactionResult runFinalReservationsNeighborConfirmation();
 
     /**
      * continue reaction on coordinator further reservation request message
      * after waiting for closing conflicted transaction and releasing it amount
      */
-    TransactionResult::SharedConst runCoordinatorRequestProcessingStageAgain();
+    TransactionResult runCoordinatorRequestProcessingStageAgain();
 
     /**
      * continue reaction on reservation request message from previous node
      * after waiting for closing conflicted transaction and releasing it amount
      */
-    TransactionResult::SharedConst runPreviousNeighborRequestProcessingStageAgain();
+    TransactionResult runPreviousNeighborRequestProcessingStageAgain();
 
     /**
      * reaction on receiving participants votes message firstly,
@@ -104,10 +104,10 @@ protected:
      * if no participants votes message received then send message (TTL)
      * to coordinator with request if transaction is still alive
      */
-    TransactionResult::SharedConst runVotesCheckingStageWithPossibleTTL();
+    TransactionResult runVotesCheckingStageWithPossibleTTL();
 
 protected:
-    TransactionResult::SharedConst approve();
+    TransactionResult approve();
 
 protected:
     /**
@@ -57,7 +57,7 @@ IntermediateNodePaymentTransaction::IntermediateNodePaymentTransaction(
         subsystemsController)
 {}
 
-TransactionResult::SharedConst IntermediateNodePaymentTransaction::run()
+TransactionResult IntermediateNodePaymentTransaction::run()
     noexcept {
     try {
         switch (mStep) {
@@ -105,7 +105,7 @@ TransactionResult::SharedConst IntermediateNodePaymentTransaction::run()
 }
 
 
-TransactionResult::SharedConst IntermediateNodePaymentTransaction::runPreviousNeighborRequestProcessingStage()
+TransactionResult IntermediateNodePaymentTransaction::runPreviousNeighborRequestProcessingStage()
 {
     debug() << "runPreviousNeighborRequestProcessingStage";
     const auto kNeighbor = mMessage->senderUUID;
@@ -190,7 +190,7 @@ TransactionResult::SharedConst IntermediateNodePaymentTransaction::runPreviousNe
 
     const auto kIncomingAmount = mTrustLines->incomingTrustAmountConsideringReservations(kNeighbor);
     TrustLineAmount kReservationAmount =
-            min(*kReservation.second.get(), *kIncomingAmount);
+            min(*kReservation.second.get(), kIncomingAmount);
 
 #ifdef TESTS
     mSubsystemsController->testForbidSendResponseToIntNodeOnReservationStage(
@@ -244,7 +244,7 @@ TransactionResult::SharedConst IntermediateNodePaymentTransaction::runPreviousNe
         maxNetworkDelay(3));
 }
 
-TransactionResult::SharedConst IntermediateNodePaymentTransaction::runCoordinatorRequestProcessingStage()
+TransactionResult IntermediateNodePaymentTransaction::runCoordinatorRequestProcessingStage()
 {
     debug() << "runCoordinatorRequestProcessingStage";
 
@@ -318,10 +318,10 @@ TransactionResult::SharedConst IntermediateNodePaymentTransaction::runCoordinato
 
     // Note: copy of shared pointer is required
     const auto kOutgoingAmount = mTrustLines->outgoingTrustAmountConsideringReservations(kNextNode);
-    debug() << "available outgoing amount to " << kNextNode << " is " << *kOutgoingAmount.get();
+    debug() << "available outgoing amount to " << kNextNode << " is " << kOutgoingAmount;
     TrustLineAmount reservationAmount = min(
         *kReservation.second.get(),
-        *kOutgoingAmount);
+        kOutgoingAmount);
 
     if (0 == reservationAmount || ! reserveOutgoingAmount(kNextNode, reservationAmount, kReservation.first)) {
         sendMessage<CoordinatorReservationResponseMessage>(
@@ -390,7 +390,7 @@ TransactionResult::SharedConst IntermediateNodePaymentTransaction::runCoordinato
         maxNetworkDelay(2));
 }
 
-TransactionResult::SharedConst IntermediateNodePaymentTransaction::runNextNeighborResponseProcessingStage()
+TransactionResult IntermediateNodePaymentTransaction::runNextNeighborResponseProcessingStage()
 {
     debug() << "runNextNeighborResponseProcessingStage";
     if (mContext.empty()) {
@@ -509,7 +509,7 @@ TransactionResult::SharedConst IntermediateNodePaymentTransaction::runNextNeighb
         maxNetworkDelay((kMaxPathLength - 2) * 4));
 }
 
-TransactionResult::SharedConst IntermediateNodePaymentTransaction::runFinalPathConfigurationProcessingStage()
+TransactionResult IntermediateNodePaymentTransaction::runFinalPathConfigurationProcessingStage()
 {
     // receive final amount on current path
     debug() << "runFinalPathConfigurationProcessingStage";
@@ -549,7 +549,7 @@ TransactionResult::SharedConst IntermediateNodePaymentTransaction::runFinalPathC
         maxNetworkDelay((kMaxPathLength - 2) * 4));
 }
 
-TransactionResult::SharedConst IntermediateNodePaymentTransaction::runReservationProlongationStage()
+TransactionResult IntermediateNodePaymentTransaction::runReservationProlongationStage()
 {
     debug() << "runReservationProlongationStage";
     // on this stage we can receive IntermediateNodeReservationRequest message
@@ -594,7 +594,7 @@ TransactionResult::SharedConst IntermediateNodePaymentTransaction::runReservatio
     return runFinalReservationsCoordinatorConfirmation();
 }
 
-TransactionResult::SharedConst IntermediateNodePaymentTransaction::runClarificationOfTransactionBeforeVoting()
+TransactionResult IntermediateNodePaymentTransaction::runClarificationOfTransactionBeforeVoting()
 {
     // on this stage we can receive IntermediateNodeReservationRequest, FinalAmountsConfiguration
     // messages and on this cases we process it properly
@@ -642,7 +642,7 @@ TransactionResult::SharedConst IntermediateNodePaymentTransaction::runClarificat
     return reject("Coordinator send response with transaction finish state. Rolling Back");
 }
 
-TransactionResult::SharedConst IntermediateNodePaymentTransaction::runFinalAmountsConfigurationConfirmation()
+TransactionResult IntermediateNodePaymentTransaction::runFinalAmountsConfigurationConfirmation()
 {
     debug() << "runFinalAmountsConfigurationConfirmation";
     if (contextIsValid(Message::Payments_FinalAmountsConfiguration, false)) {
@@ -681,7 +681,7 @@ TransactionResult::SharedConst IntermediateNodePaymentTransaction::runFinalAmoun
         maxNetworkDelay(2));
 }
 
-TransactionResult::SharedConst IntermediateNodePaymentTransaction::runFinalReservationsCoordinatorConfirmation()
+TransactionResult IntermediateNodePaymentTransaction::runFinalReservationsCoordinatorConfirmation()
 {
     // receive final configuration on all paths
     debug() << "runFinalReservationsCoordinatorConfirmation";
@@ -749,7 +749,7 @@ TransactionResult::SharedConst IntermediateNodePaymentTransaction::runFinalReser
         maxNetworkDelay(2));
 }
 
-TransactionResult::SharedConst IntermediateNodePaymentTransaction::runFinalReservationsNeighborConfirmation()
+TransactionResult IntermediateNodePaymentTransaction::runFinalReservationsNeighborConfirmation()
 {
     debug() << "runFinalReservationsNeighborConfirmation";
     auto kMessage = popNextMessage<ReservationsInRelationToNodeMessage>();
@@ -799,7 +799,7 @@ TransactionResult::SharedConst IntermediateNodePaymentTransaction::runFinalReser
         maxNetworkDelay(2));
 }
 
-TransactionResult::SharedConst IntermediateNodePaymentTransaction::runClarificationOfTransactionDuringFinalAmountsClarification()
+TransactionResult IntermediateNodePaymentTransaction::runClarificationOfTransactionDuringFinalAmountsClarification()
 {
     debug() << "runClarificationOfTransactionDuringFinalAmountsClarification";
 
@@ -827,7 +827,7 @@ TransactionResult::SharedConst IntermediateNodePaymentTransaction::runClarificat
     return reject("Coordinator send TTL message with transaction finish state. Rolling Back");
 }
 
-TransactionResult::SharedConst IntermediateNodePaymentTransaction::runVotesCheckingStageWithCoordinatorClarification()
+TransactionResult IntermediateNodePaymentTransaction::runVotesCheckingStageWithCoordinatorClarification()
 {
     if (contextIsValid(Message::Payments_ParticipantsVotes, false)) {
         return runVotesCheckingStage();
@@ -854,7 +854,7 @@ TransactionResult::SharedConst IntermediateNodePaymentTransaction::runVotesCheck
         maxNetworkDelay(2));
 }
 
-TransactionResult::SharedConst IntermediateNodePaymentTransaction::runClarificationOfTransactionDuringVoting()
+TransactionResult IntermediateNodePaymentTransaction::runClarificationOfTransactionDuringVoting()
 {
     debug() << "runClarificationOfTransactionDuringVoting";
     if (contextIsValid(Message::MessageType::Payments_ParticipantsVotes, false)) {
@@ -904,7 +904,7 @@ void IntermediateNodePaymentTransaction::shortageReservationsOnPath(
     }
 }
 
-TransactionResult::SharedConst IntermediateNodePaymentTransaction::approve()
+TransactionResult IntermediateNodePaymentTransaction::approve()
 {
     mCommittedAmount = totalReservedAmount(
         AmountReservation::Outgoing);
@@ -40,7 +40,7 @@ public:
         Logger &log,
         SubsystemsController *subsystemsController);
 
-    TransactionResult::SharedConst run()
+    TransactionResult run()
         noexcept;
 
     /**
@@ -53,58 +53,58 @@ protected:
      * reaction on reservation request message from previous node on processed path
      * try reserve requested incoming amount and send reservation response
      */
-    TransactionResult::SharedConst runPreviousNeighborRequestProcessingStage();
+    TransactionResult runPreviousNeighborRequestProcessingStage();
 
     /**
      * reaction on coordinator further reservation request message
      * try reserve requested outgoing amount to next node on processed path
      * and send reservation request message to this node
      */
-    TransactionResult::SharedConst runCoordinatorRequestProcessingStage();
+    TransactionResult runCoordinatorRequestProcessingStage();
 
     /**
      * reaction on next node reservation response message
      * send reservation response to coordinator
      */
-    TransactionResult::SharedConst runNextNeighborResponseProcessingStage();
+    TransactionResult runNextNeighborResponseProcessingStage();
 
     /**
      * reaction on message with final amount configuration on processed path from coordinator
      * update all reservations on this path according to received final configuration
      */
-    TransactionResult::SharedConst runFinalPathConfigurationProcessingStage();
+    TransactionResult runFinalPathConfigurationProcessingStage();
 
     /**
      * reaction on any message and run appropriate method
      * if no message received then send message (TTL)
      * to coordinator with request if transaction is still alive
      */
-    TransactionResult::SharedConst runReservationProlongationStage();
+    TransactionResult runReservationProlongationStage();
 
     /**
      * reaction on response TTL message from coordinator
      * before receiving participants votes message
      */
-    TransactionResult::SharedConst runClarificationOfTransactionBeforeVoting();
+    TransactionResult runClarificationOfTransactionBeforeVoting();
 
-    TransactionResult::SharedConst runFinalAmountsConfigurationConfirmation();
+    TransactionResult runFinalAmountsConfigurationConfirmation();
 
     /**
      * reaction on message with final amounts configuration (on all paths) from coordinator
      * update all reservations according to received final configuration
      * and send response if all reservations was successfully updated
      */
-    TransactionResult::SharedConst runFinalReservationsCoordinatorConfirmation();
+    TransactionResult runFinalReservationsCoordinatorConfirmation();
 
-    TransactionResult::SharedConst runFinalReservationsNeighborConfirmation();
+    TransactionResult runFinalReservationsNeighborConfirmation();
 
-    TransactionResult::SharedConst runClarificationOfTransactionDuringFinalAmountsClarification();
+    TransactionResult runClarificationOfTransactionDuringFinalAmountsClarification();
 
     /**
      * reaction on response TTL message from coordinator
      * after receiving participants votes message
      */
-    TransactionResult::SharedConst runClarificationOfTransactionDuringVoting();
+    TransactionResult runClarificationOfTransactionDuringVoting();
 
     /**
      * reaction on receiving participants votes message firstly
@@ -112,12 +112,12 @@ protected:
      * if no message received then send message (TTL)
      * to coordinator with request if transaction is still alive
      */
-    TransactionResult::SharedConst runVotesCheckingStageWithCoordinatorClarification();
+    TransactionResult runVotesCheckingStageWithCoordinatorClarification();
 
 protected:
     // Intermediate node must launch closing cycles 3 and 4 transactions.
     // Therefore this methods are overridden.
-    TransactionResult::SharedConst approve();
+    TransactionResult approve();
 
 protected:
     /**
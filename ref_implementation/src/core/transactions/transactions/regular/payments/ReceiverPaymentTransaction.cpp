@@ -57,7 +57,7 @@ ReceiverPaymentTransaction::ReceiverPaymentTransaction(
         subsystemsController)
 {}
 
-TransactionResult::SharedConst ReceiverPaymentTransaction::run()
+TransactionResult ReceiverPaymentTransaction::run()
     noexcept
 {
     try {
@@ -106,7 +106,7 @@ const string ReceiverPaymentTransaction::logHeader() const
     return s.str();
 }
 
-TransactionResult::SharedConst ReceiverPaymentTransaction::runInitialisationStage()
+TransactionResult ReceiverPaymentTransaction::runInitialisationStage()
 {
     const auto kCoordinator = mMessage->senderUUID;
     debug() << "Operation for " << mMessage->amount() << " initialised by the (" << kCoordinator << ")";
@@ -114,7 +114,7 @@ TransactionResult::SharedConst ReceiverPaymentTransaction::runInitialisationStag
     // Check if total incoming possibilities of the node are <= of the payment amount.
     // If not - there is no reason to process the operation at all.
     // (reject operation)
-    const auto kTotalAvailableIncomingAmount = *(mTrustLines->totalIncomingAmount());
+    const auto kTotalAvailableIncomingAmount = mTrustLines->totalIncomingAmount();
     debug() << "Total incoming amount: " << kTotalAvailableIncomingAmount;
     if (kTotalAvailableIncomingAmount < mMessage->amount()) {
         sendMessage<ReceiverInitPaymentResponseMessage>(
@@ -147,7 +147,7 @@ TransactionResult::SharedConst ReceiverPaymentTransaction::runInitialisationStag
         maxNetworkDelay((kMaxPathLength - 1) * 4));
 }
 
-TransactionResult::SharedConst ReceiverPaymentTransaction::runAmountReservationStage()
+TransactionResult ReceiverPaymentTransaction::runAmountReservationStage()
 {
     debug() << "runAmountReservationStage";
     if (contextIsValid(Message::Payments_TTLProlongationResponse, false)) {
@@ -250,7 +250,7 @@ TransactionResult::SharedConst ReceiverPaymentTransaction::runAmountReservationS
 
     // Note: copy of shared pointer is required.
     const auto kAvailableAmount = mTrustLines->incomingTrustAmountConsideringReservations(kNeighbor);
-    if (*kAvailableAmount == TrustLine::kZeroAmount()) {
+    if (kAvailableAmount == TrustLine::kZeroAmount()) {
         warning() << "Available amount equals zero. Reservation reject.";
         sendMessage<IntermediateNodeReservationResponseMessage>(
             kNeighbor,
@@ -266,10 +266,10 @@ TransactionResult::SharedConst ReceiverPaymentTransaction::runAmountReservationS
             maxNetworkDelay((kMaxPathLength - 1) * 4));
     }
 
-    debug() << "Available amount " << *kAvailableAmount;
+    debug() << "Available amount " << kAvailableAmount;
     const auto kReservationAmount = min(
         *kReservation.second.get(),
-        *kAvailableAmount);
+        kAvailableAmount);
 
 #ifdef TESTS
     if (kMessage->senderUUID == mMessage->senderUUID) {
@@ -368,7 +368,7 @@ TransactionResult::SharedConst ReceiverPaymentTransaction::runAmountReservationS
     }
 }
 
-TransactionResult::SharedConst ReceiverPaymentTransaction::runClarificationOfTransactionBeforeVoting()
+TransactionResult ReceiverPaymentTransaction::runClarificationOfTransactionBeforeVoting()
 {
     debug() << "runClarificationOfTransactionBeforeVoting";
     if (contextIsValid(Message::Payments_IntermediateNodeReservationRequest, false)) {
@@ -392,7 +392,7 @@ TransactionResult::SharedConst ReceiverPaymentTransaction::runClarificationOfTra
     return reject("Coordinator send TTL message with transaction finish state. Rolling Back");
 }
 
-TransactionResult::SharedConst ReceiverPaymentTransaction::runFinalAmountsConfigurationConfirmation()
+TransactionResult ReceiverPaymentTransaction::runFinalAmountsConfigurationConfirmation()
 {
     debug() << "runFinalAmountsConfigurationConfirmation";
     if (contextIsValid(Message::Payments_IntermediateNodeReservationRequest, false)) {
@@ -438,7 +438,7 @@ TransactionResult::SharedConst ReceiverPaymentTransaction::runFinalAmountsConfig
         maxNetworkDelay(2));
 }
 
-TransactionResult::SharedConst ReceiverPaymentTransaction::runFinalReservationsCoordinatorConfirmation()
+TransactionResult ReceiverPaymentTransaction::runFinalReservationsCoordinatorConfirmation()
 {
     debug() << "runFinalReservationsCoordinatorConfirmation";
 #ifdef TESTS
@@ -505,7 +505,7 @@ TransactionResult::SharedConst ReceiverPaymentTransaction::runFinalReservationsC
         maxNetworkDelay(2));
 }
 
-TransactionResult::SharedConst ReceiverPaymentTransaction::runFinalReservationsNeighborConfirmation()
+TransactionResult ReceiverPaymentTransaction::runFinalReservationsNeighborConfirmation()
 {
     debug() << "runFinalReservationsNeighborConfirmation";
     auto kMessage = popNextMessage<ReservationsInRelationToNodeMessage>();
@@ -555,7 +555,7 @@ TransactionResult::SharedConst ReceiverPaymentTransaction::runFinalReservationsN
         maxNetworkDelay(2));
 }
 
-TransactionResult::SharedConst ReceiverPaymentTransaction::runClarificationOfTransactionDuringFinalAmountsClarification()
+TransactionResult ReceiverPaymentTransaction::runClarificationOfTransactionDuringFinalAmountsClarification()
 {
     debug() << "runClarificationOfTransactionDuringFinalAmountsClarification";
     if (contextIsValid(Message::Payments_IntermediateNodeReservationRequest, false)) {
@@ -585,7 +585,7 @@ TransactionResult::SharedConst ReceiverPaymentTransaction::runClarificationOfTra
     return reject("Coordinator send TTL message with transaction finish state. Rolling Back");
 }
 
-TransactionResult::SharedConst ReceiverPaymentTransaction::runVotesCheckingStageWithCoordinatorClarification()
+TransactionResult ReceiverPaymentTransaction::runVotesCheckingStageWithCoordinatorClarification()
 {
     debug() << "runVotesCheckingStageWithCoordinatorClarification";
 
@@ -625,7 +625,7 @@ TransactionResult::SharedConst ReceiverPaymentTransaction::runVotesCheckingStage
         maxNetworkDelay(2));
 }
 
-TransactionResult::SharedConst ReceiverPaymentTransaction::runClarificationOfTransactionDuringVoting()
+TransactionResult ReceiverPaymentTransaction::runClarificationOfTransactionDuringVoting()
 {
     // on this stage we can also receive and ParticipantsVotes messages
     // and on this cases we process it properly
@@ -666,7 +666,7 @@ TransactionResult::SharedConst ReceiverPaymentTransaction::runClarificationOfTra
     return reject("Coordinator send TTL message with transaction finish state. Rolling Back");
 }
 
-TransactionResult::SharedConst ReceiverPaymentTransaction::approve()
+TransactionResult ReceiverPaymentTransaction::approve()
 {
     mCommittedAmount = totalReservedAmount(
         AmountReservation::Incoming);
@@ -684,7 +684,7 @@ void ReceiverPaymentTransaction::savePaymentOperationIntoHistory(
             PaymentRecord::PaymentOperationType::IncomingPaymentType,
             mParticipantsVotesMessage->coordinatorUUID(),
             mCommittedAmount,
-            *mTrustLines->totalBalance().get()));
+            mTrustLines->totalBalance()));
     debug() << "Operation saved";
 }
 
@@ -40,7 +40,7 @@ public:
         Logger &log,
         SubsystemsController *subsystemsController);
 
-    TransactionResult::SharedConst run()
+    TransactionResult run()
         noexcept;
 
     /**
@@ -53,28 +53,28 @@ protected:
      * reaction on initialization request from coordinator node,
      * check if transaction can be runned and send response message
      */
-    TransactionResult::SharedConst runInitialisationStage();
+    TransactionResult runInitialisationStage();
 
     /**
      * reaction on reservation request message from previous node on processed path
      * try reserve requested incoming amount and send reservation response
      */
-    TransactionResult::SharedConst runAmountReservationStage();
+    TransactionResult runAmountReservationStage();
 
     /**
      * reaction on response TTL message from coordinator
      * before receiving participants votes message,
      * if no message received, reject this transaction
      */
-    TransactionResult::SharedConst runClarificationOfTransactionBeforeVoting();
+    TransactionResult runClarificationOfTransactionBeforeVoting();
 
-    TransactionResult::SharedConst runFinalAmountsConfigurationConfirmation();
+    TransactionResult runFinalAmountsConfigurationConfirmation();
 
-    TransactionResult::SharedConst runFinalReservationsCoordinatorConfirmation();
+    TransactionResult runFinalReservationsCoordinatorConfirmation();
 
-    TransactionResult::SharedConst runFinalReservationsNeighborConfirmation();
+    TransactionResult runFinalReservationsNeighborConfirmation();
 
-    TransactionResult::SharedConst runClarificationOfTransactionDuringFinalAmountsClarification();
+    TransactionResult runClarificationOfTransactionDuringFinalAmountsClarification();
 
     /**
      * reaction on receiving participants votes message firstly
@@ -82,19 +82,19 @@ protected:
      * if no message received then send message (TTL)
      * to coordinator with request if transaction is still alive
      */
-    TransactionResult::SharedConst runVotesCheckingStageWithCoordinatorClarification();
+    TransactionResult runVotesCheckingStageWithCoordinatorClarification();
 
     /**
      * reaction on response TTL message from coordinator
      * after receiving participants votes message
      * if no message received, reject this transaction
      */
-    TransactionResult::SharedConst runClarificationOfTransactionDuringVoting();
+    TransactionResult runClarificationOfTransactionDuringVoting();
 
 protected:
     // Receiver must must save payment operation into history.
     // Therefore this methods are overridden.
-    TransactionResult::SharedConst approve();
+    TransactionResult approve();
 
 protected:
     /**
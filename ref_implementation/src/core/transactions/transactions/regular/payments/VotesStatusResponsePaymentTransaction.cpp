@@ -24,7 +24,7 @@ VotesStatusResponsePaymentTransaction::VotesStatusResponsePaymentTransaction(
     mIsRequestedTransactionCurrentlyRunned(isRequestedTransactionCurrentlyRunned)
 {}
 
-TransactionResult::SharedConst VotesStatusResponsePaymentTransaction::run()
+TransactionResult VotesStatusResponsePaymentTransaction::run()
 {
     debug() << "run";
     if (mIsRequestedTransactionCurrentlyRunned) {
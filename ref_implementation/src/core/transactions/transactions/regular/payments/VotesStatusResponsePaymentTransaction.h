@@ -25,7 +25,7 @@ public:
         bool isRequestedTransactionCurrentlyRunned,
         Logger &logger);
 
-    TransactionResult::SharedConst run();
+    TransactionResult run();
 
 protected:
     const string logHeader() const;
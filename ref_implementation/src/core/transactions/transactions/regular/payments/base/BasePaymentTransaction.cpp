@@ -195,7 +195,7 @@ BasePaymentTransaction::BasePaymentTransaction(
  * Handles votes list message receiving or it's absence.
  * Controls transaction approving/rejecting/rolling back.
  */
-TransactionResult::SharedConst BasePaymentTransaction::runVotesCheckingStage()
+TransactionResult BasePaymentTransaction::runVotesCheckingStage()
 {
     debug() << "runVotesCheckingStage";
     // Votes message may be received twice:
@@ -337,7 +337,7 @@ TransactionResult::SharedConst BasePaymentTransaction::runVotesCheckingStage()
  * In this case transaction can't be simply cancelled,
  * it must be recovered through recover mechanism to keep data integrity.
  */
-TransactionResult::SharedConst BasePaymentTransaction::runVotesConsistencyCheckingStage()
+TransactionResult BasePaymentTransaction::runVotesConsistencyCheckingStage()
 {
     debug() << "runVotesConsistencyCheckingStage";
 
@@ -493,7 +493,7 @@ const bool BasePaymentTransaction::contextIsValid(
  * WARN:
  * This method must be overloaded on the coordinator side.
  */
-TransactionResult::SharedConst BasePaymentTransaction::reject(
+TransactionResult BasePaymentTransaction::reject(
     const char *message)
 {
     if (message)
@@ -531,7 +531,7 @@ TransactionResult::SharedConst BasePaymentTransaction::reject(
  * WARN:
  * This method must be overloaded on the coordinator side.
  */
-TransactionResult::SharedConst BasePaymentTransaction::approve()
+TransactionResult BasePaymentTransaction::approve()
 {
     debug() << "Transaction approved. Committing.";
     auto ioTransaction = mStorageHandler->beginTransaction();
@@ -670,7 +670,7 @@ void BasePaymentTransaction::rollBack (
     }
 }
 
-TransactionResult::SharedConst BasePaymentTransaction::recover (
+TransactionResult BasePaymentTransaction::recover (
     const char *message)
 {
     debug() << "recover";
@@ -924,7 +924,7 @@ bool BasePaymentTransaction::checkOldAndNewParticipants(
     return true;
 }
 
-TransactionResult::SharedConst BasePaymentTransaction::runVotesRecoveryParentStage()
+TransactionResult BasePaymentTransaction::runVotesRecoveryParentStage()
 {
     debug() << "runVotesRecoveryParentStage";
     switch (mVotesRecoveryStep) {
@@ -942,7 +942,7 @@ TransactionResult::SharedConst BasePaymentTransaction::runVotesRecoveryParentSta
     }
 }
 
-TransactionResult::SharedConst BasePaymentTransaction::sendVotesRequestMessageAndWaitForResponse(
+TransactionResult BasePaymentTransaction::sendVotesRequestMessageAndWaitForResponse(
     const NodeUUID &contractorUUID)
 {
     debug() << "sendVotesRequestMessageAndWaitForResponse";
@@ -960,7 +960,7 @@ TransactionResult::SharedConst BasePaymentTransaction::sendVotesRequestMessageAn
         maxNetworkDelay(2));
 }
 
-TransactionResult::SharedConst BasePaymentTransaction::runPrepareListNodesToCheckNodes()
+TransactionResult BasePaymentTransaction::runPrepareListNodesToCheckNodes()
 {
     debug() << "runPrepareListNodesToCheckNodes";
     // Add all nodes that could be asked for Votes Status.
@@ -980,7 +980,7 @@ TransactionResult::SharedConst BasePaymentTransaction::runPrepareListNodesToChec
     return sendVotesRequestMessageAndWaitForResponse(kCoordinatorUUID);
 }
 
-TransactionResult::SharedConst BasePaymentTransaction::runCheckCoordinatorVotesStage()
+TransactionResult BasePaymentTransaction::runCheckCoordinatorVotesStage()
 {
     debug() << "runCheckCoordinatorVotesStage";
     if (!contextIsValid(Message::Payments_ParticipantsVotes, false)) {
@@ -1031,7 +1031,7 @@ TransactionResult::SharedConst BasePaymentTransaction::runCheckCoordinatorVotesS
     return processNextNodeToCheckVotes();
 }
 
-TransactionResult::SharedConst BasePaymentTransaction::runCheckIntermediateNodeVotesStage()
+TransactionResult BasePaymentTransaction::runCheckIntermediateNodeVotesStage()
 {
     debug() << "runCheckIntermediateNodeVotesStage";
     if (!contextIsValid(Message::Payments_ParticipantsVotes, false)) {
@@ -1075,7 +1075,7 @@ TransactionResult::SharedConst BasePaymentTransaction::runCheckIntermediateNodeV
     return processNextNodeToCheckVotes();
 }
 
-TransactionResult::SharedConst BasePaymentTransaction::processNextNodeToCheckVotes()
+TransactionResult BasePaymentTransaction::processNextNodeToCheckVotes()
 {
     debug() << "processNextNodeToCheckVotes";
     if (mNodesToCheckVotes.empty()) {
@@ -1092,7 +1092,7 @@ TransactionResult::SharedConst BasePaymentTransaction::processNextNodeToCheckVot
         mCurrentNodeToCheckVotes);
 }
 
-TransactionResult::SharedConst BasePaymentTransaction::runRollbackByOtherTransactionStage()
+TransactionResult BasePaymentTransaction::runRollbackByOtherTransactionStage()
 {
     debug() << "runRollbackByOtherTransactionStage";
     rollBack();
@@ -155,54 +155,54 @@ protected:
      * reaction on receiving participants votes message firstly
      * add own vote to message and send it to next participant
      */
-    virtual TransactionResult::SharedConst runVotesCheckingStage();
+    virtual TransactionResult runVotesCheckingStage();
 
     /**
      * reaction on receiving participants votes message with result of voting
      * on this stage node can commit transaction or reject it
      */
-    virtual TransactionResult::SharedConst runVotesConsistencyCheckingStage();
+    virtual TransactionResult runVotesConsistencyCheckingStage();
 
     // approving of transaction
-    virtual TransactionResult::SharedConst approve();
+    virtual TransactionResult approve();
     // recovering of transaction
-    virtual TransactionResult::SharedConst recover(
+    virtual TransactionResult recover(
         const char *message = nullptr);
     // rejecting of transaction
-    virtual TransactionResult::SharedConst reject(
+    virtual TransactionResult reject(
         const char *message = nullptr);
 
     /**
      * starts recovery process
      */
-    TransactionResult::SharedConst runVotesRecoveryParentStage();
+    TransactionResult runVotesRecoveryParentStage();
 
     /**
      * send message to specified node to get result of recovered transaction
      * @param contractorUUID node to which message will be sent
      */
-    TransactionResult::SharedConst sendVotesRequestMessageAndWaitForResponse(
+    TransactionResult sendVotesRequestMessageAndWaitForResponse(
         const NodeUUID &contractorUUID);
 
     /**
      * prepare list of nodes which will be asked about result of recovered transaction
      */
-    TransactionResult::SharedConst runPrepareListNodesToCheckNodes();
+    TransactionResult runPrepareListNodesToCheckNodes();
 
     /**
      * process response of coordinator node with result of recovered transaction
      */
-    TransactionResult::SharedConst runCheckCoordinatorVotesStage();
+    TransactionResult runCheckCoordinatorVotesStage();
 
     /**
      * process response of intermediate node with result of recovered transaction
      */
-    TransactionResult::SharedConst runCheckIntermediateNodeVotesStage();
+    TransactionResult runCheckIntermediateNodeVotesStage();
 
     /**
      * rollback current transaction because of cycle closing conflict
      */
-    TransactionResult::SharedConst runRollbackByOtherTransactionStage();
+    TransactionResult runRollbackByOtherTransactionStage();
 
 protected:
     /**
@@ -346,7 +346,7 @@ protected:
      * process next node in participants votes message during recovery stage
      * @return result of transaction
      */
-    TransactionResult::SharedConst processNextNodeToCheckVotes();
+    TransactionResult processNextNodeToCheckVotes();
 
     /**
      * @param reservationDirection direction (outgoing or incoming) total amount of which will be returned
@@ -9,14 +9,14 @@
 
 #include "TransactionResult.h"
 
-TransactionResult::TransactionResult()
+TransactionResult::TransactionResult() :
+    mTransactionState(TransactionState::exit())
 {}
 
 TransactionResult::TransactionResult(
-    TransactionState::SharedConst transactionState)
-{
-    setTransactionState(transactionState);
-}
+    const TransactionState &transactionState) :
+    mTransactionState(transactionState)
+{}
 
 void TransactionResult::setCommandResult(
     CommandResult::SharedConst commandResult)
@@ -25,7 +25,7 @@ void TransactionResult::setCommandResult(
 }
 
 void TransactionResult::setTransactionState(
-    TransactionState::SharedConst transactionState)
+    const TransactionState &transactionState)
 {
     mTransactionState = transactionState;
 }
@@ -35,7 +35,7 @@ CommandResult::SharedConst TransactionResult::commandResult() const
     return mCommandResult;
 }
 
-TransactionState::SharedConst TransactionResult::state() const
+const TransactionState& TransactionResult::state() const
 {
     return mTransactionState;
 }
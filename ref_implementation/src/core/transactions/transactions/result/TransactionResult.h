@@ -20,10 +20,6 @@
 using namespace std;
 
 class TransactionResult {
-public:
-    typedef shared_ptr<TransactionResult> Shared;
-    typedef shared_ptr<const TransactionResult> SharedConst;
-
 public:
     enum ResultType {
         CommandResultType = 1,
@@ -34,22 +30,23 @@ public:
     TransactionResult();
 
     TransactionResult(
-        TransactionState::SharedConst transactionState);
+        const TransactionState &transactionState);
 
     void setCommandResult(
         CommandResult::SharedConst commandResult);
 
     void setTransactionState(
-        TransactionState::SharedConst transactionState);
+        const TransactionState &transactionState);
 
     CommandResult::SharedConst commandResult() const;
 
-    TransactionState::SharedConst state() const;
+    const TransactionState& state() const;
 
     ResultType resultType() const;
 
 private:
     CommandResult::SharedConst mCommandResult;
-    TransactionState::SharedConst mTransactionState;
+    // State is stored inline, so the result is a plain value and is returned without allocations.
+    TransactionState mTransactionState;
 };
 #endif //GEO_NETWORK_CLIENT_TRANSACTIONRESULT_H
@@ -9,17 +9,21 @@
 
 #include "TransactionState.h"
 
+#include "../../../../common/exceptions/ValueError.h"
+
 TransactionState::TransactionState(
     Message::MessageType requiredMessageType,
     bool flushToPermanentStorage,
     bool awakeOnMessage) :
 
     mAwakeningTimestamp(0),
+    mRequiredMessageTypesCount(0),
+    mRequiredResourcesTypes(0),
     mFlushToPermanentStorage(flushToPermanentStorage),
     mMustBeAwakenedOnMessage(awakeOnMessage),
     mMustSavePreviousStateState(false)
 {
-    mRequiredMessageTypes.push_back(requiredMessageType);
+    addAcceptedMessageType(requiredMessageType);
 }
 
 TransactionState::TransactionState(
@@ -27,9 +31,11 @@ TransactionState::TransactionState(
     bool flushToPermanentStorage,
     bool awakeOnMessage) :
 
+    mAwakeningTimestamp(awakeningTimestamp),
+    mRequiredMessageTypesCount(0),
+    mRequiredResourcesTypes(0),
     mFlushToPermanentStorage(flushToPermanentStorage),
     mMustBeAwakenedOnMessage(awakeOnMessage),
-    mAwakeningTimestamp(awakeningTimestamp),
     mMustSavePreviousStateState(false)
 {}
 
@@ -39,17 +45,24 @@ TransactionState::TransactionState(
     bool flushToPermanentStorage,
     bool awakeOnMessage) :
 
+    mAwakeningTimestamp(awakeningTimestamp),
+    mRequiredMessageTypesCount(0),
+    mRequiredResourcesTypes(0),
     mFlushToPermanentStorage(flushToPermanentStorage),
     mMustBeAwakenedOnMessage(awakeOnMessage),
-    mAwakeningTimestamp(awakeningTimestamp),
     mMustSavePreviousStateState(false)
 {
-    mRequiredMessageTypes.push_back(requiredMessageType);
+    addAcceptedMessageType(requiredMessageType);
 }
 
 TransactionState::TransactionState(
     bool mustSavePreviousState) :
 
+    mAwakeningTimestamp(numeric_limits<GEOEpochTimestamp>::max()),
+    mRequiredMessageTypesCount(0),
+    mRequiredResourcesTypes(0),
+    mFlushToPermanentStorage(false),
+    mMustBeAwakenedOnMessage(false),
     mMustSavePreviousStateState(mustSavePreviousState)
 {}
 
@@ -60,15 +73,15 @@ TransactionState::TransactionState(
  * Do not use 0 as value for awakeningTimestamp.
  * It will break scheduler logic for choosing next transaction for execution.
  */
-TransactionState::SharedConst TransactionState::exit() {
+TransactionState TransactionState::exit() {
 
-    return make_shared<TransactionState>(
+    return TransactionState(
         numeric_limits<GEOEpochTimestamp>::max());
 }
 
-TransactionState::SharedConst TransactionState::flushAndContinue() {
+TransactionState TransactionState::flushAndContinue() {
 
-    return make_shared<TransactionState>(
+    return TransactionState(
         microsecondsSinceGEOEpoch(
             utc_now()),
         true);
@@ -77,9 +90,9 @@ TransactionState::SharedConst TransactionState::flushAndContinue() {
 /*!
  * Returns TransactionState with awakening timestamp set to current UTC;
  */
-TransactionState::SharedConst TransactionState::awakeAsFastAsPossible() {
+TransactionState TransactionState::awakeAsFastAsPossible() {
 
-    return make_shared<TransactionState>(
+    return TransactionState(
         microsecondsSinceGEOEpoch(
             utc_now()
         )
@@ -89,10 +102,10 @@ TransactionState::SharedConst TransactionState::awakeAsFastAsPossible() {
 /*!
  * Returns TransactionState with awakening timestamp set to current UTC + timeout;
  */
-TransactionState::SharedConst TransactionState::awakeAfterMilliseconds(
+TransactionState TransactionState::awakeAfterMilliseconds(
     uint32_t milliseconds) {
 
-    return make_shared<TransactionState>(
+    return TransactionState(
         microsecondsSinceGEOEpoch(
             utc_now() + pt::microseconds(milliseconds * 1000)
         )
@@ -103,70 +116,100 @@ TransactionState::SharedConst TransactionState::awakeAfterMilliseconds(
  * Returns TransactionState that specifies what kind of messages transaction is waiting and accepting.
  * Optionally, may be initialised with deadline timeout.
  */
-TransactionState::SharedConst TransactionState::waitForMessageTypes(
-    vector<Message::MessageType> &&requiredMessageType,
+TransactionState TransactionState::waitForMessageTypes(
+    initializer_list<Message::MessageType> requiredMessageType,
     uint32_t noLongerThanMilliseconds) {
 
-    TransactionState::Shared state;
-    if (noLongerThanMilliseconds == 0) {
-        state = const_pointer_cast<TransactionState> (TransactionState::exit());
+    TransactionState state(
+        awakeningTimestampAfterMilliseconds(noLongerThanMilliseconds));
 
-    } else {
-        state = const_pointer_cast<TransactionState> (TransactionState::awakeAfterMilliseconds(
-            noLongerThanMilliseconds
-        ));
+    for (const auto messageType : requiredMessageType) {
+        state.addAcceptedMessageType(messageType);
     }
-
-    state->mRequiredMessageTypes = requiredMessageType;
-
-    return const_pointer_cast<const TransactionState>(state);
+    return state;
 }
 
-TransactionState::SharedConst TransactionState::waitForMessageTypesAndAwakeAfterMilliseconds(
-    vector<Message::MessageType> &&requiredMessageType,
+TransactionState TransactionState::waitForMessageTypesAndAwakeAfterMilliseconds(
+    initializer_list<Message::MessageType> requiredMessageType,
     uint32_t noLongerThanMilliseconds)
 {
-    TransactionState::Shared state;
-    if (noLongerThanMilliseconds == 0) {
-        state = const_pointer_cast<TransactionState> (TransactionState::exit());
-
-    } else {
-        state = make_shared<TransactionState>(
-            microsecondsSinceGEOEpoch(
-                utc_now() + pt::microseconds(noLongerThanMilliseconds * 1000)),
-            false,
-            false);
+    TransactionState state(
+        awakeningTimestampAfterMilliseconds(noLongerThanMilliseconds),
+        false,
+        noLongerThanMilliseconds == 0);
+
+    for (const auto messageType : requiredMessageType) {
+        state.addAcceptedMessageType(messageType);
     }
+    return state;
+}
 
-    state->mRequiredMessageTypes = requiredMessageType;
+TransactionState TransactionState::waitForResourcesTypes(
+    initializer_list<BaseResource::ResourceType> requiredResourcesType,
+    uint32_t noLongerThanMilliseconds) {
+
+    TransactionState state(
+        awakeningTimestampAfterMilliseconds(noLongerThanMilliseconds));
 
-    return const_pointer_cast<const TransactionState>(state);
+    for (const auto resourceType : requiredResourcesType) {
+        state.mRequiredResourcesTypes |= resourceTypeFlag(resourceType);
+    }
+    return state;
 }
 
-TransactionState::SharedConst TransactionState::waitForResourcesTypes(
-    vector<BaseResource::ResourceType> &&requiredResourcesType,
-    uint32_t noLongerThanMilliseconds) {
+TransactionState TransactionState::continueWithPreviousState()
+{
+    return TransactionState(true);
+}
 
-    TransactionState::Shared state;
-    if (noLongerThanMilliseconds == 0) {
-        state = const_pointer_cast<TransactionState> (TransactionState::exit());
+/*!
+ * Returns awakening timestamp for the waiting states:
+ * current UTC + timeout, or no awakening at all in case if timeout is 0.
+ */
+GEOEpochTimestamp TransactionState::awakeningTimestampAfterMilliseconds(
+    uint32_t milliseconds)
+{
+    if (milliseconds == 0) {
+        return numeric_limits<GEOEpochTimestamp>::max();
+    }
+
+    return microsecondsSinceGEOEpoch(
+        utc_now() + pt::microseconds(milliseconds * 1000));
+}
 
-    } else {
-        state = const_pointer_cast<TransactionState> (TransactionState::awakeAfterMilliseconds(
-            noLongerThanMilliseconds
-        ));
+/*!
+ * Throws ValueError in case if state already accepts max count of messages types.
+ */
+void TransactionState::addAcceptedMessageType(
+    const Message::MessageType messageType)
+{
+    if (acceptsMessageType(messageType)) {
+        return;
     }
 
-    state->mRequiredResourcesTypes = requiredResourcesType;
+    if (mRequiredMessageTypesCount == kMaxAcceptedMessagesTypesCount) {
+        throw ValueError(
+            "TransactionState::addAcceptedMessageType: "
+                "too many accepted messages types.");
+    }
 
-    return const_pointer_cast<const TransactionState>(state);
+    mRequiredMessageTypes[mRequiredMessageTypesCount] = messageType;
+    ++mRequiredMessageTypesCount;
 }
 
-TransactionState::SharedConst TransactionState::continueWithPreviousState()
+/*!
+ * Throws ValueError in case if resource type can't be stored in the bitset.
+ */
+uint8_t TransactionState::resourceTypeFlag(
+    const BaseResource::ResourceType resourceType)
 {
-    TransactionState::Shared state;
-    state = make_shared<TransactionState>(true);
-    return const_pointer_cast<const TransactionState>(state);
+    if (resourceType < 0 or resourceType >= numeric_limits<uint8_t>::digits) {
+        throw ValueError(
+            "TransactionState::resourceTypeFlag: "
+                "unexpected resource type.");
+    }
+
+    return static_cast<uint8_t>(1u << resourceType);
 }
 
 const GEOEpochTimestamp TransactionState::awakeningTimestamp() const {
@@ -174,14 +217,32 @@ const GEOEpochTimestamp TransactionState::awakeningTimestamp() const {
     return mAwakeningTimestamp;
 }
 
-const vector<Message::MessageType>& TransactionState::acceptedMessagesTypes() const {
+TransactionState::AcceptedMessagesTypes TransactionState::acceptedMessagesTypes() const {
+
+    return AcceptedMessagesTypes(
+        mRequiredMessageTypes,
+        mRequiredMessageTypes + mRequiredMessageTypesCount);
+}
 
-    return mRequiredMessageTypes;
+bool TransactionState::acceptsMessageType(
+    const Message::MessageType messageType) const
+{
+    for (size_t i = 0; i < mRequiredMessageTypesCount; ++i) {
+        if (mRequiredMessageTypes[i] == messageType) {
+            return true;
+        }
+    }
+    return false;
 }
 
-const vector<BaseResource::ResourceType> &TransactionState::acceptedResourcesTypes() const {
+bool TransactionState::acceptsResourceType(
+    const BaseResource::ResourceType resourceType) const
+{
+    if (resourceType < 0 or resourceType >= numeric_limits<uint8_t>::digits) {
+        return false;
+    }
 
-    return mRequiredResourcesTypes;
+    return (mRequiredResourcesTypes & resourceTypeFlag(resourceType)) != 0;
 }
 
 const bool TransactionState::needSerialize() const {
@@ -192,7 +253,7 @@ const bool TransactionState::needSerialize() const {
 const bool TransactionState::mustBeRescheduled() const {
     return
         (mAwakeningTimestamp != numeric_limits<GEOEpochTimestamp>::max()) ||
-        (acceptedMessagesTypes().size() > 0);
+        (mRequiredMessageTypesCount > 0);
 }
 
 const bool TransactionState::mustExit() const {
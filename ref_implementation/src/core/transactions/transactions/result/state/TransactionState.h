@@ -17,41 +17,86 @@
 #include "boost/date_time.hpp"
 
 #include <stdint.h>
-#include <vector>
+#include <limits>
+#include <initializer_list>
 
 
 using namespace std;
 
 
+/*
+ * State of the transaction, that is returned from it's step,
+ * and is kept by the scheduler until the next step.
+ *
+ * It is a value type with no heap allocations:
+ * accepted messages types are stored inline (message types identifiers are sparse,
+ * but each state accepts only few of them), and accepted resources types are stored as a bitset.
+ */
 class TransactionState {
 public:
-    typedef shared_ptr<TransactionState> Shared;
-    typedef shared_ptr<const TransactionState> SharedConst;
+    // Max count of messages types, that may be accepted by one state.
+    static const constexpr size_t kMaxAcceptedMessagesTypesCount = 8;
+
+    /*
+     * Read-only view of the accepted messages types (is valid until the state is changed).
+     */
+    class AcceptedMessagesTypes {
+    public:
+        AcceptedMessagesTypes(
+            const Message::MessageType *begin,
+            const Message::MessageType *end)
+            noexcept :
+            mBegin(begin),
+            mEnd(end)
+        {}
+
+        const Message::MessageType* begin() const
+            noexcept
+        {
+            return mBegin;
+        }
+
+        const Message::MessageType* end() const
+            noexcept
+        {
+            return mEnd;
+        }
+
+        size_t size() const
+            noexcept
+        {
+            return mEnd - mBegin;
+        }
+
+    private:
+        const Message::MessageType *mBegin;
+        const Message::MessageType *mEnd;
+    };
 
 public:
     // Readable shortcuts for states creation.
-    static TransactionState::SharedConst exit();
+    static TransactionState exit();
 
-    static TransactionState::SharedConst flushAndContinue();
+    static TransactionState flushAndContinue();
 
-    static TransactionState::SharedConst awakeAsFastAsPossible();
+    static TransactionState awakeAsFastAsPossible();
 
-    static TransactionState::SharedConst awakeAfterMilliseconds(
+    static TransactionState awakeAfterMilliseconds(
         uint32_t milliseconds);
 
-    static TransactionState::SharedConst waitForMessageTypes(
-        vector<Message::MessageType> &&requiredMessageType,
+    static TransactionState waitForMessageTypes(
+        initializer_list<Message::MessageType> requiredMessageType,
         uint32_t noLongerThanMilliseconds = 0);
 
-    static TransactionState::SharedConst waitForMessageTypesAndAwakeAfterMilliseconds(
-        vector<Message::MessageType> &&requiredMessageType,
+    static TransactionState waitForMessageTypesAndAwakeAfterMilliseconds(
+        initializer_list<Message::MessageType> requiredMessageType,
         uint32_t noLongerThanMilliseconds = 0);
 
-    static TransactionState::SharedConst waitForResourcesTypes(
-        vector<BaseResource::ResourceType> &&requiredResourcesType,
+    static TransactionState waitForResourcesTypes(
+        initializer_list<BaseResource::ResourceType> requiredResourcesType,
         uint32_t noLongerThanMilliseconds = 0);
 
-    static TransactionState::SharedConst continueWithPreviousState();
+    static TransactionState continueWithPreviousState();
 
 public:
     TransactionState(
@@ -65,7 +110,7 @@ public:
         bool awakeOnMessage = true);
 
     TransactionState(
-        GEOEpochTimestamp awakeTimestamp,
+        GEOEpochTimestamp awakeningTimestamp,
         Message::MessageType requiredMessageType,
         bool flushToPermanentStorage = false,
         bool awakeOnMessage = true);
@@ -75,9 +120,13 @@ public:
 
     const GEOEpochTimestamp awakeningTimestamp() const;
 
-    const vector<Message::MessageType>& acceptedMessagesTypes() const;
+    AcceptedMessagesTypes acceptedMessagesTypes() const;
 
-    const vector<BaseResource::ResourceType>& acceptedResourcesTypes() const;
+    bool acceptsMessageType(
+        const Message::MessageType messageType) const;
+
+    bool acceptsResourceType(
+        const BaseResource::ResourceType resourceType) const;
 
     const bool needSerialize() const;
 
@@ -89,10 +138,22 @@ public:
 
     const bool mustSavePreviousStateState() const;
 
+private:
+    static GEOEpochTimestamp awakeningTimestampAfterMilliseconds(
+        uint32_t milliseconds);
+
+    void addAcceptedMessageType(
+        const Message::MessageType messageType);
+
+    static uint8_t resourceTypeFlag(
+        const BaseResource::ResourceType resourceType);
+
 private:
     GEOEpochTimestamp mAwakeningTimestamp;
-    vector<Message::MessageType> mRequiredMessageTypes;
-    vector<BaseResource::ResourceType> mRequiredResourcesTypes;
+    Message::MessageType mRequiredMessageTypes[kMaxAcceptedMessagesTypesCount];
+    uint8_t mRequiredMessageTypesCount;
+    // One bit per resource type.
+    uint8_t mRequiredResourcesTypes;
     bool mFlushToPermanentStorage;
     bool mMustBeAwakenedOnMessage;
     // if this field is true, then transaction after running method run save state,
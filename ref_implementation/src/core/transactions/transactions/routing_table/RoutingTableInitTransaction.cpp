@@ -25,7 +25,7 @@ RoutingTableInitTransaction::RoutingTableInitTransaction(
     mLog(logger)
 {}
 
-TransactionResult::SharedConst RoutingTableInitTransaction::run() {
+TransactionResult RoutingTableInitTransaction::run() {
     while (true) {
         debug() << "run: stage: " << mStep;
         try {
@@ -48,7 +48,7 @@ TransactionResult::SharedConst RoutingTableInitTransaction::run() {
     }
 }
 
-TransactionResult::SharedConst RoutingTableInitTransaction::runCollectDataStage() {
+TransactionResult RoutingTableInitTransaction::runCollectDataStage() {
     auto neighbors = mTrustlineManager->rt1();
     for(const auto &kNeighborNode: neighbors){
         sendMessage<RoutingTableRequestMessage>(
@@ -65,7 +65,7 @@ const string RoutingTableInitTransaction::logHeader() const {
     return s.str();
 }
 
-TransactionResult::SharedConst RoutingTableInitTransaction::runUpdateRoutingTableStage()
+TransactionResult RoutingTableInitTransaction::runUpdateRoutingTableStage()
 {
     if (mContext.empty()){
         info() << "No responses from neighbors. RoutingTable will not be updated." << endl;
@@ -25,11 +25,11 @@ public:
         RoutingTableManager *routingTableManager,
         Logger &logger);
 
-    TransactionResult::SharedConst run();
+    TransactionResult run();
 
 protected:
-    TransactionResult::SharedConst runCollectDataStage();
-    TransactionResult::SharedConst runUpdateRoutingTableStage();
+    TransactionResult runCollectDataStage();
+    TransactionResult runUpdateRoutingTableStage();
 
 protected:
     enum Stages {
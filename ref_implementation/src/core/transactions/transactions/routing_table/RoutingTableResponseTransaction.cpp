@@ -30,7 +30,7 @@ const string RoutingTableResponseTransaction::logHeader() const
     return s.str();
 }
 
-TransactionResult::SharedConst RoutingTableResponseTransaction::run()
+TransactionResult RoutingTableResponseTransaction::run()
 {
     if(!mTrustLinesManager->isNeighbor(mRequestMessage->senderUUID)){
         warning() << mRequestMessage->senderUUID << " is not a neighbor. Finish transaction;";
@@ -28,7 +28,7 @@ TotalBalancesCommand::Shared TotalBalancesTransaction::command() const
     return mCommand;
 }
 
-TransactionResult::SharedConst TotalBalancesTransaction::run()
+TransactionResult TotalBalancesTransaction::run()
 {
     TrustLineAmount totalIncomingTrust = 0;
     TrustLineAmount totalTrustUsedByContractor = 0;
@@ -42,14 +42,11 @@ TransactionResult::SharedConst TotalBalancesTransaction::run()
                  nodeUUIDAndTrustLine.first) == mCommand->gateways().end()) {
             totalOutgoingTrust += nodeUUIDAndTrustLine.second->outgoingTrustAmount();
         } else {
-            auto totalOutgoingTrustUsedShared = nodeUUIDAndTrustLine.second->usedAmountByContractor();
-            totalOutgoingTrust += *totalOutgoingTrustUsedShared.get();
+            totalOutgoingTrust += nodeUUIDAndTrustLine.second->usedAmountByContractor();
         }
         totalIncomingTrust += nodeUUIDAndTrustLine.second->incomingTrustAmount();
-        auto totalOutgoingTrustUsedShared = nodeUUIDAndTrustLine.second->usedAmountByContractor();
-        totalTrustUsedByContractor += *totalOutgoingTrustUsedShared.get();
-        auto totalIncomingTrustUsedShared = nodeUUIDAndTrustLine.second->usedAmountBySelf();
-        totalTrustUsedBySelf += *totalIncomingTrustUsedShared.get();
+        totalTrustUsedByContractor += nodeUUIDAndTrustLine.second->usedAmountByContractor();
+        totalTrustUsedBySelf += nodeUUIDAndTrustLine.second->usedAmountBySelf();
     }
 
     return resultOk(
@@ -59,7 +56,7 @@ TransactionResult::SharedConst TotalBalancesTransaction::run()
         totalTrustUsedBySelf);
 }
 
-TransactionResult::SharedConst TotalBalancesTransaction::resultOk(
+TransactionResult TotalBalancesTransaction::resultOk(
     const TrustLineAmount &totalIncomingTrust,
     const TrustLineAmount &totalTrustUsedByContractor,
     const TrustLineAmount &totalOutgoingTrust,
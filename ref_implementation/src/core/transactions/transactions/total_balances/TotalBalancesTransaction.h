@@ -28,13 +28,13 @@ public:
 
     TotalBalancesCommand::Shared command() const;
 
-    TransactionResult::SharedConst run();
+    TransactionResult run();
 
 protected:
     const string logHeader() const;
 
 private:
-    TransactionResult::SharedConst resultOk(
+    TransactionResult resultOk(
         const TrustLineAmount &totalIncomingTrust,
         const TrustLineAmount &totalTrustUsedByContractor,
         const TrustLineAmount &totalOutgoingTrust,
@@ -28,7 +28,7 @@ PaymentTransactionByCommandUUIDCommand::Shared PaymentTransactionByCommandUUIDTr
     return mCommand;
 }
 
-TransactionResult::SharedConst PaymentTransactionByCommandUUIDTransaction::run()
+TransactionResult PaymentTransactionByCommandUUIDTransaction::run()
 {
     stringstream stream;
     if (mRequestedPaymentTransaction == nullptr) {
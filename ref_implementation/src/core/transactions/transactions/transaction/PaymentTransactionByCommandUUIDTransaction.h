@@ -27,13 +27,13 @@ public:
 
     PaymentTransactionByCommandUUIDCommand::Shared command() const;
 
-    TransactionResult::SharedConst run();
+    TransactionResult run();
 
 protected:
     const string logHeader() const;
 
 private:
-    TransactionResult::SharedConst resultOk(
+    TransactionResult resultOk(
         string &transactionUUIDStr);
 
 private:
@@ -32,7 +32,7 @@ CloseIncomingTrustLineTransaction::CloseIncomingTrustLineTransaction(
     mSubsystemsController(subsystemsController)
 {}
 
-TransactionResult::SharedConst CloseIncomingTrustLineTransaction::run()
+TransactionResult CloseIncomingTrustLineTransaction::run()
 {
     if (!mSubsystemsController->isRunTrustLineTransactions()) {
         debug() << "It is forbidden run trust line transactions";
@@ -101,19 +101,19 @@ TransactionResult::SharedConst CloseIncomingTrustLineTransaction::run()
     }
 }
 
-TransactionResult::SharedConst CloseIncomingTrustLineTransaction::resultOK()
+TransactionResult CloseIncomingTrustLineTransaction::resultOK()
 {
     return transactionResultFromCommand(
         mCommand->responseOK());
 }
 
-TransactionResult::SharedConst CloseIncomingTrustLineTransaction::resultForbiddenRun()
+TransactionResult CloseIncomingTrustLineTransaction::resultForbiddenRun()
 {
     return transactionResultFromCommand(
         mCommand->responseForbiddenRunTransaction());
 }
 
-TransactionResult::SharedConst CloseIncomingTrustLineTransaction::resultProtocolError()
+TransactionResult CloseIncomingTrustLineTransaction::resultProtocolError()
 {
     return transactionResultFromCommand(
         mCommand->responseProtocolError());
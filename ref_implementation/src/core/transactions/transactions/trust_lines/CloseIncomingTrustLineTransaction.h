@@ -36,14 +36,14 @@ public:
         Logger &logger)
     noexcept;
 
-    TransactionResult::SharedConst run();
+    TransactionResult run();
 
 protected:
-    TransactionResult::SharedConst resultOK();
+    TransactionResult resultOK();
 
-    TransactionResult::SharedConst resultForbiddenRun();
+    TransactionResult resultForbiddenRun();
 
-    TransactionResult::SharedConst resultProtocolError();
+    TransactionResult resultProtocolError();
 
 protected: // trust lines history shortcuts
     void populateHistory(
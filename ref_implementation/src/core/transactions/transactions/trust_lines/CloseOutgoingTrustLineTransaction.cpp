@@ -31,7 +31,7 @@ CloseOutgoingTrustLineTransaction::CloseOutgoingTrustLineTransaction(
     mMaxFlowCalculationNodeCacheManager(maxFlowCalculationNodeCacheManager)
 {}
 
-TransactionResult::SharedConst CloseOutgoingTrustLineTransaction::run()
+TransactionResult CloseOutgoingTrustLineTransaction::run()
 {
     const auto kContractor = mMessage->senderUUID;
 
@@ -97,9 +97,9 @@ TransactionResult::SharedConst CloseOutgoingTrustLineTransaction::run()
     }
 }
 
-TransactionResult::SharedConst CloseOutgoingTrustLineTransaction::resultDone()
+TransactionResult CloseOutgoingTrustLineTransaction::resultDone()
 {
-    return make_shared<TransactionResult>(
+    return TransactionResult(
         TransactionState::exit());
 }
 
@@ -27,7 +27,7 @@ RejectOutgoingTrustLineTransaction::RejectOutgoingTrustLineTransaction(
     mStorageHandler(storageHandler)
 {}
 
-TransactionResult::SharedConst RejectOutgoingTrustLineTransaction::run()
+TransactionResult RejectOutgoingTrustLineTransaction::run()
 {
     const auto kContractor = mMessage->senderUUID;
 
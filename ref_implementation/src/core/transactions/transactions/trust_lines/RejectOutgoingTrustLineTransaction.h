@@ -30,7 +30,7 @@ public:
         Logger &logger)
     noexcept;
 
-    TransactionResult::SharedConst run();
+    TransactionResult run();
 
 protected:
     const string logHeader() const
@@ -60,7 +60,7 @@ SetIncomingTrustLineTransaction::SetIncomingTrustLineTransaction(
     mSenderIsGateway(true)
 {}
 
-TransactionResult::SharedConst SetIncomingTrustLineTransaction::run()
+TransactionResult SetIncomingTrustLineTransaction::run()
 {
     const auto kContractor = mMessage->senderUUID;
 
@@ -219,9 +219,9 @@ TransactionResult::SharedConst SetIncomingTrustLineTransaction::run()
     }
 }
 
-TransactionResult::SharedConst SetIncomingTrustLineTransaction::resultDone()
+TransactionResult SetIncomingTrustLineTransaction::resultDone()
 {
-    return make_shared<TransactionResult>(
+    return TransactionResult(
         TransactionState::exit());
 }
 
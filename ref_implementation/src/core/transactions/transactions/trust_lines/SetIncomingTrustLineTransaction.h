@@ -63,10 +63,10 @@ public:
         Logger &logger)
     noexcept;
 
-    TransactionResult::SharedConst run();
+    TransactionResult run();
 
 protected:
-    TransactionResult::SharedConst resultDone();
+    TransactionResult resultDone();
 
 protected: // trust lines history shortcuts
     void populateHistory(
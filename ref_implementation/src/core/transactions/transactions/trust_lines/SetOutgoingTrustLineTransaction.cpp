@@ -35,7 +35,7 @@ SetOutgoingTrustLineTransaction::SetOutgoingTrustLineTransaction(
     mIAmGateway(iAmGateway)
 {}
 
-TransactionResult::SharedConst SetOutgoingTrustLineTransaction::run()
+TransactionResult SetOutgoingTrustLineTransaction::run()
 {
     if (!mSubsystemsController->isRunTrustLineTransactions()) {
         debug() << "It is forbidden run trust line transactions";
@@ -181,19 +181,19 @@ TransactionResult::SharedConst SetOutgoingTrustLineTransaction::run()
     }
 }
 
-TransactionResult::SharedConst SetOutgoingTrustLineTransaction::resultOK()
+TransactionResult SetOutgoingTrustLineTransaction::resultOK()
 {
     return transactionResultFromCommand(
         mCommand->responseOK());
 }
 
-TransactionResult::SharedConst SetOutgoingTrustLineTransaction::resultForbiddenRun()
+TransactionResult SetOutgoingTrustLineTransaction::resultForbiddenRun()
 {
     return transactionResultFromCommand(
         mCommand->responseForbiddenRunTransaction());
 }
 
-TransactionResult::SharedConst SetOutgoingTrustLineTransaction::resultProtocolError()
+TransactionResult SetOutgoingTrustLineTransaction::resultProtocolError()
 {
     return transactionResultFromCommand(
         mCommand->responseProtocolError());
@@ -27,7 +27,7 @@ GetTrustLineCommand::Shared GetFirstLevelContractorBalanceTransaction::command()
     return mCommand;
 }
 
-TransactionResult::SharedConst GetFirstLevelContractorBalanceTransaction::run() {
+TransactionResult GetFirstLevelContractorBalanceTransaction::run() {
     stringstream ss;
     auto contractorUUID = mCommand->contractorUUID();
     if (!mTrustLinesManager->isNeighbor(contractorUUID)) {
@@ -45,7 +45,7 @@ TransactionResult::SharedConst GetFirstLevelContractorBalanceTransaction::run()
             kResultInfo));
 }
 
-TransactionResult::SharedConst GetFirstLevelContractorBalanceTransaction::resultTrustLineIsAbsent()
+TransactionResult GetFirstLevelContractorBalanceTransaction::resultTrustLineIsAbsent()
 {
     return transactionResultFromCommand(
         mCommand->responseTrustlineIsAbsent());
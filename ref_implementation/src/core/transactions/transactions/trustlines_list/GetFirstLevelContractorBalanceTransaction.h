@@ -32,9 +32,9 @@ public:
 
     GetTrustLineCommand::Shared command() const;
 
-    TransactionResult::SharedConst run();
+    TransactionResult run();
 
-    TransactionResult::SharedConst resultTrustLineIsAbsent();
+    TransactionResult resultTrustLineIsAbsent();
 
 protected:
     const string logHeader() const;
@@ -27,7 +27,7 @@ GetTrustLinesCommand::Shared GetFirstLevelContractorsBalancesTransaction::comman
     return mCommand;
 }
 
-TransactionResult::SharedConst GetFirstLevelContractorsBalancesTransaction::run() {
+TransactionResult GetFirstLevelContractorsBalancesTransaction::run() {
     const auto kNeighborsCount = mTrustLinesManager->trustLines().size();
     stringstream ss;
     ss << to_string(kNeighborsCount);
@@ -31,7 +31,7 @@ public:
 
     GetTrustLinesCommand::Shared command() const;
 
-    TransactionResult::SharedConst run();
+    TransactionResult run();
 
 protected:
     const string logHeader() const;
@@ -27,7 +27,7 @@ GetFirstLevelContractorsCommand::Shared GetFirstLevelContractorsTransaction::com
     return mCommand;
 }
 
-TransactionResult::SharedConst GetFirstLevelContractorsTransaction::run() {
+TransactionResult GetFirstLevelContractorsTransaction::run() {
     const auto kNeighborsCount = mTrustLinesManager->trustLines().size();
     stringstream ss;
     ss << to_string(kNeighborsCount);
@@ -31,7 +31,7 @@ public:
 
     GetFirstLevelContractorsCommand::Shared command() const;
 
-    TransactionResult::SharedConst run();
+    TransactionResult run();
 
 protected:
     const string logHeader() const;
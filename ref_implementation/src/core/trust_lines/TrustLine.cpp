@@ -101,42 +101,40 @@ const TrustLineBalance &TrustLine::balance() const
 /*!
  * Returns amount that is available to use on the trust line.
  */
-ConstSharedTrustLineAmount TrustLine::availableOutgoingAmount() const
+TrustLineAmount TrustLine::availableOutgoingAmount() const
 {
     if (mBalance < kZeroBalance() && absoluteBalanceAmount(mBalance) > mIncomingTrustAmount) {
-        return make_shared<const TrustLineAmount>(0);
+        return 0;
     }
-    return make_shared<const TrustLineAmount>(
-        mIncomingTrustAmount + mBalance);
+    return TrustLineAmount(mIncomingTrustAmount + mBalance);
 }
 
 /*!
  * Returns amount that is available to use on the trust line from contractor node.
  */
-ConstSharedTrustLineAmount TrustLine::availableIncomingAmount() const
+TrustLineAmount TrustLine::availableIncomingAmount() const
 {
     if (mBalance > kZeroBalance() && absoluteBalanceAmount(mBalance) > mOutgoingTrustAmount) {
-        return make_shared<const TrustLineAmount>(0);
+        return 0;
     }
-    return make_shared<const TrustLineAmount>(
-        mOutgoingTrustAmount - mBalance);
+    return TrustLineAmount(mOutgoingTrustAmount - mBalance);
 }
 
-ConstSharedTrustLineAmount TrustLine::usedAmountByContractor() const
+TrustLineAmount TrustLine::usedAmountByContractor() const
 {
     if (mBalance >= kZeroBalance()) {
-        return make_shared<const TrustLineAmount>(mBalance);
+        return TrustLineAmount(mBalance);
     } else {
-        return make_shared<const TrustLineAmount>(0);
+        return 0;
     }
 }
 
-ConstSharedTrustLineAmount TrustLine::usedAmountBySelf() const
+TrustLineAmount TrustLine::usedAmountBySelf() const
 {
     if (mBalance <= kZeroBalance()) {
-        return make_shared<const TrustLineAmount>(-mBalance);
+        return TrustLineAmount(-mBalance);
     } else {
-        return make_shared<const TrustLineAmount>(0);
+        return 0;
     }
 }
 
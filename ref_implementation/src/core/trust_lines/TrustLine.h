@@ -65,13 +65,13 @@ public:
 
     const TrustLineBalance& balance() const;
 
-    ConstSharedTrustLineAmount availableOutgoingAmount() const;
+    TrustLineAmount availableOutgoingAmount() const;
 
-    ConstSharedTrustLineAmount availableIncomingAmount() const;
+    TrustLineAmount availableIncomingAmount() const;
 
-    ConstSharedTrustLineAmount usedAmountByContractor() const;
+    TrustLineAmount usedAmountByContractor() const;
 
-    ConstSharedTrustLineAmount usedAmountBySelf() const;
+    TrustLineAmount usedAmountBySelf() const;
 
     bool isContractorGateway() const;
 
@@ -299,7 +299,7 @@ AmountReservation::ConstShared TrustLinesManager::reserveOutgoingAmount(
     const TrustLineAmount &amount)
 {
     const auto kAvailableAmount = outgoingTrustAmountConsideringReservations(contractor);
-    if (*kAvailableAmount >= amount) {
+    if (kAvailableAmount >= amount) {
         return mAmountReservationsHandler->reserve(
             contractor,
             transactionUUID,
@@ -317,7 +317,7 @@ AmountReservation::ConstShared TrustLinesManager::reserveIncomingAmount(
     const TrustLineAmount& amount)
 {
     const auto kAvailableAmount = incomingTrustAmountConsideringReservations(contractor);
-    if (*kAvailableAmount >= amount) {
+    if (kAvailableAmount >= amount) {
         return mAmountReservationsHandler->reserve(
             contractor,
             transactionUUID,
@@ -338,8 +338,7 @@ AmountReservation::ConstShared TrustLinesManager::updateAmountReservation(
     assert(newAmount > TrustLineAmount(0));
 #endif
 
-    // Note: copy of shared ptr is required
-    const auto kAvailableAmount = *(outgoingTrustAmountConsideringReservations(contractor));
+    const auto kAvailableAmount = outgoingTrustAmountConsideringReservations(contractor);
 
     // Previous reservation would be removed (updated),
     // so it's amount must be added to the the available amount on the trust line.
@@ -363,7 +362,7 @@ void TrustLinesManager::dropAmountReservation(
         reservation);
 }
 
-ConstSharedTrustLineAmount TrustLinesManager::outgoingTrustAmountConsideringReservations(
+TrustLineAmount TrustLinesManager::outgoingTrustAmountConsideringReservations(
     const NodeUUID& contractor) const
 {
     const auto kTL = trustLineReadOnly(contractor);
@@ -371,14 +370,13 @@ ConstSharedTrustLineAmount TrustLinesManager::outgoingTrustAmountConsideringRese
     const auto kAlreadyReservedAmount = mAmountReservationsHandler->totalReserved(
         contractor, AmountReservation::Outgoing);
 
-    if (*kAlreadyReservedAmount >= *kAvailableAmount) {
-        return make_shared<const TrustLineAmount>(0);
+    if (kAlreadyReservedAmount >= kAvailableAmount) {
+        return TrustLine::kZeroAmount();
     }
-    return make_shared<const TrustLineAmount>(
-        *kAvailableAmount - *kAlreadyReservedAmount);
+    return kAvailableAmount - kAlreadyReservedAmount;
 }
 
-ConstSharedTrustLineAmount TrustLinesManager::incomingTrustAmountConsideringReservations(
+TrustLineAmount TrustLinesManager::incomingTrustAmountConsideringReservations(
     const NodeUUID& contractor) const
 {
     const auto kTL = trustLineReadOnly(contractor);
@@ -386,76 +384,73 @@ ConstSharedTrustLineAmount TrustLinesManager::incomingTrustAmountConsideringRese
     const auto kAlreadyReservedAmount = mAmountReservationsHandler->totalReserved(
         contractor, AmountReservation::Incoming);
 
-    if (*kAlreadyReservedAmount >= *kAvailableAmount) {
-        return make_shared<const TrustLineAmount>(0);
+    if (kAlreadyReservedAmount >= kAvailableAmount) {
+        return TrustLine::kZeroAmount();
     }
-    return make_shared<const TrustLineAmount>(
-        *kAvailableAmount - *kAlreadyReservedAmount);
+    return kAvailableAmount - kAlreadyReservedAmount;
 }
 
-pair<ConstSharedTrustLineAmount, ConstSharedTrustLineAmount> TrustLinesManager::availableOutgoingCycleAmounts(
+pair<TrustLineAmount, TrustLineAmount> TrustLinesManager::availableOutgoingCycleAmounts(
     const NodeUUID &contractor) const
 {
     const auto kTL = trustLineReadOnly(contractor);
     const auto kBalance = kTL->balance();
     if (kBalance <= TrustLine::kZeroBalance()) {
         return make_pair(
-            make_shared<const TrustLineAmount>(0),
-            make_shared<const TrustLineAmount>(0));
+            TrustLine::kZeroAmount(),
+            TrustLine::kZeroAmount());
     }
 
     const auto kAlreadyReservedAmount = mAmountReservationsHandler->totalReserved(
         contractor, AmountReservation::Outgoing);
 
-    if (*kAlreadyReservedAmount.get() == TrustLine::kZeroAmount()) {
+    if (kAlreadyReservedAmount == TrustLine::kZeroAmount()) {
         return make_pair(
-            make_shared<const TrustLineAmount>(kBalance),
-            make_shared<const TrustLineAmount>(kBalance));
+            TrustLineAmount(kBalance),
+            TrustLineAmount(kBalance));
     }
 
     auto kAbsoluteBalance = absoluteBalanceAmount(kBalance);
-    if (*kAlreadyReservedAmount.get() > kAbsoluteBalance) {
+    if (kAlreadyReservedAmount > kAbsoluteBalance) {
         return make_pair(
-            make_shared<const TrustLineAmount>(0),
-            make_shared<const TrustLineAmount>(kBalance));
+            TrustLine::kZeroAmount(),
+            TrustLineAmount(kBalance));
     } else {
         return make_pair(
-            make_shared<const TrustLineAmount>(
-                kAbsoluteBalance - *kAlreadyReservedAmount.get()),
-            make_shared<const TrustLineAmount>(kBalance));
+            TrustLineAmount(kAbsoluteBalance - kAlreadyReservedAmount),
+            TrustLineAmount(kBalance));
     }
 }
 
-pair<ConstSharedTrustLineAmount, ConstSharedTrustLineAmount> TrustLinesManager::availableIncomingCycleAmounts(
+pair<TrustLineAmount, TrustLineAmount> TrustLinesManager::availableIncomingCycleAmounts(
     const NodeUUID &contractor) const
 {
     const auto kTL = trustLineReadOnly(contractor);
     const auto kBalance = kTL->balance();
     if (kBalance >= TrustLine::kZeroBalance()) {
         return make_pair(
-            make_shared<const TrustLineAmount>(0),
-            make_shared<const TrustLineAmount>(0));
+            TrustLine::kZeroAmount(),
+            TrustLine::kZeroAmount());
     }
 
     const auto kAlreadyReservedAmount = mAmountReservationsHandler->totalReserved(
         contractor, AmountReservation::Incoming);
 
     auto kAbsoluteBalance = absoluteBalanceAmount(kBalance);
-    if (*kAlreadyReservedAmount.get() == TrustLine::kZeroAmount()) {
+    if (kAlreadyReservedAmount == TrustLine::kZeroAmount()) {
         return make_pair(
-            make_shared<const TrustLineAmount>(kAbsoluteBalance),
-            make_shared<const TrustLineAmount>(kAbsoluteBalance));
+            kAbsoluteBalance,
+            kAbsoluteBalance);
     }
 
-    if (*kAlreadyReservedAmount.get() >= kAbsoluteBalance) {
+    if (kAlreadyReservedAmount >= kAbsoluteBalance) {
         return make_pair(
-            make_shared<const TrustLineAmount>(0),
-            make_shared<const TrustLineAmount>(kAbsoluteBalance));
+            TrustLine::kZeroAmount(),
+            kAbsoluteBalance);
     }
     return make_pair(
-        make_shared<const TrustLineAmount>(
-            kAbsoluteBalance - *kAlreadyReservedAmount.get()),
-        make_shared<const TrustLineAmount>(kAbsoluteBalance));
+        TrustLineAmount(kAbsoluteBalance - kAlreadyReservedAmount),
+        kAbsoluteBalance);
 }
 
 const bool TrustLinesManager::trustLineIsPresent (
@@ -517,10 +512,8 @@ bool TrustLinesManager::isTrustLineEmpty(
                     "There is no trust line to the contractor.");
     }
 
-    auto outgoingAmountShared = outgoingTrustAmountConsideringReservations(contractorUUID);
-    auto incomingAmountShared = incomingTrustAmountConsideringReservations(contractorUUID);
-    return (*outgoingAmountShared.get() == 0
-        and *incomingAmountShared.get() == 0
+    return (outgoingTrustAmountConsideringReservations(contractorUUID) == 0
+        and incomingTrustAmountConsideringReservations(contractorUUID) == 0
         and balance(contractorUUID) == 0);
 }
 
@@ -528,10 +521,9 @@ vector<NodeUUID> TrustLinesManager::firstLevelNeighborsWithOutgoingFlow() const
 {
     vector<NodeUUID> result;
     for (auto const &nodeUUIDAndTrustLine : mTrustLines) {
-        auto trustLineAmountShared = outgoingTrustAmountConsideringReservations(
+        const auto kTrustLineAmount = outgoingTrustAmountConsideringReservations(
             nodeUUIDAndTrustLine.first);
-        auto trustLineAmountPtr = trustLineAmountShared.get();
-        if (*trustLineAmountPtr > TrustLine::kZeroAmount()) {
+        if (kTrustLineAmount > TrustLine::kZeroAmount()) {
             result.push_back(
                 nodeUUIDAndTrustLine.first);
         }
@@ -546,10 +538,9 @@ vector<NodeUUID> TrustLinesManager::firstLevelGatewayNeighborsWithOutgoingFlow()
         if (!nodeUUIDAndTrustLine.second->isContractorGateway()) {
             continue;
         }
-        auto trustLineAmountShared = outgoingTrustAmountConsideringReservations(
+        const auto kTrustLineAmount = outgoingTrustAmountConsideringReservations(
             nodeUUIDAndTrustLine.first);
-        auto trustLineAmountPtr = trustLineAmountShared.get();
-        if (*trustLineAmountPtr > TrustLine::kZeroAmount()) {
+        if (kTrustLineAmount > TrustLine::kZeroAmount()) {
             result.push_back(
                 nodeUUIDAndTrustLine.first);
         }
@@ -561,11 +552,10 @@ vector<NodeUUID> TrustLinesManager::firstLevelNeighborsWithIncomingFlow() const
 {
     vector<NodeUUID> result;
     for (auto const &nodeUUIDAndTrustLine : mTrustLines) {
-        auto trustLineAmountShared = incomingTrustAmountConsideringReservations(
+        const auto kTrustLineAmount = incomingTrustAmountConsideringReservations(
             nodeUUIDAndTrustLine.first);
-        auto trustLineAmountPtr = trustLineAmountShared.get();
 
-        if (*trustLineAmountPtr > TrustLine::kZeroAmount()) {
+        if (kTrustLineAmount > TrustLine::kZeroAmount()) {
             result.push_back(
                 nodeUUIDAndTrustLine.first);
         }
@@ -580,44 +570,43 @@ vector<NodeUUID> TrustLinesManager::firstLevelNonGatewayNeighborsWithIncomingFlo
         if (nodeUUIDAndTrustLine.second->isContractorGateway()) {
             continue;
         }
-        auto trustLineAmountShared = incomingTrustAmountConsideringReservations(
+        const auto kTrustLineAmount = incomingTrustAmountConsideringReservations(
             nodeUUIDAndTrustLine.first);
-        auto trustLineAmountPtr = trustLineAmountShared.get();
 
-        if (*trustLineAmountPtr > TrustLine::kZeroAmount()) {
+        if (kTrustLineAmount > TrustLine::kZeroAmount()) {
             result.push_back(nodeUUIDAndTrustLine.first);
         }
     }
     return result;
 }
 
-vector<pair<NodeUUID, ConstSharedTrustLineAmount>> TrustLinesManager::incomingFlows() const {
-    vector<pair<NodeUUID, ConstSharedTrustLineAmount>> result;
+vector<pair<NodeUUID, TrustLineAmount>> TrustLinesManager::incomingFlows() const {
+    vector<pair<NodeUUID, TrustLineAmount>> result;
+    result.reserve(mTrustLines.size());
     for (auto const &nodeUUIDAndTrustLine : mTrustLines) {
-        auto trustLineAmountShared = incomingTrustAmountConsideringReservations(
-            nodeUUIDAndTrustLine.first);
         result.push_back(
             make_pair(
                 nodeUUIDAndTrustLine.first,
-                trustLineAmountShared));
+                incomingTrustAmountConsideringReservations(
+                    nodeUUIDAndTrustLine.first)));
     }
     return result;
 }
 
-vector<pair<NodeUUID, ConstSharedTrustLineAmount>> TrustLinesManager::outgoingFlows() const {
-    vector<pair<NodeUUID, ConstSharedTrustLineAmount>> result;
+vector<pair<NodeUUID, TrustLineAmount>> TrustLinesManager::outgoingFlows() const {
+    vector<pair<NodeUUID, TrustLineAmount>> result;
+    result.reserve(mTrustLines.size());
     for (auto const &nodeUUIDAndTrustLine : mTrustLines) {
-        auto trustLineAmountShared = outgoingTrustAmountConsideringReservations(
-            nodeUUIDAndTrustLine.first);
         result.push_back(
             make_pair(
                 nodeUUIDAndTrustLine.first,
-                trustLineAmountShared));
+                outgoingTrustAmountConsideringReservations(
+                    nodeUUIDAndTrustLine.first)));
     }
     return result;
 }
 
-pair<NodeUUID, ConstSharedTrustLineAmount> TrustLinesManager::incomingFlow(
+pair<NodeUUID, TrustLineAmount> TrustLinesManager::incomingFlow(
     const NodeUUID &contractorUUID) const
 {
     return make_pair(
@@ -626,7 +615,7 @@ pair<NodeUUID, ConstSharedTrustLineAmount> TrustLinesManager::incomingFlow(
             contractorUUID));
 }
 
-pair<NodeUUID, ConstSharedTrustLineAmount> TrustLinesManager::outgoingFlow(
+pair<NodeUUID, TrustLineAmount> TrustLinesManager::outgoingFlow(
         const NodeUUID &contractorUUID) const
 {
     return make_pair(
@@ -635,34 +624,32 @@ pair<NodeUUID, ConstSharedTrustLineAmount> TrustLinesManager::outgoingFlow(
             contractorUUID));
 }
 
-vector<pair<NodeUUID, ConstSharedTrustLineAmount>> TrustLinesManager::incomingFlowsFromNonGateways() const {
-    vector<pair<NodeUUID, ConstSharedTrustLineAmount>> result;
+vector<pair<NodeUUID, TrustLineAmount>> TrustLinesManager::incomingFlowsFromNonGateways() const {
+    vector<pair<NodeUUID, TrustLineAmount>> result;
     for (auto const &nodeUUIDAndTrustLine : mTrustLines) {
         if (nodeUUIDAndTrustLine.second->isContractorGateway()) {
             continue;
         }
-        auto trustLineAmountShared = incomingTrustAmountConsideringReservations(
-            nodeUUIDAndTrustLine.first);
         result.push_back(
             make_pair(
                 nodeUUIDAndTrustLine.first,
-                trustLineAmountShared));
+                incomingTrustAmountConsideringReservations(
+                    nodeUUIDAndTrustLine.first)));
     }
     return result;
 }
 
-vector<pair<NodeUUID, ConstSharedTrustLineAmount>> TrustLinesManager::outgoingFlowsToGateways() const {
-    vector<pair<NodeUUID, ConstSharedTrustLineAmount>> result;
+vector<pair<NodeUUID, TrustLineAmount>> TrustLinesManager::outgoingFlowsToGateways() const {
+    vector<pair<NodeUUID, TrustLineAmount>> result;
     for (auto const &nodeUUIDAndTrustLine : mTrustLines) {
         if (!nodeUUIDAndTrustLine.second->isContractorGateway()) {
             continue;
         }
-        auto trustLineAmountShared = outgoingTrustAmountConsideringReservations(
-            nodeUUIDAndTrustLine.first);
         result.push_back(
             make_pair(
                 nodeUUIDAndTrustLine.first,
-                trustLineAmountShared));
+                outgoingTrustAmountConsideringReservations(
+                    nodeUUIDAndTrustLine.first)));
     }
     return result;
 }
@@ -689,13 +676,13 @@ vector<NodeUUID> TrustLinesManager::rt1() const {
     return result;
 }
 
-ConstSharedTrustLineBalance TrustLinesManager::totalBalance() const
+TrustLineBalance TrustLinesManager::totalBalance() const
 {
     TrustLineBalance result = TrustLine::kZeroBalance();
     for (const auto trustLine : mTrustLines) {
         result += trustLine.second->balance();
     }
-    return make_shared<const TrustLineBalance>(result);
+    return result;
 }
 
 /**
@@ -829,23 +816,21 @@ void TrustLinesManager::useReservation(
     }
 }
 
-ConstSharedTrustLineAmount TrustLinesManager::totalOutgoingAmount () const
+TrustLineAmount TrustLinesManager::totalOutgoingAmount () const
 {
-    auto totalAmount = make_shared<TrustLineAmount>(0);
-    for (const auto kTrustLine : mTrustLines) {
-        const auto kTLAmount = outgoingTrustAmountConsideringReservations(kTrustLine.first);
-        *totalAmount += *(kTLAmount);
+    TrustLineAmount totalAmount = 0;
+    for (const auto &kTrustLine : mTrustLines) {
+        totalAmount += outgoingTrustAmountConsideringReservations(kTrustLine.first);
     }
 
     return totalAmount;
 }
 
-ConstSharedTrustLineAmount TrustLinesManager::totalIncomingAmount () const
+TrustLineAmount TrustLinesManager::totalIncomingAmount () const
 {
-    auto totalAmount = make_shared<TrustLineAmount>(0);
-    for (const auto kTrustLine : mTrustLines) {
-        const auto kTLAmount = incomingTrustAmountConsideringReservations(kTrustLine.first);
-        *totalAmount += *(kTLAmount);
+    TrustLineAmount totalAmount = 0;
+    for (const auto &kTrustLine : mTrustLines) {
+        totalAmount += incomingTrustAmountConsideringReservations(kTrustLine.first);
     }
 
     return totalAmount;
@@ -880,24 +865,24 @@ void TrustLinesManager::printRTs()
                << itTrustLine.second->isContractorGateway() << endl;
     }
     debug << "print payment incoming flows size: " << incomingFlows().size() << endl;
-    for (auto const itIncomingFlow : incomingFlows()) {
-        debug << itIncomingFlow.first << " " << *itIncomingFlow.second.get() << endl;
+    for (const auto &itIncomingFlow : incomingFlows()) {
+        debug << itIncomingFlow.first << " " << itIncomingFlow.second << endl;
     }
     debug << "print payment outgoing flows size: " << outgoingFlows().size() << endl;
-    for (auto const itOutgoingFlow : outgoingFlows()) {
-        debug << itOutgoingFlow.first << " " << *itOutgoingFlow.second.get() << endl;
+    for (const auto &itOutgoingFlow : outgoingFlows()) {
+        debug << itOutgoingFlow.first << " " << itOutgoingFlow.second << endl;
     }
     debug << "print cycle incoming flows size: " << incomingFlows().size() << endl;
     for (auto const trLine : mTrustLines) {
         auto const availableIncomingCycleAmounts = this->availableIncomingCycleAmounts(trLine.first);
-        debug << trLine.first << " " << *(availableIncomingCycleAmounts.first)
-              << " " << *(availableIncomingCycleAmounts.second) << endl;
+        debug << trLine.first << " " << availableIncomingCycleAmounts.first
+              << " " << availableIncomingCycleAmounts.second << endl;
     }
     debug << "print cycle outgoing flows size: " << outgoingFlows().size() << endl;
     for (auto const trLine : mTrustLines) {
         auto const availableOutgoingCycleAmounts = this->availableOutgoingCycleAmounts(trLine.first);
-        debug << trLine.first << " " << *(availableOutgoingCycleAmounts.first)
-              << " " << *(availableOutgoingCycleAmounts.second) << endl;
+        debug << trLine.first << " " << availableOutgoingCycleAmounts.first
+              << " " << availableOutgoingCycleAmounts.second << endl;
     }
 }
 
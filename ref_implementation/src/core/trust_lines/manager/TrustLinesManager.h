@@ -223,7 +223,7 @@ public:
      *
      * @throws NotFoundError in case if no trust line to this contractor is present.
      */
-    ConstSharedTrustLineAmount outgoingTrustAmountConsideringReservations(
+    TrustLineAmount outgoingTrustAmountConsideringReservations(
         const NodeUUID &contractor) const;
 
     /**
@@ -231,31 +231,31 @@ public:
      *
      * @throws NotFoundError in case if no trust line from this contractor is present.
      */
-    ConstSharedTrustLineAmount incomingTrustAmountConsideringReservations(
+    TrustLineAmount incomingTrustAmountConsideringReservations(
         const NodeUUID &contractor) const;
 
     //ToDo: comment this method
     // available outgoing amount considering reservations for cycles
     // returns 2 values: 1) amount considering reservations, 2) amount don't considering reservations
-    pair<ConstSharedTrustLineAmount, ConstSharedTrustLineAmount> availableOutgoingCycleAmounts(
+    pair<TrustLineAmount, TrustLineAmount> availableOutgoingCycleAmounts(
         const NodeUUID &contractor) const;
 
     //ToDo: comment this method
     // available incoming amount considering reservations for cycles
     // returns 2 values: 1) amount considering reservations, 2) amount don't considering reservations
-    pair<ConstSharedTrustLineAmount, ConstSharedTrustLineAmount> availableIncomingCycleAmounts(
+    pair<TrustLineAmount, TrustLineAmount> availableIncomingCycleAmounts(
         const NodeUUID &contractor) const;
 
     /**
      * @returns total summary of all outgoing possibilities of the node.
      */
-    ConstSharedTrustLineAmount totalOutgoingAmount()
+    TrustLineAmount totalOutgoingAmount()
         const;
 
     /**
      * @returns total summary of all incoming possibilities of the node.
      */
-    ConstSharedTrustLineAmount totalIncomingAmount()
+    TrustLineAmount totalIncomingAmount()
         const;
 
     // get all reservations (all transactions) to requested contractor
@@ -296,26 +296,26 @@ public:
 
     vector<NodeUUID> firstLevelNeighborsWithNoneZeroBalance() const;
 
-    vector<pair<NodeUUID, ConstSharedTrustLineAmount>> incomingFlows() const;
+    vector<pair<NodeUUID, TrustLineAmount>> incomingFlows() const;
 
-    vector<pair<NodeUUID, ConstSharedTrustLineAmount>> outgoingFlows() const;
+    vector<pair<NodeUUID, TrustLineAmount>> outgoingFlows() const;
 
-    pair<NodeUUID, ConstSharedTrustLineAmount> incomingFlow(
+    pair<NodeUUID, TrustLineAmount> incomingFlow(
         const NodeUUID &contractorUUID) const;
 
-    pair<NodeUUID, ConstSharedTrustLineAmount> outgoingFlow(
+    pair<NodeUUID, TrustLineAmount> outgoingFlow(
         const NodeUUID &contractorUUID) const;
 
-    vector<pair<NodeUUID, ConstSharedTrustLineAmount>> incomingFlowsFromNonGateways() const;
+    vector<pair<NodeUUID, TrustLineAmount>> incomingFlowsFromNonGateways() const;
 
-    vector<pair<NodeUUID, ConstSharedTrustLineAmount>> outgoingFlowsToGateways() const;
+    vector<pair<NodeUUID, TrustLineAmount>> outgoingFlowsToGateways() const;
 
     vector<NodeUUID> gateways() const;
 
     vector<NodeUUID> rt1() const;
 
     // total balance to all 1st level neighbors
-    ConstSharedTrustLineBalance totalBalance() const;
+    TrustLineBalance totalBalance() const;
 
     const TrustLine::ConstShared trustLineReadOnly(
         const NodeUUID &contractorUUID) const;